@@ -0,0 +1,28 @@
+#include "allocations.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<size_t> allocation_count(0);
+std::atomic<size_t> allocation_bytes(0);
+}  // namespace
+
+void reset_allocations() {
+  allocation_count = 0;
+  allocation_bytes = 0;
+}
+
+Allocations allocations() { return {allocation_count.load(), allocation_bytes.load()}; }
+
+void *operator new(size_t size) {
+  allocation_count++;
+  allocation_bytes += size;
+  if (void *p = std::malloc(size)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, size_t) noexcept { std::free(p); }
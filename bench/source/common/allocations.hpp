@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Counters for heap allocations made through the global operator new.
+ *
+ * Benchmarks can reset these before the code under measurement runs and read
+ * them afterwards, to report the number of allocations and bytes requested.
+ */
+struct Allocations {
+  size_t count;
+  size_t bytes;
+};
+
+void reset_allocations();
+Allocations allocations();
@@ -0,0 +1,147 @@
+#include "generators.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <meos/io/Serializer.hpp>
+#include <vector>
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+time_point const epoch = time_point(duration_ms(1577836800000L));  // 2020-01-01
+
+size_t const sequence_length = 1000;
+
+template <typename BaseType> void build(size_t n, TInstantSet<BaseType> &temporal) {
+  temporal = TInstantSet<BaseType>(make_instants<BaseType>(n));
+}
+
+template <typename BaseType> void build(size_t n, TSequence<BaseType> &temporal) {
+  set<TInstant<BaseType>> instants = make_instants<BaseType>(n);
+  temporal = TSequence<BaseType>(instants, true, true);
+}
+
+template <typename BaseType> void build(size_t n, TSequenceSet<BaseType> &temporal) {
+  temporal = TSequenceSet<BaseType>(make_sequences<BaseType>(n));
+}
+
+}  // namespace
+
+template <> bool make_value(size_t i) { return i % 3 == 0; }
+template <> int make_value(size_t i) { return static_cast<int>((i * 7919) % 1000); }
+template <> float make_value(size_t i) { return static_cast<float>((i * 7919) % 1000) / 7; }
+template <> string make_value(size_t i) { return "value " + to_string((i * 7919) % 1000); }
+template <> GeomPoint make_value(size_t i) {
+  return GeomPoint(static_cast<double>(i) / 3, static_cast<double>((i * 7919) % 1000) / 7, 4326);
+}
+
+time_point make_timestamp(size_t i) { return epoch + duration_ms(1000 * i); }
+
+vector<time_point> make_timestamps(size_t n, size_t step, size_t offset) {
+  vector<time_point> timestamps;
+  timestamps.reserve(n);
+  for (size_t i = 0; i < n; i++) timestamps.push_back(make_timestamp(offset + step * i));
+  return timestamps;
+}
+
+template <typename BaseType> set<TInstant<BaseType>> make_instants(size_t n) {
+  set<TInstant<BaseType>> instants;
+  for (size_t i = 0; i < n; i++) {
+    instants.insert(instants.end(), TInstant<BaseType>(make_value<BaseType>(i), make_timestamp(i)));
+  }
+  return instants;
+}
+
+template <typename BaseType> set<TSequence<BaseType>> make_sequences(size_t n) {
+  set<TSequence<BaseType>> sequences;
+  for (size_t begin = 0; begin < n; begin += sequence_length) {
+    size_t const end = min(begin + sequence_length, n);
+    vector<time_point> timestamps;
+    vector<BaseType> values;
+    timestamps.reserve(end - begin);
+    values.reserve(end - begin);
+    for (size_t i = begin; i < end; i++) {
+      timestamps.push_back(make_timestamp(i));
+      values.push_back(make_value<BaseType>(i));
+    }
+    sequences.insert(sequences.end(),
+                     TSequence<BaseType>(move(timestamps), move(values), true, true));
+  }
+  return sequences;
+}
+
+template <template <typename> class TemporalType, typename BaseType>
+TemporalType<BaseType> make_temporal(size_t n) {
+  TemporalType<BaseType> temporal;
+  build(n, temporal);
+  return temporal;
+}
+
+template <typename BaseType> set<string> make_serialized_instants(size_t n) {
+  Serializer<BaseType> w;
+  set<string> serialized;
+  for (TInstant<BaseType> const &instant : make_instants<BaseType>(n)) {
+    serialized.insert(w.write(&instant));
+  }
+  return serialized;
+}
+
+PeriodSet make_alternating_periods(size_t n) {
+  set<Period> periods;
+  for (size_t i = 0; i < max<size_t>(n, 2); i += 2) {
+    periods.insert(periods.end(), Period(make_timestamp(i), make_timestamp(i + 1), true, false));
+  }
+  return PeriodSet(periods);
+}
+
+TSequence<GeomPoint> make_trajectory(size_t n, bool stops) {
+  vector<time_point> timestamps;
+  vector<GeomPoint> points;
+  timestamps.reserve(n);
+  points.reserve(n);
+  double x = 0, y = 0;
+  for (size_t i = 0; i < n; i++) {
+    bool const moves = !stops || i % 600 >= 60;
+    if (moves) {
+      double const heading = sin(static_cast<double>(i) / 300) * 2;
+      x += 10 * cos(heading);
+      y += 10 * sin(heading);
+    }
+    double const noise = moves ? static_cast<double>((i * 7919) % 1000) / 1000 : 0;
+    timestamps.push_back(make_timestamp(i));
+    points.emplace_back(x + noise, y - noise, 3857);
+  }
+  return TSequence<GeomPoint>(move(timestamps), move(points), true, true);
+}
+
+TSequence<float> make_sensor(size_t n, long offset) {
+  vector<time_point> timestamps;
+  vector<float> values;
+  timestamps.reserve(n);
+  values.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    timestamps.push_back(epoch + duration_ms(2000 * i + offset));
+    values.push_back(static_cast<float>((i * 7919) % 1000) - 500);
+  }
+  return TSequence<float>(move(timestamps), move(values), true, true);
+}
+
+void instant_counts(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(10)->Range(1, 1000000);
+}
+
+#define INSTANTIATE(BaseType)                                                      \
+  template set<TInstant<BaseType>> make_instants(size_t n);                        \
+  template set<TSequence<BaseType>> make_sequences(size_t n);                      \
+  template set<string> make_serialized_instants<BaseType>(size_t n);               \
+  template TInstantSet<BaseType> make_temporal<TInstantSet, BaseType>(size_t n);   \
+  template TSequence<BaseType> make_temporal<TSequence, BaseType>(size_t n);       \
+  template TSequenceSet<BaseType> make_temporal<TSequenceSet, BaseType>(size_t n);
+
+INSTANTIATE(bool)
+INSTANTIATE(int)
+INSTANTIATE(float)
+INSTANTIATE(string)
+INSTANTIATE(GeomPoint)
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/types/time/PeriodSet.hpp>
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * Deterministic inputs shared by the benchmarks, for each of the base types.
+ *
+ * The i-th instant is at one second past the (i-1)-th, starting on 2020-01-01.
+ * Values are spread so that neighbouring instants differ.
+ */
+
+template <typename BaseType> BaseType make_value(size_t i);
+
+meos::time_point make_timestamp(size_t i);
+
+/**
+ * n timestamps, one every step seconds from make_timestamp(offset).
+ */
+std::vector<meos::time_point> make_timestamps(size_t n, size_t step = 1, size_t offset = 0);
+
+template <typename BaseType> std::set<meos::TInstant<BaseType>> make_instants(size_t n);
+
+/**
+ * n instants, split into inclusive sequences of at most 1000 instants each.
+ */
+template <typename BaseType> std::set<meos::TSequence<BaseType>> make_sequences(size_t n);
+
+/**
+ * A temporal value of the given duration, with n instants in total.
+ */
+template <template <typename> class TemporalType, typename BaseType>
+TemporalType<BaseType> make_temporal(size_t n);
+
+/**
+ * The serialized form of each of the n instants of make_instants().
+ */
+template <typename BaseType> std::set<std::string> make_serialized_instants(size_t n);
+
+/**
+ * Every other second from the first to the n-th instant.
+ */
+meos::PeriodSet make_alternating_periods(size_t n);
+
+/**
+ * GPS fix every second from make_timestamp(0), driving along a winding road at
+ * about 10 m/s with up to 1 m of noise, in meters. With stops, the vehicle
+ * instead stands still, without noise, for the first minute of every ten.
+ */
+meos::TSequence<meos::GeomPoint> make_trajectory(size_t n, bool stops = false);
+
+/**
+ * Sensor reading every 2 seconds from offset milliseconds after
+ * make_timestamp(0), so that two sensors with different offsets interleave.
+ */
+meos::TSequence<float> make_sensor(size_t n, long offset);
+
+/**
+ * Registers the benchmark for 1 to 1M instants, in powers of ten.
+ */
+void instant_counts(benchmark::internal::Benchmark *b);
+
+/**
+ * Registers the benchmark for the three durations and the five base types, over
+ * 1 to 1M instants, e.g. BM_Temporal_Shift<TSequence, float>/1000. Expects the
+ * meos and std namespaces to be in use.
+ */
+#define BENCHMARK_TEMPORALS(func)                                           \
+  BENCHMARK_TEMPLATE2(func, TInstantSet, bool)->Apply(instant_counts);      \
+  BENCHMARK_TEMPLATE2(func, TInstantSet, int)->Apply(instant_counts);       \
+  BENCHMARK_TEMPLATE2(func, TInstantSet, float)->Apply(instant_counts);     \
+  BENCHMARK_TEMPLATE2(func, TInstantSet, string)->Apply(instant_counts);    \
+  BENCHMARK_TEMPLATE2(func, TInstantSet, GeomPoint)->Apply(instant_counts); \
+  BENCHMARK_TEMPLATE2(func, TSequence, bool)->Apply(instant_counts);        \
+  BENCHMARK_TEMPLATE2(func, TSequence, int)->Apply(instant_counts);         \
+  BENCHMARK_TEMPLATE2(func, TSequence, float)->Apply(instant_counts);       \
+  BENCHMARK_TEMPLATE2(func, TSequence, string)->Apply(instant_counts);      \
+  BENCHMARK_TEMPLATE2(func, TSequence, GeomPoint)->Apply(instant_counts);   \
+  BENCHMARK_TEMPLATE2(func, TSequenceSet, bool)->Apply(instant_counts);     \
+  BENCHMARK_TEMPLATE2(func, TSequenceSet, int)->Apply(instant_counts);      \
+  BENCHMARK_TEMPLATE2(func, TSequenceSet, float)->Apply(instant_counts);    \
+  BENCHMARK_TEMPLATE2(func, TSequenceSet, string)->Apply(instant_counts);   \
+  BENCHMARK_TEMPLATE2(func, TSequenceSet, GeomPoint)->Apply(instant_counts)
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <meos/index/RTree.hpp>
+#include <random>
+#include <vector>
+
+#include "../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+long const hour = 60 * 60 * 1000L;
+
+/**
+ * Boxes of short trajectories scattered over a 10km square and a month.
+ */
+vector<STBox> make_boxes(size_t n, unsigned seed) {
+  mt19937 gen(seed);
+  uniform_real_distribution<double> coordinate(0, 10000);
+  uniform_real_distribution<double> extent(0, 50);
+  uniform_int_distribution<long> start(0, 30 * 24 * hour);
+  uniform_int_distribution<long> span(0, hour);
+  vector<STBox> boxes;
+  boxes.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    double const x = coordinate(gen), y = coordinate(gen);
+    time_point const t = make_timestamp(0) + duration_ms(start(gen));
+    boxes.emplace_back(x, y, t, x + extent(gen), y + extent(gen), t + duration_ms(span(gen)));
+  }
+  return boxes;
+}
+
+/**
+ * Windows of 200m and 6 hours around random points.
+ */
+vector<STBox> make_windows(size_t n) {
+  vector<STBox> windows;
+  for (STBox const &box : make_boxes(n, 7)) {
+    windows.push_back(box.expand(100.0).expand(duration_ms(3 * hour)));
+  }
+  return windows;
+}
+
+}  // namespace
+
+static void BM_RTree_Build(benchmark::State &state) {
+  vector<STBox> boxes = make_boxes(state.range(0), 1);
+  for (auto _ : state) benchmark::DoNotOptimize(RTree(boxes));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RTree_Build)->Arg(1 << 14)->Arg(1 << 18);
+
+static void BM_RTree_Window(benchmark::State &state) {
+  vector<STBox> boxes = make_boxes(state.range(0), 1);
+  vector<STBox> windows = make_windows(64);
+  RTree tree(boxes);
+  size_t found = 0;
+  for (auto _ : state) {
+    for (STBox const &window : windows) found += tree.window(window).size();
+  }
+  benchmark::DoNotOptimize(found);
+  state.SetItemsProcessed(state.iterations() * windows.size());
+}
+BENCHMARK(BM_RTree_Window)->Arg(1 << 14)->Arg(1 << 18);
+
+static void BM_LinearScan_Window(benchmark::State &state) {
+  vector<STBox> boxes = make_boxes(state.range(0), 1);
+  vector<STBox> windows = make_windows(64);
+  size_t found = 0;
+  for (auto _ : state) {
+    for (STBox const &window : windows) {
+      for (STBox const &box : boxes) found += box.overlaps(window);
+    }
+  }
+  benchmark::DoNotOptimize(found);
+  state.SetItemsProcessed(state.iterations() * windows.size());
+}
+BENCHMARK(BM_LinearScan_Window)->Arg(1 << 14)->Arg(1 << 18);
+
+static void BM_RTree_Nearest(benchmark::State &state) {
+  vector<STBox> boxes = make_boxes(state.range(0), 1);
+  vector<STBox> windows = make_windows(64);
+  RTree tree(boxes);
+  for (auto _ : state) {
+    for (STBox const &window : windows) benchmark::DoNotOptimize(tree.nearest(window, 10));
+  }
+  state.SetItemsProcessed(state.iterations() * windows.size());
+}
+BENCHMARK(BM_RTree_Nearest)->Arg(1 << 14)->Arg(1 << 18);
+
+static void BM_RTree_Join(benchmark::State &state) {
+  RTree tree(make_boxes(state.range(0), 1));
+  RTree other(make_boxes(state.range(0), 2));
+  for (auto _ : state) benchmark::DoNotOptimize(tree.join(other));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RTree_Join)->Arg(1 << 14)->Arg(1 << 18);
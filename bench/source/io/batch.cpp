@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/io/Serializer.hpp>
+#include <meos/io/batch.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+size_t const num_temporals = 1000;
+size_t const instants_per_temporal = 100;
+
+/**
+ * Sequences of 100 instants each, the i-th one shifted by i minutes.
+ */
+template <typename T> vector<unique_ptr<Temporal<T>>> make_batch() {
+  TSequence<T> const sequence = make_temporal<TSequence, T>(instants_per_temporal);
+  vector<unique_ptr<Temporal<T>>> temporals;
+  temporals.reserve(num_temporals);
+  for (size_t i = 0; i < num_temporals; i++) {
+    temporals.push_back(sequence.shift(duration_ms(60 * 1000 * i)));
+  }
+  return temporals;
+}
+
+template <typename T>
+vector<Temporal<T> const *> pointers(vector<unique_ptr<Temporal<T>>> const &temporals) {
+  vector<Temporal<T> const *> result;
+  for (auto const &temporal : temporals) result.push_back(temporal.get());
+  return result;
+}
+
+void thread_counts(benchmark::internal::Benchmark *b) {
+  for (int num_threads : {1, 2, 4, 8}) b->Arg(num_threads);
+  b->UseRealTime();
+}
+
+}  // namespace
+
+template <typename T> static void BM_Batch_Read(benchmark::State &state) {
+  vector<string> const serialized = write_temporals(pointers(make_batch<T>()));
+  for (auto _ : state) benchmark::DoNotOptimize(read_temporals<T>(serialized, state.range(0)));
+  state.SetItemsProcessed(state.iterations() * num_temporals);
+}
+BENCHMARK_TEMPLATE(BM_Batch_Read, float)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(BM_Batch_Read, GeomPoint)->Apply(thread_counts);
+
+template <typename T> static void BM_Batch_Write(benchmark::State &state) {
+  vector<unique_ptr<Temporal<T>>> const temporals = make_batch<T>();
+  vector<Temporal<T> const *> const batch = pointers(temporals);
+  for (auto _ : state) benchmark::DoNotOptimize(write_temporals(batch, state.range(0)));
+  state.SetItemsProcessed(state.iterations() * num_temporals);
+}
+BENCHMARK_TEMPLATE(BM_Batch_Write, float)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(BM_Batch_Write, GeomPoint)->Apply(thread_counts);
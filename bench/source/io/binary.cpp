@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/io/BinaryDeserializer.hpp>
+#include <meos/io/BinarySerializer.hpp>
+#include <meos/io/Deserializer.hpp>
+#include <meos/io/Serializer.hpp>
+#include <string>
+#include <vector>
+
+#include "../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+// Off the second, so that the text format has fractions to write too
+template <typename T> TSequence<T> make_sequence(size_t n) {
+  vector<time_point> timestamps;
+  vector<T> values;
+  timestamps.reserve(n);
+  values.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    timestamps.push_back(make_timestamp(i) + duration_ms(i % 1000));
+    values.push_back(make_value<T>(i));
+  }
+  return TSequence<T>(move(timestamps), move(values));
+}
+
+}  // namespace
+
+template <typename T> static void BM_Text_Write(benchmark::State &state) {
+  TSequence<T> sequence = make_sequence<T>(state.range(0));
+  Serializer<T> w;
+  for (auto _ : state) benchmark::DoNotOptimize(w.write(&sequence));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Text_Write, float)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Text_Write, GeomPoint)->Arg(1 << 10)->Arg(1 << 16);
+
+template <typename T> static void BM_Binary_Write(benchmark::State &state) {
+  TSequence<T> sequence = make_sequence<T>(state.range(0));
+  BinarySerializer<T> w;
+  for (auto _ : state) benchmark::DoNotOptimize(w.write(&sequence));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Binary_Write, float)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Binary_Write, GeomPoint)->Arg(1 << 10)->Arg(1 << 16);
+
+template <typename T> static void BM_Text_Read(benchmark::State &state) {
+  TSequence<T> sequence = make_sequence<T>(state.range(0));
+  string serialized = Serializer<T>().write(&sequence);
+  for (auto _ : state) benchmark::DoNotOptimize(Deserializer<T>(serialized).nextTSequence());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes"] = serialized.size();
+}
+BENCHMARK_TEMPLATE(BM_Text_Read, float)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Text_Read, GeomPoint)->Arg(1 << 10)->Arg(1 << 16);
+
+template <typename T> static void BM_Binary_Read(benchmark::State &state) {
+  TSequence<T> sequence = make_sequence<T>(state.range(0));
+  string serialized = BinarySerializer<T>().write(&sequence);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(BinaryDeserializer<T>(serialized).nextTSequence());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes"] = serialized.size();
+}
+BENCHMARK_TEMPLATE(BM_Binary_Read, float)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Binary_Read, GeomPoint)->Arg(1 << 10)->Arg(1 << 16);
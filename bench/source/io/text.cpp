@@ -0,0 +1,29 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/io/Deserializer.hpp>
+#include <meos/io/Serializer.hpp>
+#include <string>
+
+#include "../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Serializer_Write(benchmark::State &state) {
+  TemporalType<BaseType> temporal = make_temporal<TemporalType, BaseType>(state.range(0));
+  Serializer<BaseType> w;
+  for (auto _ : state) benchmark::DoNotOptimize(w.write(&temporal));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPORALS(BM_Serializer_Write);
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Deserializer_NextTemporal(benchmark::State &state) {
+  TemporalType<BaseType> temporal = make_temporal<TemporalType, BaseType>(state.range(0));
+  string serialized = Serializer<BaseType>().write(&temporal);
+  for (auto _ : state) benchmark::DoNotOptimize(Deserializer<BaseType>(serialized).nextTemporal());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes"] = serialized.size();
+}
+BENCHMARK_TEMPORALS(BM_Deserializer_NextTemporal);
@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <ctime>
+#include <iomanip>
+#include <meos/io/utils.hpp>
+#include <meos/util/serializing.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+// Timestamps a little over two hours apart, each with different milliseconds
+vector<time_point> make_scattered_timestamps(size_t n) {
+  vector<time_point> timestamps;
+  timestamps.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    timestamps.push_back(make_timestamp(0) + duration_ms(7919 * 1013 * i + i));
+  }
+  return timestamps;
+}
+
+vector<string> make_strings(size_t n) {
+  vector<string> strings;
+  strings.reserve(n);
+  for (time_point const &t : make_scattered_timestamps(n)) {
+    strings.push_back(write_ISO8601_time(t));
+  }
+  return strings;
+}
+
+// Baseline: the stream and timegm based parser the timestamps used to be read with. Only handles
+// the normalized YYYY-MM-DDThh:mm:ss.uuu+ZZZZ pattern, which is what the strings are written in.
+time_point stream_parse_ISO8601(string const &s) {
+  stringstream ss(s);
+  tm time = {};
+  char c;
+  ss >> time.tm_year >> c >> time.tm_mon >> c >> time.tm_mday >> c;
+  ss >> time.tm_hour >> c >> time.tm_min >> c >> time.tm_sec;
+  time.tm_year -= 1900;
+  time.tm_mon -= 1;
+  int millis = 0;
+  if (ss.peek() == '.') ss >> c >> millis;
+  int offset;
+  ss >> offset;
+  int tz_offset_secs = (offset / 100 * 60 + offset % 100) * 60;
+  return time_point(duration_ms((timegm(&time) - tz_offset_secs) * 1000L + millis));
+}
+
+// Baseline: the put_time and gmtime based formatter the timestamps used to be written with
+string stream_write_ISO8601_time(time_point const &t) {
+  time_t tt = chrono::system_clock::to_time_t(t);
+  stringstream ss;
+  ss << put_time(gmtime(&tt), "%FT%T");
+  auto millis = chrono::duration_cast<chrono::milliseconds>(t.time_since_epoch()).count() % 1000;
+  if (millis > 0) ss << '.' << setfill('0') << setw(3) << millis;
+  ss << "+0000";
+  return ss.str();
+}
+
+}  // namespace
+
+static void BM_Timestamp_Parse_Stream(benchmark::State &state) {
+  vector<string> strings = make_strings(state.range(0));
+  for (auto _ : state) {
+    for (string const &s : strings) benchmark::DoNotOptimize(stream_parse_ISO8601(s));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Timestamp_Parse_Stream)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_Timestamp_Parse(benchmark::State &state) {
+  vector<string> strings = make_strings(state.range(0));
+  for (auto _ : state) {
+    for (string const &s : strings) benchmark::DoNotOptimize(parse_ISO8601(s));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Timestamp_Parse)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_Timestamp_Write_Stream(benchmark::State &state) {
+  vector<time_point> timestamps = make_scattered_timestamps(state.range(0));
+  for (auto _ : state) {
+    for (time_point const &t : timestamps) benchmark::DoNotOptimize(stream_write_ISO8601_time(t));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Timestamp_Write_Stream)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_Timestamp_Write(benchmark::State &state) {
+  vector<time_point> timestamps = make_scattered_timestamps(state.range(0));
+  for (auto _ : state) {
+    for (time_point const &t : timestamps) benchmark::DoNotOptimize(write_ISO8601_time(t));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Timestamp_Write)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_Timestamp_Write_Buffer(benchmark::State &state) {
+  vector<time_point> timestamps = make_scattered_timestamps(state.range(0));
+  char buffer[32];
+  for (auto _ : state) {
+    for (time_point const &t : timestamps) {
+      benchmark::DoNotOptimize(write_ISO8601_time(t, buffer));
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Timestamp_Write_Buffer)->Arg(1 << 10)->Arg(1 << 16);
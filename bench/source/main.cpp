@@ -0,0 +1,17 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/geos.hpp>
+
+int main(int argc, char *argv[]) {
+  // global setup...
+  meos::init_geos();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+
+  // global clean-up...
+  meos::finish_geos();
+
+  return 0;
+}
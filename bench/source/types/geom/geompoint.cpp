@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <meos/types/geom/GeomPoint.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../common/allocations.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+vector<GeomPoint> make_points(size_t n) {
+  vector<GeomPoint> points;
+  points.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    points.emplace_back(static_cast<double>((i * 7919) % 1000), static_cast<double>(i), 4326);
+  }
+  return points;
+}
+
+}  // namespace
+
+static void BM_GeomPoint_Copy(benchmark::State &state) {
+  vector<GeomPoint> points = make_points(state.range(0));
+  reset_allocations();
+  for (auto _ : state) {
+    vector<GeomPoint> copy = points;
+    benchmark::DoNotOptimize(copy);
+  }
+  Allocations a = allocations();
+  state.counters["allocs"] = benchmark::Counter(a.count, benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GeomPoint_Copy)->RangeMultiplier(10)->Range(1, 1000000);
+
+static void BM_GeomPoint_Sort(benchmark::State &state) {
+  vector<GeomPoint> points = make_points(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    vector<GeomPoint> copy = points;
+    state.ResumeTiming();
+    sort(copy.begin(), copy.end());
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GeomPoint_Sort)->RangeMultiplier(10)->Range(1, 1000000);
+
+static void BM_GeomPoint_Parse(benchmark::State &state) {
+  vector<string> serialized;
+  for (GeomPoint const &point : make_points(state.range(0))) {
+    stringstream ss;
+    ss << point;
+    serialized.push_back(ss.str());
+  }
+  for (auto _ : state) {
+    for (string const &s : serialized) benchmark::DoNotOptimize(GeomPoint(s));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GeomPoint_Parse)->RangeMultiplier(10)->Range(1, 1000000);
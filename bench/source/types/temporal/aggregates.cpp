@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/types/temporal/TemporalAggregates.hpp>
+#include <memory>
+#include <vector>
+
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+size_t const num_temporals = 1000;
+size_t const instants_per_temporal = 1000;
+
+/**
+ * Sequences of 1000 instants each, the i-th one shifted by i seconds, so that
+ * most of them overlap and their instants interleave.
+ */
+template <typename T> vector<unique_ptr<Temporal<T>>> make_overlapping() {
+  TSequence<T> const sequence = make_temporal<TSequence, T>(instants_per_temporal);
+  vector<unique_ptr<Temporal<T>>> temporals;
+  temporals.reserve(num_temporals);
+  for (size_t i = 0; i < num_temporals; i++) {
+    temporals.push_back(sequence.shift(duration_ms(1000 * i + 500 * (i % 2))));
+  }
+  return temporals;
+}
+
+template <typename T>
+vector<Temporal<T> const *> pointers(vector<unique_ptr<Temporal<T>>> const &temporals) {
+  vector<Temporal<T> const *> result;
+  for (auto const &temporal : temporals) result.push_back(temporal.get());
+  return result;
+}
+
+void thread_counts(benchmark::internal::Benchmark *b) {
+  for (int num_threads : {1, 2, 4, 8}) b->Arg(num_threads);
+  b->UseRealTime();
+}
+
+}  // namespace
+
+template <typename T> static void BM_Aggregate_Count(benchmark::State &state) {
+  vector<unique_ptr<Temporal<T>>> const temporals = make_overlapping<T>();
+  vector<Temporal<T> const *> const batch = pointers(temporals);
+  for (auto _ : state) benchmark::DoNotOptimize(tcount(batch, state.range(0)));
+  state.SetItemsProcessed(state.iterations() * num_temporals * instants_per_temporal);
+}
+BENCHMARK_TEMPLATE(BM_Aggregate_Count, float)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(BM_Aggregate_Count, GeomPoint)->Apply(thread_counts);
+
+template <typename T> static void BM_Aggregate_Sum(benchmark::State &state) {
+  vector<unique_ptr<Temporal<T>>> const temporals = make_overlapping<T>();
+  vector<Temporal<T> const *> const batch = pointers(temporals);
+  for (auto _ : state) benchmark::DoNotOptimize(tsum(batch, state.range(0)));
+  state.SetItemsProcessed(state.iterations() * num_temporals * instants_per_temporal);
+}
+BENCHMARK_TEMPLATE(BM_Aggregate_Sum, int)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(BM_Aggregate_Sum, float)->Apply(thread_counts);
+
+// Linear floats cross each other, and get extra instants
+static void BM_Aggregate_Max(benchmark::State &state) {
+  vector<unique_ptr<Temporal<float>>> const temporals = make_overlapping<float>();
+  vector<Temporal<float> const *> const batch = pointers(temporals);
+  for (auto _ : state) benchmark::DoNotOptimize(tmax(batch, state.range(0)));
+  state.SetItemsProcessed(state.iterations() * num_temporals * instants_per_temporal);
+}
+BENCHMARK(BM_Aggregate_Max)->Apply(thread_counts);
+
+static void BM_Aggregate_Extent(benchmark::State &state) {
+  vector<unique_ptr<Temporal<float>>> const temporals = make_overlapping<float>();
+  vector<Temporal<float> const *> const batch = pointers(temporals);
+  for (auto _ : state) benchmark::DoNotOptimize(meos::extent(batch, state.range(0)));
+  state.SetItemsProcessed(state.iterations() * num_temporals);
+}
+BENCHMARK(BM_Aggregate_Extent)->Apply(thread_counts);
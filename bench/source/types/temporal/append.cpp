@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/types/temporal/TSequenceBuilder.hpp>
+#include <meos/types/temporal/TSequenceSetBuilder.hpp>
+#include <set>
+
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+// Baseline: rebuilding the whole sequence from its instants after each append
+static void BM_TSequence_RebuildPerAppend(benchmark::State &state) {
+  size_t const n = state.range(0);
+  for (auto _ : state) {
+    set<TInstant<float>> instants;
+    for (size_t i = 0; i < n; i++) {
+      instants.insert(instants.end(), TInstant<float>(make_value<float>(i), make_timestamp(i)));
+      benchmark::DoNotOptimize(TSequence<float>(instants, true, true));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_TSequence_RebuildPerAppend)->RangeMultiplier(10)->Range(10, 10000);
+
+static void BM_TSequenceBuilder_Append(benchmark::State &state) {
+  size_t const n = state.range(0);
+  for (auto _ : state) {
+    TSequenceBuilder<float> builder;
+    for (size_t i = 0; i < n; i++) builder.append(make_value<float>(i), make_timestamp(i));
+    benchmark::DoNotOptimize(builder.build());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_TSequenceBuilder_Append)->RangeMultiplier(10)->Range(10, 1000000);
+
+static void BM_TSequenceSetBuilder_Append(benchmark::State &state) {
+  size_t const n = state.range(0);
+  // A gap every thousand instants
+  duration_ms const max_gap(1000);
+  for (auto _ : state) {
+    TSequenceSetBuilder<float> builder(max_gap);
+    for (size_t i = 0; i < n; i++) {
+      builder.append(make_value<float>(i), make_timestamp(i + i / 1000));
+    }
+    benchmark::DoNotOptimize(builder.build());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_TSequenceSetBuilder_Append)->RangeMultiplier(10)->Range(10, 1000000);
+
+static void BM_TSequenceBuilder_Snapshot(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequenceBuilder<float> builder;
+  for (size_t i = 0; i < n; i++) builder.append(make_value<float>(i), make_timestamp(i));
+  for (auto _ : state) benchmark::DoNotOptimize(builder.snapshot());
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_TSequenceBuilder_Snapshot)->RangeMultiplier(10)->Range(10, 1000000);
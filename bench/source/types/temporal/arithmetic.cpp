@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TemporalArithmetic.hpp>
+
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+void sizes(benchmark::internal::Benchmark *b) {
+  for (int n : {1000, 100000, 1000000}) b->Arg(n);
+}
+
+}  // namespace
+
+static void BM_Arithmetic_Add(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<float> const lhs = make_sensor(n, 0);
+  TSequence<float> const rhs = make_sensor(n, 1000);
+  for (auto _ : state) benchmark::DoNotOptimize(lhs + rhs);
+  state.SetItemsProcessed(state.iterations() * 2 * n);
+}
+BENCHMARK(BM_Arithmetic_Add)->Apply(sizes);
+
+// Most segments of the product turn, and get an extra instant
+static void BM_Arithmetic_Multiply(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<float> const lhs = make_sensor(n, 0);
+  TSequence<float> const rhs = make_sensor(n, 1000);
+  for (auto _ : state) benchmark::DoNotOptimize(lhs * rhs);
+  state.SetItemsProcessed(state.iterations() * 2 * n);
+}
+BENCHMARK(BM_Arithmetic_Multiply)->Apply(sizes);
+
+static void BM_Arithmetic_Scalar(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<float> const seq = make_sensor(n, 0);
+  for (auto _ : state) benchmark::DoNotOptimize(seq * 1.5f);
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Arithmetic_Scalar)->Apply(sizes);
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/io/Serializer.hpp>
+#include <meos/types/temporal/TemporalBuilder.hpp>
+#include <set>
+#include <string>
+
+#include "../../common/allocations.hpp"
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+void report_allocations(benchmark::State &state, size_t count) {
+  state.counters["allocs"] = benchmark::Counter(count, benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace
+
+// Baseline: collecting the instants in a std::set first
+static void BM_InstantSet_BuildSequence(benchmark::State &state) {
+  size_t const n = state.range(0);
+  reset_allocations();
+  for (auto _ : state) {
+    set<TInstant<float>> instants;
+    for (size_t i = 0; i < n; i++) {
+      instants.insert(instants.end(), TInstant<float>(make_value<float>(i), make_timestamp(i)));
+    }
+    benchmark::DoNotOptimize(TSequence<float>(instants));
+  }
+  report_allocations(state, allocations().count);
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_InstantSet_BuildSequence)->RangeMultiplier(10)->Range(10, 1000000);
+
+static void BM_TemporalBuilder_BuildSequence(benchmark::State &state) {
+  size_t const n = state.range(0);
+  reset_allocations();
+  for (auto _ : state) {
+    TemporalBuilder<float> builder(n);
+    for (size_t i = 0; i < n; i++) builder.add(make_value<float>(i), make_timestamp(i));
+    benchmark::DoNotOptimize(builder.buildSequence());
+  }
+  report_allocations(state, allocations().count);
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_TemporalBuilder_BuildSequence)->RangeMultiplier(10)->Range(10, 1000000);
+
+static void BM_TSequenceSet_CopySequences(benchmark::State &state) {
+  set<TSequence<float>> sequences = make_sequences<float>(state.range(0));
+  size_t count = 0;
+  for (auto _ : state) {
+    reset_allocations();
+    TSequenceSet<float> sequence_set(sequences);
+    count += allocations().count;
+    benchmark::DoNotOptimize(sequence_set);
+  }
+  report_allocations(state, count);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TSequenceSet_CopySequences)->RangeMultiplier(10)->Range(10, 1000000);
+
+static void BM_TSequenceSet_MoveSequences(benchmark::State &state) {
+  set<TSequence<float>> sequences = make_sequences<float>(state.range(0));
+  size_t count = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    set<TSequence<float>> copy = sequences;
+    state.ResumeTiming();
+    reset_allocations();
+    TSequenceSet<float> sequence_set(move(copy));
+    count += allocations().count;
+    benchmark::DoNotOptimize(sequence_set);
+  }
+  report_allocations(state, count);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TSequenceSet_MoveSequences)->RangeMultiplier(10)->Range(10, 1000000);
+
+template <template <typename> class TemporalType>
+static void BM_ConstructFromString_Allocations(benchmark::State &state) {
+  TemporalType<float> temporal = make_temporal<TemporalType, float>(state.range(0));
+  string serialized = Serializer<float>().write(&temporal);
+  reset_allocations();
+  for (auto _ : state) benchmark::DoNotOptimize(TemporalType<float>(serialized));
+  report_allocations(state, allocations().count);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ConstructFromString_Allocations, TInstantSet)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_ConstructFromString_Allocations, TSequence)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_ConstructFromString_Allocations, TSequenceSet)->Arg(1000)->Arg(100000);
@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TemporalComparison.hpp>
+
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+void sizes(benchmark::internal::Benchmark *b) {
+  for (int n : {1000, 100000, 1000000}) b->Arg(n);
+}
+
+}  // namespace
+
+// Most segments cross the threshold, and get an extra instant
+static void BM_Comparison_Scalar(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<float> const seq = make_sensor(n, 0);
+  for (auto _ : state) benchmark::DoNotOptimize(tgt(seq, 0.0f));
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Comparison_Scalar)->Apply(sizes);
+
+// Above all the values, answered from the bounding box
+static void BM_Comparison_ScalarOutside(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<float> const seq = make_sensor(n, 0);
+  for (auto _ : state) benchmark::DoNotOptimize(tgt(seq, 1000.0f));
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Comparison_ScalarOutside)->Apply(sizes);
+
+static void BM_Comparison_Temporal(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<float> const lhs = make_sensor(n, 0);
+  TSequence<float> const rhs = make_sensor(n, 1000);
+  for (auto _ : state) benchmark::DoNotOptimize(tlt(lhs, rhs));
+  state.SetItemsProcessed(state.iterations() * 2 * n);
+}
+BENCHMARK(BM_Comparison_Temporal)->Apply(sizes);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <set>
+#include <vector>
+
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+// Power readings sampled irregularly, 1 to 10 seconds apart, in kW
+TSequence<float> make_meter(size_t n, Interpolation interpolation) {
+  vector<time_point> timestamps;
+  vector<float> values;
+  timestamps.reserve(n);
+  values.reserve(n);
+  long t = 0;
+  for (size_t i = 0; i < n; i++) {
+    timestamps.push_back(make_timestamp(0) + duration_ms(t));
+    values.push_back(static_cast<float>((i * 7919) % 1000) / 100);
+    t += 1000 * (1 + (i * 31) % 10);
+  }
+  return TSequence<float>(move(timestamps), move(values), true, true, interpolation);
+}
+
+void sizes(benchmark::internal::Benchmark *b) {
+  for (int n : {1000, 100000, 1000000}) b->Arg(n);
+}
+
+}  // namespace
+
+static void BM_Integral_Linear(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<float> const meter = make_meter(n, Interpolation::Linear);
+  for (auto _ : state) benchmark::DoNotOptimize(meter.twAvg());
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Integral_Linear)->Apply(sizes);
+
+static void BM_Integral_Stepwise(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<float> const meter = make_meter(n, Interpolation::Stepwise);
+  for (auto _ : state) benchmark::DoNotOptimize(meter.twAvg());
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Integral_Stepwise)->Apply(sizes);
+
+// The same readings, split into sequences of 1000 instants each
+static void BM_Integral_SequenceSet(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<float> const meter = make_meter(n, Interpolation::Linear);
+  set<TSequence<float>> sequences;
+  SharedVector<time_point> const &timestamps = meter.storedTimestamps();
+  SharedVector<float> const &values = meter.storedValues();
+  for (size_t i = 0; i < n; i += 1000) {
+    size_t const end = min(i + 1000, n);
+    sequences.emplace(vector<time_point>(timestamps.begin() + i, timestamps.begin() + end),
+                      vector<float>(values.begin() + i, values.begin() + end), true, false);
+  }
+  TSequenceSet<float> const sset(move(sequences), Interpolation::Linear);
+  for (auto _ : state) benchmark::DoNotOptimize(sset.twAvg());
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Integral_SequenceSet)->Apply(sizes);
+
+static void BM_Integral_Centroid(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<GeomPoint> const trajectory = make_trajectory(n);
+  for (auto _ : state) benchmark::DoNotOptimize(trajectory.twCentroid());
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Integral_Centroid)->Apply(sizes);
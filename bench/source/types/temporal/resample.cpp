@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/types/temporal/TSequence.hpp>
+#include <vector>
+
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+// One instant every 10 seconds
+TSequence<float> make_sequence(size_t n) {
+  vector<time_point> timestamps;
+  vector<float> values;
+  timestamps.reserve(n);
+  values.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    timestamps.push_back(make_timestamp(10 * i));
+    values.push_back(static_cast<float>((i * 7919) % 1000));
+  }
+  return TSequence<float>(move(timestamps), move(values), true, true);
+}
+
+// One timestamp every second, over the whole sequence
+vector<time_point> make_rate(size_t n) { return make_timestamps(10 * (n - 1)); }
+
+}  // namespace
+
+static void BM_Resample_ValueAtTimestamp(benchmark::State &state) {
+  TSequence<float> sequence = make_sequence(state.range(0));
+  vector<time_point> timestamps = make_rate(state.range(0));
+  for (auto _ : state) {
+    for (time_point const &t : timestamps) benchmark::DoNotOptimize(sequence.valueAtTimestamp(t));
+  }
+  state.SetItemsProcessed(state.iterations() * timestamps.size());
+}
+BENCHMARK(BM_Resample_ValueAtTimestamp)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_Resample_ValuesAtTimestamps(benchmark::State &state) {
+  TSequence<float> sequence = make_sequence(state.range(0));
+  vector<time_point> timestamps = make_rate(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(sequence.valuesAtTimestamps(timestamps));
+  state.SetItemsProcessed(state.iterations() * timestamps.size());
+}
+BENCHMARK(BM_Resample_ValuesAtTimestamps)->Arg(1 << 10)->Arg(1 << 16);
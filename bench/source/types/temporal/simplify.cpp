@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <meos/types/temporal/TSequence.hpp>
+#include <vector>
+
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+// Speed sensor reading every second, in m/s
+TSequence<float> make_speeds(size_t n) {
+  vector<time_point> timestamps;
+  vector<float> values;
+  timestamps.reserve(n);
+  values.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    timestamps.push_back(make_timestamp(i));
+    values.push_back(static_cast<float>(10 + 5 * sin(static_cast<double>(i) / 60)
+                                        + static_cast<double>((i * 7919) % 100) / 100));
+  }
+  return TSequence<float>(move(timestamps), move(values), true, true);
+}
+
+template <typename Simplify>
+void run(benchmark::State &state, size_t n, size_t &kept, Simplify const &simplify) {
+  for (auto _ : state) {
+    auto const simplified = simplify();
+    kept = simplified.numInstants();
+    benchmark::DoNotOptimize(simplified);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+  state.counters["removed"] = static_cast<double>(n - kept) / n;
+}
+
+void sizes(benchmark::internal::Benchmark *b) {
+  for (int n : {1000, 100000, 1000000}) b->Arg(n);
+}
+
+}  // namespace
+
+static void BM_Simplify_Spatial(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<GeomPoint> const trajectory = make_trajectory(n);
+  size_t kept = 0;
+  run(state, n, kept, [&] { return trajectory.simplify(2); });
+}
+BENCHMARK(BM_Simplify_Spatial)->Apply(sizes);
+
+static void BM_Simplify_Synchronized(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<GeomPoint> const trajectory = make_trajectory(n);
+  size_t kept = 0;
+  run(state, n, kept, [&] { return trajectory.simplify(2, true); });
+}
+BENCHMARK(BM_Simplify_Synchronized)->Apply(sizes);
+
+static void BM_Simplify_Values(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<float> const speeds = make_speeds(n);
+  size_t kept = 0;
+  run(state, n, kept, [&] { return speeds.simplify(1); });
+}
+BENCHMARK(BM_Simplify_Values)->Apply(sizes);
+
+static void BM_Simplify_MaxSpeed(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<float> const speeds = make_speeds(n);
+  size_t kept = 0;
+  run(state, n, kept, [&] { return speeds.simplifyMaxSpeed(0.5); });
+}
+BENCHMARK(BM_Simplify_MaxSpeed)->Apply(sizes);
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <set>
+#include <vector>
+
+#include "../../common/allocations.hpp"
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+vector<float> make_values(size_t n) {
+  vector<float> values;
+  values.reserve(n);
+  for (size_t i = 0; i < n; i++) values.push_back(static_cast<float>((i * 7919) % 1000));
+  return values;
+}
+
+void report_allocations(benchmark::State &state) {
+  Allocations a = allocations();
+  state.counters["allocs"] = benchmark::Counter(a.count, benchmark::Counter::kAvgIterations);
+  state.counters["bytes"] = benchmark::Counter(a.bytes, benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace
+
+// Baseline: the node-per-instant std::set<TInstant> layout the instants used to be stored in
+static void BM_StdSetLayout_Construct(benchmark::State &state) {
+  size_t const n = state.range(0);
+  vector<time_point> timestamps = make_timestamps(n);
+  vector<float> values = make_values(n);
+  reset_allocations();
+  for (auto _ : state) {
+    set<TInstant<float>> instants;
+    for (size_t i = 0; i < n; i++) instants.insert(instants.end(), {values[i], timestamps[i]});
+    benchmark::DoNotOptimize(instants);
+  }
+  report_allocations(state);
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_StdSetLayout_Construct)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_TInstantSet_Construct(benchmark::State &state) {
+  size_t const n = state.range(0);
+  vector<time_point> timestamps = make_timestamps(n);
+  vector<float> values = make_values(n);
+  reset_allocations();
+  for (auto _ : state) {
+    TInstantSet<float> instant_set(timestamps, values);
+    benchmark::DoNotOptimize(instant_set);
+  }
+  report_allocations(state);
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_TInstantSet_Construct)->RangeMultiplier(10)->Range(10, 100000);
+
+// Baseline: scanning for the value bounds over the std::set<TInstant> layout
+static void BM_StdSetLayout_Iterate(benchmark::State &state) {
+  size_t const n = state.range(0);
+  set<TInstant<float>> instants = make_instants<float>(n);
+  for (auto _ : state) {
+    float min = instants.begin()->getValue();
+    float max = min;
+    for (auto const &e : instants) {
+      if (e.getValue() < min) min = e.getValue();
+      if (e.getValue() > max) max = e.getValue();
+    }
+    benchmark::DoNotOptimize(min);
+    benchmark::DoNotOptimize(max);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_StdSetLayout_Iterate)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_TSequence_Iterate(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<float> sequence(make_timestamps(n), make_values(n));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sequence.getValues());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_TSequence_Iterate)->RangeMultiplier(10)->Range(10, 100000);
@@ -0,0 +1,175 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/io/Serializer.hpp>
+#include <set>
+#include <sstream>
+#include <string>
+
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+template <typename BaseType> static void BM_TInstantSet_ConstructFromSet(benchmark::State &state) {
+  set<TInstant<BaseType>> instants = make_instants<BaseType>(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(TInstantSet<BaseType>(instants));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_TInstantSet_ConstructFromSet, bool)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TInstantSet_ConstructFromSet, int)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TInstantSet_ConstructFromSet, float)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TInstantSet_ConstructFromSet, string)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TInstantSet_ConstructFromSet, GeomPoint)->Apply(instant_counts);
+
+template <typename BaseType> static void BM_TSequence_ConstructFromSet(benchmark::State &state) {
+  set<TInstant<BaseType>> instants = make_instants<BaseType>(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(TSequence<BaseType>(instants, true, true));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_TSequence_ConstructFromSet, bool)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TSequence_ConstructFromSet, int)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TSequence_ConstructFromSet, float)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TSequence_ConstructFromSet, string)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TSequence_ConstructFromSet, GeomPoint)->Apply(instant_counts);
+
+template <typename BaseType>
+static void BM_TSequenceSet_ConstructFromSet(benchmark::State &state) {
+  set<TSequence<BaseType>> sequences = make_sequences<BaseType>(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(TSequenceSet<BaseType>(sequences));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_TSequenceSet_ConstructFromSet, bool)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TSequenceSet_ConstructFromSet, int)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TSequenceSet_ConstructFromSet, float)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TSequenceSet_ConstructFromSet, string)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TSequenceSet_ConstructFromSet, GeomPoint)->Apply(instant_counts);
+
+template <typename BaseType>
+static void BM_TInstantSet_ConstructFromStrings(benchmark::State &state) {
+  set<string> instants = make_serialized_instants<BaseType>(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(TInstantSet<BaseType>(instants));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_TInstantSet_ConstructFromStrings, bool)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TInstantSet_ConstructFromStrings, int)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TInstantSet_ConstructFromStrings, float)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TInstantSet_ConstructFromStrings, string)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TInstantSet_ConstructFromStrings, GeomPoint)->Apply(instant_counts);
+
+template <typename BaseType>
+static void BM_TSequence_ConstructFromStrings(benchmark::State &state) {
+  set<string> instants = make_serialized_instants<BaseType>(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(TSequence<BaseType>(instants, true, true));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_TSequence_ConstructFromStrings, bool)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TSequence_ConstructFromStrings, int)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TSequence_ConstructFromStrings, float)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TSequence_ConstructFromStrings, string)->Apply(instant_counts);
+BENCHMARK_TEMPLATE(BM_TSequence_ConstructFromStrings, GeomPoint)->Apply(instant_counts);
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Temporal_ConstructFromString(benchmark::State &state) {
+  TemporalType<BaseType> temporal = make_temporal<TemporalType, BaseType>(state.range(0));
+  string serialized = Serializer<BaseType>().write(&temporal);
+  for (auto _ : state) benchmark::DoNotOptimize(TemporalType<BaseType>(serialized));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes"] = serialized.size();
+}
+BENCHMARK_TEMPORALS(BM_Temporal_ConstructFromString);
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Temporal_StartTimestamp(benchmark::State &state) {
+  TemporalType<BaseType> temporal = make_temporal<TemporalType, BaseType>(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(temporal.startTimestamp());
+}
+BENCHMARK_TEMPORALS(BM_Temporal_StartTimestamp);
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Temporal_InstantN(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TemporalType<BaseType> temporal = make_temporal<TemporalType, BaseType>(n);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(temporal.instantN(i));
+    i = (i + 7919) % n;
+  }
+}
+BENCHMARK_TEMPORALS(BM_Temporal_InstantN);
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Temporal_Compare(benchmark::State &state) {
+  // Equal values, so that every instant is compared
+  TemporalType<BaseType> lhs = make_temporal<TemporalType, BaseType>(state.range(0));
+  TemporalType<BaseType> rhs = make_temporal<TemporalType, BaseType>(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(lhs.compare(rhs));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPORALS(BM_Temporal_Compare);
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Temporal_Hash(benchmark::State &state) {
+  TemporalType<BaseType> temporal = make_temporal<TemporalType, BaseType>(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(hash<TemporalType<BaseType>>()(temporal));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPORALS(BM_Temporal_Hash);
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Temporal_HashString(benchmark::State &state) {
+  // What pymeos used to hash: the serialized value
+  TemporalType<BaseType> temporal = make_temporal<TemporalType, BaseType>(state.range(0));
+  for (auto _ : state) {
+    stringstream ss;
+    ss << temporal;
+    benchmark::DoNotOptimize(hash<string>()(ss.str()));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE2(BM_Temporal_HashString, TSequence, float)->Apply(instant_counts);
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Temporal_Shift(benchmark::State &state) {
+  TemporalType<BaseType> temporal = make_temporal<TemporalType, BaseType>(state.range(0));
+  duration_ms const day(24 * 60 * 60 * 1000L);
+  for (auto _ : state) benchmark::DoNotOptimize(temporal.shift(day));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPORALS(BM_Temporal_Shift);
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Temporal_GetTime(benchmark::State &state) {
+  TemporalType<BaseType> temporal = make_temporal<TemporalType, BaseType>(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(temporal.getTime());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPORALS(BM_Temporal_GetTime);
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Temporal_IntersectsPeriodSet(benchmark::State &state) {
+  TemporalType<BaseType> temporal = make_temporal<TemporalType, BaseType>(state.range(0));
+  // Shifted past the last instant, so that the answer is false
+  PeriodSet periodset
+      = *make_alternating_periods(state.range(0)).shift(duration_ms(1000 * state.range(0)));
+  for (auto _ : state) benchmark::DoNotOptimize(temporal.intersectsPeriodSet(periodset));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPORALS(BM_Temporal_IntersectsPeriodSet);
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Temporal_AtPeriodSet(benchmark::State &state) {
+  TemporalType<BaseType> temporal = make_temporal<TemporalType, BaseType>(state.range(0));
+  PeriodSet periodset = make_alternating_periods(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(temporal.atPeriodSet(periodset));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPORALS(BM_Temporal_AtPeriodSet);
+
+template <template <typename> class TemporalType, typename BaseType>
+static void BM_Temporal_MinusPeriodSet(benchmark::State &state) {
+  TemporalType<BaseType> temporal = make_temporal<TemporalType, BaseType>(state.range(0));
+  PeriodSet periodset = make_alternating_periods(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(temporal.minusPeriodSet(periodset));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPORALS(BM_Temporal_MinusPeriodSet);
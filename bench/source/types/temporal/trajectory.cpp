@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <vector>
+
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+void sizes(benchmark::internal::Benchmark *b) {
+  for (int n : {1000, 100000, 1000000}) b->Arg(n);
+}
+
+}  // namespace
+
+static void BM_Trajectory_Length(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<GeomPoint> const trajectory = make_trajectory(n, true);
+  for (auto _ : state) benchmark::DoNotOptimize(trajectory.length());
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Trajectory_Length)->Apply(sizes);
+
+static void BM_Trajectory_CumulativeLength(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<GeomPoint> const trajectory = make_trajectory(n, true);
+  for (auto _ : state) benchmark::DoNotOptimize(trajectory.cumulativeLength());
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Trajectory_CumulativeLength)->Apply(sizes);
+
+static void BM_Trajectory_Speed(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<GeomPoint> const trajectory = make_trajectory(n, true);
+  for (auto _ : state) benchmark::DoNotOptimize(trajectory.speed());
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Trajectory_Speed)->Apply(sizes);
+
+static void BM_Trajectory_Azimuth(benchmark::State &state) {
+  size_t const n = state.range(0);
+  TSequence<GeomPoint> const trajectory = make_trajectory(n, true);
+  for (auto _ : state) benchmark::DoNotOptimize(trajectory.azimuth());
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Trajectory_Azimuth)->Apply(sizes);
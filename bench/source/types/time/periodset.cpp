@@ -0,0 +1,159 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <meos/types/time/PeriodSet.hpp>
+#include <set>
+#include <vector>
+
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+// Hour long periods, one every two hours. The offset lets two sets partially overlap.
+set<Period> make_periods(size_t n, duration_ms offset = duration_ms(0)) {
+  set<Period> periods;
+  for (size_t i = 0; i < n; i++) {
+    time_point const lower = make_timestamp(2 * 3600 * i) + offset;
+    periods.insert(periods.end(), Period(lower, lower + duration_ms(3600 * 1000L)));
+  }
+  return periods;
+}
+
+set<unique_ptr<Period>> make_period_pointers(size_t n) {
+  set<unique_ptr<Period>> periods;
+  for (Period period : make_periods(n)) periods.insert(period.clone());
+  return periods;
+}
+
+vector<time_point> make_queries(size_t n) {
+  vector<time_point> queries;
+  for (size_t i = 0; i < 1024; i++) {
+    queries.push_back(make_timestamp((i * 7919 % (2 * n)) * 3600 + 1));
+  }
+  return queries;
+}
+
+}  // namespace
+
+// Baseline: the std::set<std::unique_ptr<Period>> layout the periods used to be stored in
+static void BM_PointerSetLayout_Construct(benchmark::State &state) {
+  set<Period> const periods = make_periods(state.range(0));
+  for (auto _ : state) {
+    set<unique_ptr<Period>> pointers;
+    for (Period period : periods) pointers.insert(period.clone());
+    benchmark::DoNotOptimize(pointers);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PointerSetLayout_Construct)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_PeriodSet_Construct(benchmark::State &state) {
+  set<Period> const periods = make_periods(state.range(0));
+  for (auto _ : state) {
+    PeriodSet period_set(periods);
+    benchmark::DoNotOptimize(period_set);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PeriodSet_Construct)->RangeMultiplier(10)->Range(10, 100000);
+
+// Baseline: scanning the pointers, which are ordered by address rather than by time
+static void BM_PointerSetLayout_ContainsTimestamp(benchmark::State &state) {
+  set<unique_ptr<Period>> const periods = make_period_pointers(state.range(0));
+  vector<time_point> const queries = make_queries(state.range(0));
+  for (auto _ : state) {
+    size_t found = 0;
+    for (time_point const &t : queries) {
+      for (auto const &period : periods) {
+        if (period->contains_timestamp(t)) {
+          found++;
+          break;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK(BM_PointerSetLayout_ContainsTimestamp)->RangeMultiplier(10)->Range(10, 10000);
+
+static void BM_PeriodSet_ContainsTimestamp(benchmark::State &state) {
+  PeriodSet const period_set(make_periods(state.range(0)));
+  vector<time_point> const queries = make_queries(state.range(0));
+  for (auto _ : state) {
+    size_t found = 0;
+    for (time_point const &t : queries) found += period_set.contains_timestamp(t);
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK(BM_PeriodSet_ContainsTimestamp)->RangeMultiplier(10)->Range(10, 100000);
+
+// Baseline: periodN() used to copy the periods into a std::set<Period> first
+static void BM_PointerSetLayout_PeriodN(benchmark::State &state) {
+  set<unique_ptr<Period>> const periods = make_period_pointers(state.range(0));
+  for (auto _ : state) {
+    set<Period> s;
+    for (auto const &e : periods) s.insert(*e);
+    benchmark::DoNotOptimize(*next(s.begin(), s.size() / 2));
+  }
+}
+BENCHMARK(BM_PointerSetLayout_PeriodN)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_PeriodSet_PeriodN(benchmark::State &state) {
+  PeriodSet const period_set(make_periods(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(period_set.periodN(period_set.numPeriods() / 2));
+  }
+}
+BENCHMARK(BM_PeriodSet_PeriodN)->RangeMultiplier(10)->Range(10, 100000);
+
+// Baseline: putting the periods of both sets together and normalizing them from scratch
+static void BM_PointerSetLayout_Union(benchmark::State &state) {
+  PeriodSet const lhs(make_periods(state.range(0)));
+  PeriodSet const rhs(make_periods(state.range(0), duration_ms(1800 * 1000L)));
+  for (auto _ : state) {
+    set<Period> periods = lhs.periods();
+    for (Period const &period : rhs.periods()) periods.insert(period);
+    PeriodSet result(periods);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_PointerSetLayout_Union)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_PeriodSet_Union(benchmark::State &state) {
+  PeriodSet const lhs(make_periods(state.range(0)));
+  PeriodSet const rhs(make_periods(state.range(0), duration_ms(1800 * 1000L)));
+  for (auto _ : state) {
+    PeriodSet result = lhs.union_(rhs);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_PeriodSet_Union)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_PeriodSet_Intersection(benchmark::State &state) {
+  PeriodSet const lhs(make_periods(state.range(0)));
+  PeriodSet const rhs(make_periods(state.range(0), duration_ms(1800 * 1000L)));
+  for (auto _ : state) {
+    PeriodSet result = lhs.intersection(rhs);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_PeriodSet_Intersection)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_PeriodSet_Minus(benchmark::State &state) {
+  PeriodSet const lhs(make_periods(state.range(0)));
+  PeriodSet const rhs(make_periods(state.range(0), duration_ms(1800 * 1000L)));
+  for (auto _ : state) {
+    PeriodSet result = lhs.minus(rhs);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_PeriodSet_Minus)->RangeMultiplier(10)->Range(10, 100000);
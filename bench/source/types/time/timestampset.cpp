@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <iterator>
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/time/TimestampSet.hpp>
+#include <set>
+#include <vector>
+
+#include "../../common/generators.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+// make_timestamps() as a set, for the std::set<time_point> layout and TimestampSet
+set<time_point> make_timestamp_set(size_t n, size_t step, size_t offset = 0) {
+  vector<time_point> const timestamps = make_timestamps(n, step, offset);
+  return set<time_point>(timestamps.begin(), timestamps.end());
+}
+
+}  // namespace
+
+// Baseline: looking up the timestamps one by one in the std::set<time_point> layout
+static void BM_StdSetLayout_ContainsTimestamps(benchmark::State &state) {
+  set<time_point> const timestamps = make_timestamp_set(state.range(0), 2);
+  vector<time_point> const queries = make_timestamps(state.range(0), 3);
+  for (auto _ : state) {
+    vector<bool> result(queries.size());
+    for (size_t i = 0; i < queries.size(); i++) result[i] = timestamps.count(queries[i]) == 1;
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK(BM_StdSetLayout_ContainsTimestamps)->RangeMultiplier(10)->Range(10, 1000000);
+
+static void BM_TimestampSet_ContainsTimestamps(benchmark::State &state) {
+  TimestampSet const timestamp_set(make_timestamp_set(state.range(0), 2));
+  vector<time_point> const queries = make_timestamps(state.range(0), 3);
+  for (auto _ : state) {
+    vector<bool> result = timestamp_set.contains_timestamps(queries);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK(BM_TimestampSet_ContainsTimestamps)->RangeMultiplier(10)->Range(10, 1000000);
+
+// Baseline: intersectsTimestamp() called once per timestamp, as intersectsTimestampSet() used to.
+// The timestamps all fall between the instants, so every one of them is looked up.
+static void BM_PerTimestamp_IntersectsTimestampSet(benchmark::State &state) {
+  vector<time_point> const instants = make_timestamps(state.range(0), 2);
+  TInstantSet<float> const instant_set(instants, vector<float>(instants.size(), 1));
+  TimestampSet const timestamp_set(make_timestamp_set(state.range(0), 2, 1));
+  for (auto _ : state) {
+    bool intersects = false;
+    for (time_point const &t : timestamp_set.timestamps()) {
+      if (instant_set.intersectsTimestamp(t)) {
+        intersects = true;
+        break;
+      }
+    }
+    benchmark::DoNotOptimize(intersects);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PerTimestamp_IntersectsTimestampSet)->RangeMultiplier(10)->Range(10, 1000000);
+
+static void BM_TInstantSet_IntersectsTimestampSet(benchmark::State &state) {
+  vector<time_point> const instants = make_timestamps(state.range(0), 2);
+  TInstantSet<float> const instant_set(instants, vector<float>(instants.size(), 1));
+  TimestampSet const timestamp_set(make_timestamp_set(state.range(0), 2, 1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(instant_set.intersectsTimestampSet(timestamp_set));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TInstantSet_IntersectsTimestampSet)->RangeMultiplier(10)->Range(10, 1000000);
+
+// Baseline: std::set_intersection over the std::set<time_point> layout
+static void BM_StdSetLayout_Intersection(benchmark::State &state) {
+  set<time_point> const lhs = make_timestamp_set(state.range(0), 2);
+  set<time_point> const rhs = make_timestamp_set(state.range(0), 3);
+  for (auto _ : state) {
+    set<time_point> result;
+    set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                     inserter(result, result.end()));
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_StdSetLayout_Intersection)->RangeMultiplier(10)->Range(10, 1000000);
+
+static void BM_TimestampSet_Intersection(benchmark::State &state) {
+  TimestampSet const lhs(make_timestamp_set(state.range(0), 2));
+  TimestampSet const rhs(make_timestamp_set(state.range(0), 3));
+  for (auto _ : state) {
+    TimestampSet result = lhs.intersection(rhs);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_TimestampSet_Intersection)->RangeMultiplier(10)->Range(10, 1000000);
+
+// A few timestamps against many, where the merge mostly gallops
+static void BM_TimestampSet_IntersectionSkewed(benchmark::State &state) {
+  TimestampSet const lhs(make_timestamp_set(state.range(0), 1));
+  TimestampSet const rhs(make_timestamp_set(16, state.range(0) / 16 + 1));
+  for (auto _ : state) {
+    TimestampSet result = lhs.intersection(rhs);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * 16);
+}
+BENCHMARK(BM_TimestampSet_IntersectionSkewed)->RangeMultiplier(10)->Range(10, 1000000);
+
+// Queries an order of magnitude sparser than the set, where the merge skips a few values at a time
+static void BM_TimestampSet_ContainsTimestampsSparse(benchmark::State &state) {
+  TimestampSet const timestamp_set(make_timestamp_set(state.range(0), 1));
+  vector<time_point> const queries = make_timestamps(state.range(0) / 10, 10, 5);
+  for (auto _ : state) {
+    vector<bool> result = timestamp_set.contains_timestamps(queries);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK(BM_TimestampSet_ContainsTimestampsSparse)->RangeMultiplier(10)->Range(100, 1000000);
@@ -4,10 +4,43 @@
 #define GEOS_USE_ONLY_R_API
 #include <geos_c.h>
 
+#include <memory>
+
 namespace meos {
 
-extern GEOSContextHandle_t geos_context;
-extern void init_geos();
-extern void finish_geos();
+/**
+ * @brief GEOS context handle of the calling thread.
+ *
+ * GEOS context handles must not be shared across threads, so each thread gets
+ * its own. It is created on first use, and finished when the thread exits.
+ * This is what should be passed to all the GEOS _r functions.
+ */
+GEOSContextHandle_t geos_context();
+
+/**
+ * @brief Creates the GEOS context of the calling thread, if not already done.
+ *
+ * Calling this is optional, as geos_context() creates it on first use.
+ */
+void init_geos();
+
+/**
+ * @brief Finishes the GEOS context of the calling thread before it exits.
+ *
+ * A new context is created if GEOS is used again afterwards from this thread.
+ */
+void finish_geos();
+
+/**
+ * @brief Destroys GEOS geometries owned by a GEOSGeometryPtr
+ */
+struct GEOSGeometryDeleter {
+  void operator()(GEOSGeometry *geom) const;
+};
+
+/**
+ * @brief Owning pointer to a GEOS geometry
+ */
+typedef std::unique_ptr<GEOSGeometry, GEOSGeometryDeleter> GEOSGeometryPtr;
 
 }  // namespace meos
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <meos/types/box/STBox.hpp>
+#include <utility>
+#include <vector>
+
+namespace meos {
+
+/**
+ * @brief Static R-tree over STBox objects, bulk loaded with Sort-Tile-Recursive packing.
+ *
+ * Boxes are identified by their position in the vector the tree was built
+ * from, and all queries return those positions. The tree can't be modified
+ * after it is built, which lets every node be filled up to its capacity and
+ * the nodes be kept in a single contiguous array.
+ *
+ * Boxes follow the semantics of STBox::overlaps(), i.e, a missing dimension is
+ * unbounded. All boxes are expected to be in the same SRID as the queries.
+ */
+class RTree {
+public:
+  RTree(std::vector<STBox> const &boxes, size_t node_capacity = 16);
+
+  /**
+   * @brief Number of boxes indexed.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Positions of the boxes overlapping the window, in no particular order.
+   */
+  std::vector<size_t> window(STBox const &query) const;
+
+  /**
+   * @brief Positions of the k boxes nearest to the query, closest first.
+   *
+   * The distance is the Euclidean distance between the spatial dimensions of
+   * the boxes, and boxes not overlapping the query in time are never returned.
+   * Throws std::invalid_argument if the query has no spatial dimensions.
+   */
+  std::vector<size_t> nearest(STBox const &query, size_t k) const;
+
+  /**
+   * @brief Pairs of positions, here and in the other tree, of the boxes overlapping each other.
+   *
+   * Both trees are traversed together, so only overlapping nodes are ever
+   * compared to each other.
+   */
+  std::vector<std::pair<size_t, size_t>> join(RTree const &other) const;
+
+private:
+  /**
+   * @brief Bounds in a form cheaper to compare than STBox.
+   *
+   * Missing dimensions are kept as infinite (or, for time, the extreme
+   * representable) bounds, just like STBox does.
+   */
+  struct Bounds {
+    double xmin, ymin, zmin, xmax, ymax, zmax;
+    int64_t tmin, tmax;
+  };
+
+  /**
+   * @brief Entry of a node. For leaves, begin and end are positions in m_entries,
+   * else they are positions of the child nodes in m_nodes.
+   */
+  struct Node {
+    Bounds bounds;
+    size_t begin, end;
+  };
+
+  size_t m_node_capacity;
+
+  /**
+   * @brief Bounds of the boxes, and their positions in the input, in leaf order.
+   */
+  std::vector<Bounds> m_entries;
+  std::vector<size_t> m_positions;
+
+  /**
+   * @brief All nodes, level by level starting from the leaves. The root is the last one.
+   */
+  std::vector<Node> m_nodes;
+  size_t m_num_leaves = 0;
+
+  bool is_leaf(size_t node) const { return node < m_num_leaves; }
+  void build();
+};
+
+}  // namespace meos
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <meos/types/box/STBox.hpp>
+#include <meos/types/box/TBox.hpp>
+#include <meos/types/geom/GeomPoint.hpp>
+#include <meos/types/temporal/Interpolation.hpp>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/types/temporal/Temporal.hpp>
+#include <meos/types/time/Period.hpp>
+#include <meos/types/time/PeriodSet.hpp>
+#include <meos/types/time/TimestampSet.hpp>
+#include <string>
+#include <vector>
+
+namespace meos {
+
+/**
+ * @brief Reads values one after the other from a string of bytes written by
+ * BinarySerializer.
+ *
+ * Check BinarySerializer for the layout. Throws DeserializationException if
+ * the input is truncated or otherwise malformed.
+ */
+template <typename T = float> class BinaryDeserializer {
+public:
+  BinaryDeserializer(std::string const &in);
+  std::unique_ptr<Temporal<T>> nextTemporal();
+  std::unique_ptr<TSequenceSet<T>> nextTSequenceSet();
+  std::unique_ptr<TSequence<T>> nextTSequence();
+  std::unique_ptr<TInstantSet<T>> nextTInstantSet();
+  std::unique_ptr<TInstant<T>> nextTInstant();
+
+  std::unique_ptr<Period> nextPeriod();
+  std::unique_ptr<PeriodSet> nextPeriodSet();
+  std::unique_ptr<TimestampSet> nextTimestampSet();
+
+  std::unique_ptr<TBox> nextTBox();
+  std::unique_ptr<STBox> nextSTBox();
+
+  /**
+   * Deserialize time written as microseconds since 2000-01-01
+   */
+  time_point nextTime();
+
+  /**
+   * Deserialize a value on its own, as PostgreSQL sends its base type. A
+   * text takes all the bytes left.
+   */
+  T nextValue();
+
+  /**
+   * @brief Whether there are bytes left to read.
+   */
+  bool hasNext() const;
+
+private:
+  std::string const in;
+  size_t pos = 0;
+
+  /**
+   * Makes sure there are at least n more bytes to read, and returns a
+   * pointer to them, moving past them.
+   */
+  unsigned char const *take(size_t n);
+
+  uint8_t nextUInt8();
+  uint32_t nextUInt32();
+  uint64_t nextUInt64();
+  double nextDouble();
+
+  /**
+   * Reads the byte telling the duration of the following temporal, and checks
+   * that it is the expected one.
+   */
+  void consumeDuration(TemporalDuration expected);
+
+  /**
+   * Reads the number of items that follow, making sure that the input is long
+   * enough to hold them, given each takes at least min_size bytes.
+   */
+  size_t nextCount(size_t min_size);
+
+  /**
+   * Reads a value taking size bytes. Only texts need the size, the other
+   * base types know where they end.
+   */
+  T readValue(size_t size);
+
+  /**
+   * Reads a value prefixed by its length, as within instants, and checks that
+   * it takes exactly that length.
+   */
+  T readSizedValue();
+
+  void nextInstants(size_t count, std::vector<time_point> &timestamps, std::vector<T> &values);
+  TSequence<T> readTSequence();
+  Period readPeriod();
+};
+
+}  // namespace meos
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <meos/types/box/STBox.hpp>
+#include <meos/types/box/TBox.hpp>
+#include <meos/types/geom/GeomPoint.hpp>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/types/temporal/Temporal.hpp>
+#include <meos/types/time/Period.hpp>
+#include <meos/types/time/PeriodSet.hpp>
+#include <meos/types/time/TimestampSet.hpp>
+#include <string>
+
+namespace meos {
+
+/**
+ * @brief Writes values in the binary format of MobilityDB 1.0, i.e. as its
+ * send functions do, so that they can be read with its recv functions.
+ *
+ *   - Numbers are written in network byte order (big endian). Floats are
+ *     widened to 8 byte doubles, as tfloat stores them.
+ *   - Timestamps are written as microseconds since 2000-01-01, like
+ *     PostgreSQL does for timestamptz.
+ *   - Base values are written as PostgreSQL sends them: booleans as one byte,
+ *     texts as their bytes and geometries as EWKB. Within instants, they are
+ *     prefixed by their length.
+ *   - Temporals start with a byte telling their duration (1 for instants up to
+ *     4 for sequence sets). Instants are their timestamp followed by their
+ *     value. Instant sets and sequence sets are their number of instants or
+ *     sequences followed by them. Sequences are their number of instants, their
+ *     bounds and whether they are linear, followed by the instants.
+ *   - Boxes start with a byte for each dimension they have, x, (z,) t (and
+ *     geodetic), followed by the SRID for STBox and then the bounds.
+ *
+ * Use BinaryDeserializer to read the values back.
+ */
+template <typename T = float> class BinarySerializer {
+public:
+  std::string write(Temporal<T> const *temporal);
+  std::string write(TInstant<T> const *instant);
+  std::string write(TInstantSet<T> const *instant_set);
+  std::string write(TSequence<T> const *sequence);
+  std::string write(TSequenceSet<T> const *sequence_set);
+
+  std::string write(Period const *period);
+  std::string write(PeriodSet const *period_set);
+  std::string write(TimestampSet const *timestamp_set);
+
+  std::string write(TBox const *tbox);
+  std::string write(STBox const *stbox);
+
+  std::string write(T const &value);
+
+  /**
+   * Serialize time as microseconds since 2000-01-01
+   */
+  std::string writeTime(time_point const &time);
+
+private:
+  void append(std::string &out, T const &value);
+  void append(std::string &out, TInstant<T> const &instant);
+  void append(std::string &out, TInstantSet<T> const &instant_set);
+  void append(std::string &out, TSequence<T> const &sequence);
+  void append(std::string &out, TSequenceSet<T> const &sequence_set);
+  void append(std::string &out, Period const &period);
+};
+
+}  // namespace meos
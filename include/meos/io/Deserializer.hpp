@@ -2,6 +2,7 @@
 
 #include <iomanip>
 #include <meos/types/geom/GeomPoint.hpp>
+#include <meos/types/temporal/Interpolation.hpp>
 #include <meos/types/temporal/TInstant.hpp>
 #include <meos/types/temporal/TInstantSet.hpp>
 #include <meos/types/temporal/TSequence.hpp>
@@ -11,9 +12,17 @@
 #include <meos/types/time/PeriodSet.hpp>
 #include <meos/types/time/TimestampSet.hpp>
 #include <string>
+#include <vector>
 
 namespace meos {
 
+/**
+ * @brief Reads values one after the other from a string.
+ *
+ * Parsing is done in a single pass directly over the input, with a cursor
+ * pointing at the next unread character. There is no limit on how long a
+ * single value can be.
+ */
 template <typename T = float> class Deserializer {
 public:
   Deserializer(std::string const &in);
@@ -40,8 +49,37 @@ private:
   char peek(int lookahead);
   void skipWhitespaces();
   void consumeChar(char const c);
+  char consumeOneOf(char const *chars);
   void skipChars(std::string const &chars);
   bool hasNext();
+
+  /**
+   * Returns everything until one of the stop characters (or the end of the
+   * input) is reached, and moves past it. The stop character is not consumed.
+   */
+  std::string nextUntilOneOf(char const *stop_chars);
+
+  /**
+   * Reads the SRID prefix (SRID=...;) if present, else returns 0.
+   * Only geometries accept a SRID prefix.
+   */
+  int nextSRID();
+
+  /**
+   * Reads the interpolation prefix (Interp=...;) if present, else returns
+   * the default interpolation for the base type.
+   */
+  Interpolation nextInterpolation();
+
+  /**
+   * Reads comma separated instants up to (and including) one of the closing
+   * characters, which is returned. The instants are sorted before returning.
+   */
+  char nextInstants(std::vector<time_point> &timestamps, std::vector<T> &values,
+                    char const *closing, int srid);
+
+  TSequence<T> readTSequence(int srid);
+  Period readPeriod();
 };
 
 }  // namespace meos
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <meos/types/temporal/Temporal.hpp>
+#include <string>
+#include <vector>
+
+namespace meos {
+
+/**
+ * @brief Reads one temporal value from each string, on several threads.
+ *
+ * The values are returned in the same order as the strings. num_threads
+ * defaults to one per core. If any string can't be read, the first error is
+ * thrown once all the threads are done.
+ */
+template <typename T = float> std::vector<std::unique_ptr<Temporal<T>>> read_temporals(
+    std::vector<std::string> const &serialized, size_t num_threads = 0);
+
+/**
+ * @brief Writes each temporal value to a string, on several threads.
+ *
+ * The strings are returned in the same order as the values. num_threads
+ * defaults to one per core.
+ */
+template <typename T = float> std::vector<std::string> write_temporals(
+    std::vector<Temporal<T> const *> const &temporals, size_t num_threads = 0);
+
+}  // namespace meos
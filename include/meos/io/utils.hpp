@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <istream>
 #include <string>
 
 namespace meos {
@@ -10,10 +11,6 @@ using duration_ms = std::chrono::milliseconds;
 
 template <typename T> T nextValue(std::istream &in);
 
-void validate_normalized_ISO8601(const std::string &s);
-
-std::string normalized_ISO8601(std::string s);
-
 /**
  * Parse time in ISO8601 format
  * Skips initial whitespaces, reads until one of ",)]}\n" is reached, and tries
@@ -27,10 +24,23 @@ std::string normalized_ISO8601(std::string s);
  * 1234-12-12T12:12:12
  * 1234-12-12 12:12:12Z
  * 1234-12-12 12:12:12+05
- * 1234-12-12 12:12:12-0530  // normalized pattern
+ * 1234-12-12 12:12:12.123-05:30
  */
 time_point nextTime(std::istream &in);
 
+/**
+ * Parse time in ISO8601 format from a string holding just the time, possibly
+ * surrounded by whitespaces. Accepts the same patterns as nextTime.
+ */
+time_point parse_ISO8601(std::string const &s);
+
+/**
+ * Parse time in ISO8601 format from the given range of characters, without
+ * any intermediate copies. Fractions of a second beyond milliseconds are
+ * accepted but truncated.
+ */
+time_point parse_ISO8601(char const *begin, char const *end);
+
 void consume(std::istream &in, char expectedCharacter, bool skip_ws = true);
 void consume(std::istream &in, std::string expectedString, bool skip_ws = true);
 char consume_one_of(std::istream &in, std::string charSet, bool skip_ws = true);
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <chrono>
+#include <cmath>
+#include <functional>
 #include <meos/types/geom/SRIDMembers.hpp>
 #include <string>
 
 namespace meos {
 using time_point = std::chrono::system_clock::time_point;
+using duration_ms = std::chrono::milliseconds;
 
 /**
  * @brief Spatio-temporal box - bounding box with value and/or space/time dimensions.
@@ -54,6 +57,54 @@ public:
 
   bool geodetic() const;
 
+  /**
+   * @brief Do the boxes share at least one point?
+   *
+   * A dimension missing on a box is taken to be unbounded, so only the
+   * dimensions present on both boxes restrict the result. Throws
+   * std::invalid_argument if both boxes have coordinates in different SRIDs.
+   */
+  bool overlaps(STBox const &other) const;
+
+  /**
+   * @brief Does the box contain the other one?
+   * @see overlaps()
+   */
+  bool contains(STBox const &other) const;
+
+  /**
+   * @brief Do the boxes touch without their interiors overlapping?
+   *
+   * That is, they overlap, but their intersection is flat along at least one
+   * of the dimensions present on both.
+   * @see overlaps()
+   */
+  bool adjacent(STBox const &other) const;
+
+  /**
+   * @brief Box grown by the distance on every side of its spatial dimensions.
+   */
+  STBox expand(double const distance) const;
+
+  /**
+   * @brief Box grown by the interval on both sides of its time dimension.
+   */
+  STBox expand(duration_ms const interval) const;
+
+  /**
+   * @brief Smallest box containing both boxes.
+   *
+   * A dimension missing on either box is missing on the result. Named with a
+   * trailing underscore, as union is a keyword.
+   * @see overlaps()
+   */
+  STBox union_(STBox const &other) const;
+
+  /**
+   * @brief Hash consistent with ==, also available as std::hash<STBox>.
+   */
+  size_t hash() const;
+
   friend bool operator==(STBox const &lhs, STBox const &rhs);
   friend bool operator!=(STBox const &lhs, STBox const &rhs);
   friend bool operator<(STBox const &lhs, STBox const &rhs);
@@ -99,7 +150,16 @@ private:
   void init();
   void setup_defaults();
   void validate() const;
+  void ensure_same_srid(STBox const &other) const;
   int compare(STBox const &other) const;
 };
 
 }  // namespace meos
+
+namespace std {
+
+template <> struct hash<meos::STBox> {
+  size_t operator()(meos::STBox const &stbox) const { return stbox.hash(); }
+};
+
+}  // namespace std
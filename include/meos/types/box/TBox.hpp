@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <cmath>
+#include <functional>
 #include <string>
 
 namespace meos {
@@ -26,6 +27,11 @@ public:
   double xmax() const;
   time_point tmax() const;
 
+  /**
+   * @brief Hash consistent with ==, also available as std::hash<TBox>.
+   */
+  size_t hash() const;
+
   friend bool operator==(TBox const &lhs, TBox const &rhs);
   friend bool operator!=(TBox const &lhs, TBox const &rhs);
   friend bool operator<(TBox const &lhs, TBox const &rhs);
@@ -57,3 +63,11 @@ private:
 };
 
 }  // namespace meos
+
+namespace std {
+
+template <> struct hash<meos::TBox> {
+  size_t operator()(meos::TBox const &tbox) const { return tbox.hash(); }
+};
+
+}  // namespace std
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cmath>
+#include <cstddef>
+#include <functional>
 #include <meos/geos.hpp>
 #include <string>
 
@@ -8,24 +11,29 @@ namespace meos {
 /**
  * @brief A point in space
  *
- * Mostly a wrapper on top of GEOSGeometry*
- * Additionally, we allow specifying SRID, similar to how PostGIS EWKT does.
+ * Coordinates (x, y and optionally z) and the SRID are stored inline, so that
+ * copying, comparing and doing arithmetic on points never calls into GEOS.
+ * A GEOS geometry is only built on demand, through geom(), when an actual
+ * GEOS operation is needed.
  *
- * Main reason we have this is that pybind11 can't work with GEOSGeometry*
- * directly, as it is exposed as an opaque type from the GEOS C API.
+ * Additionally, we allow specifying SRID, similar to how PostGIS EWKT does.
  */
 class GeomPoint {
 public:
-  GEOSGeometry *geom = nullptr;
-
   GeomPoint();
   GeomPoint(std::string serialized);
   GeomPoint(double x, double y);
   GeomPoint(std::string serialized, int srid);
   GeomPoint(double x, double y, int srid);
-  GeomPoint(GeomPoint const &g);
-  void operator=(GeomPoint const &g);
-  ~GeomPoint();
+  GeomPoint(double x, double y, double z, int srid);
+
+  /**
+   * @brief Builds a new GEOS geometry for this point.
+   *
+   * The returned geometry is owned by the caller, and is destroyed along with
+   * the returned pointer.
+   */
+  GEOSGeometryPtr geom() const;
 
   void fromEWKB(std::istream &is);
   void toEWKB(std::ostream &os) const;
@@ -44,13 +52,37 @@ public:
 
   double x() const;
   double y() const;
+  double z() const;
+  bool has_z() const;
   int srid() const;
 
+  /**
+   * @brief Same point, but with the given SRID.
+   */
+  GeomPoint with_srid(int srid) const;
+
   GeomPoint operator+(GeomPoint const &g) const;
   GeomPoint operator-(GeomPoint const &g) const;
 
+  /**
+   * @brief Euclidean distance to the other point, in the units of the SRID.
+   *
+   * The z coordinates are only taken into account when both points have one.
+   */
+  double distance(GeomPoint const &other) const {
+    double const dx = other.m_x - this->m_x;
+    double const dy = other.m_y - this->m_y;
+    double const dz = this->m_has_z && other.m_has_z ? other.m_z - this->m_z : 0;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+  }
+
   int compare(GeomPoint const &other) const;
 
+  /**
+   * @brief Hash consistent with ==, also available as std::hash<GeomPoint>.
+   */
+  size_t hash() const;
+
   friend bool operator==(GeomPoint const &lhs, GeomPoint const &rhs);
   friend bool operator!=(GeomPoint const &lhs, GeomPoint const &rhs);
   friend bool operator<(GeomPoint const &lhs, GeomPoint const &rhs);
@@ -62,8 +94,13 @@ public:
   friend std::ostream &operator<<(std::ostream &os, GeomPoint const &g);
 
 private:
-  void point(double x, double y);
-  void free();
+  double m_x = 0;
+  double m_y = 0;
+  double m_z = 0;
+  bool m_has_z = false;
+  int m_srid = 0;
+
+  void read_wkb(unsigned char const *buf, size_t length);
 };
 
 /**
@@ -86,3 +123,11 @@ template <> struct is_geometry<GeomPoint> {
 template <typename BaseType> constexpr bool is_geometry_v = is_geometry<BaseType>::value;
 
 }  // namespace meos
+
+namespace std {
+
+template <> struct hash<meos::GeomPoint> {
+  size_t operator()(meos::GeomPoint const &point) const { return point.hash(); }
+};
+
+}  // namespace std
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <iomanip>
 #include <meos/types/geom/GeomPoint.hpp>
 #include <string>
@@ -36,6 +37,11 @@ public:
   bool overlap(Range const &p) const;
   bool contains(T const &t) const;
 
+  /**
+   * @brief Hash consistent with ==, also available as std::hash<Range<T>>.
+   */
+  size_t hash() const;
+
   friend bool operator==(Range<T> const &lhs, Range<T> const &rhs) { return lhs.compare(rhs) == 0; }
 
   friend bool operator!=(Range<T> const &lhs, Range<T> const &rhs) { return lhs.compare(rhs) != 0; }
@@ -66,3 +72,11 @@ typedef Range<std::string> RangeText;
 typedef Range<GeomPoint> RangeGeomPoint;
 
 }  // namespace meos
+
+namespace std {
+
+template <typename T> struct hash<meos::Range<T>> {
+  size_t operator()(meos::Range<T> const &range) const { return range.hash(); }
+};
+
+}  // namespace std
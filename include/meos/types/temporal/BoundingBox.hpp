@@ -0,0 +1,61 @@
+#pragma once
+
+#include <meos/types/box/STBox.hpp>
+#include <meos/types/box/TBox.hpp>
+#include <meos/types/geom/GeomPoint.hpp>
+#include <meos/types/time/Period.hpp>
+#include <meos/util/shared_vector.hpp>
+
+namespace meos {
+
+/**
+ * @brief Helps find the type of the bounding box of temporal values with the base type
+ *
+ * Numbers are bounded by a TBox and points by an STBox. Values of the other
+ * base types can't be bounded, so only the Period is kept for them, as
+ * MobilityDB does.
+ *
+ * Also check bbox_t<BaseType>, which should be more easy to use
+ */
+template <typename BaseType> struct bbox { typedef Period type; };
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <> struct bbox<int> { typedef TBox type; };
+template <> struct bbox<float> { typedef TBox type; };
+template <> struct bbox<GeomPoint> { typedef STBox type; };
+#endif
+
+/**
+ * @brief Shorthand for bbox<BaseType>::type
+ */
+template <typename BaseType> using bbox_t = typename bbox<BaseType>::type;
+
+/**
+ * @brief Bounding box of instants, given as non empty arrays sorted by timestamp.
+ *
+ * Boxes bound time inclusively, while periods take the given bounds.
+ */
+template <typename BaseType>
+bbox_t<BaseType> make_bbox(SharedVector<time_point> const &timestamps,
+                           SharedVector<BaseType> const &values, bool lower_inc = true,
+                           bool upper_inc = true);
+
+/**
+ * @brief Bounding box of a single instant.
+ */
+template <typename BaseType> bbox_t<BaseType> make_bbox(time_point t, BaseType const &value);
+
+/**
+ * @brief Smallest bounding box containing both.
+ */
+TBox bbox_union(TBox const &lhs, TBox const &rhs);
+STBox bbox_union(STBox const &lhs, STBox const &rhs);
+Period bbox_union(Period const &lhs, Period const &rhs);
+
+/**
+ * @brief Does the time dimension of the bounding box intersect the period?
+ */
+bool bbox_overlaps_period(TBox const &box, Period const &period);
+bool bbox_overlaps_period(STBox const &box, Period const &period);
+bool bbox_overlaps_period(Period const &box, Period const &period);
+
+}  // namespace meos
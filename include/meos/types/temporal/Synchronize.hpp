@@ -0,0 +1,280 @@
+#pragma once
+
+#include <meos/types/temporal/Interpolation.hpp>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/types/temporal/Temporal.hpp>
+#include <meos/types/temporal/TemporalDuration.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace meos {
+
+using time_point = std::chrono::system_clock::time_point;
+
+/**
+ * @brief Duration of the result of an operation lifted over two temporal values.
+ *
+ * Instants and instant sets only have values at their own timestamps, so
+ * combining them with anything gives values at these timestamps only. Two
+ * sequences give a sequence, as they intersect over a single period, while a
+ * sequence set gives a sequence set.
+ */
+inline TemporalDuration synchronized_duration(TemporalDuration const lhs,
+                                              TemporalDuration const rhs) {
+  if (lhs == TemporalDuration::Instant || rhs == TemporalDuration::Instant) {
+    return TemporalDuration::Instant;
+  }
+  if (lhs == TemporalDuration::InstantSet || rhs == TemporalDuration::InstantSet) {
+    return TemporalDuration::InstantSet;
+  }
+  if (lhs == TemporalDuration::SequenceSet || rhs == TemporalDuration::SequenceSet) {
+    return TemporalDuration::SequenceSet;
+  }
+  return TemporalDuration::Sequence;
+}
+
+/**
+ * @brief Brings two temporal values onto the union of their timestamps, over
+ * the time at which both are defined, and hands the pairs of values to a sink.
+ *
+ * When the result is discrete, see synchronized_duration(), this calls
+ * sink.instant(t, lhs, rhs) for each timestamp of the discrete value at which
+ * the other one is defined. Otherwise, for each period over which both are
+ * defined, in order of time, it calls:
+ *   - sink.begin(lower_inc, interpolation)
+ *   - sink.add(t, lhs, rhs) at the lower bound, at each timestamp of either
+ *     value strictly within the period, and at the upper bound
+ *   - sink.end(upper_inc)
+ *
+ * The sequences of both values are walked in a single merge, so this takes
+ * O(n + m) and doesn't allocate for the synchronised instants. Sinks can add
+ * instants of their own between the ones they are given, e.g. turning points.
+ *
+ * A linear sequence can't jump, so when only one of the values is linear, the
+ * other one is cut into constant pieces at each of its instants, and the sink
+ * is given a linear period for each of them.
+ */
+template <typename BaseType> class Synchronizer {
+public:
+  template <typename Sink>
+  static void synchronize(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs,
+                          Sink &sink) {
+    TemporalDuration const duration = synchronized_duration(lhs.duration(), rhs.duration());
+    if (duration == TemporalDuration::Instant || duration == TemporalDuration::InstantSet) {
+      bool const lhs_discrete = lhs.duration() == TemporalDuration::Instant
+                                || lhs.duration() == TemporalDuration::InstantSet;
+      if (lhs_discrete) {
+        synchronize_discrete(lhs, rhs, [&sink](time_point t, BaseType const &discrete,
+                                               BaseType const &other) {
+          sink.instant(t, discrete, other);
+        });
+      } else {
+        synchronize_discrete(rhs, lhs, [&sink](time_point t, BaseType const &discrete,
+                                               BaseType const &other) {
+          sink.instant(t, other, discrete);
+        });
+      }
+      return;
+    }
+
+    std::vector<Run> lhs_runs = runs(lhs);
+    std::vector<Run> rhs_runs = runs(rhs);
+    Interpolation const lhs_interpolation = lhs_runs.front().interpolation;
+    Interpolation const rhs_interpolation = rhs_runs.front().interpolation;
+    if (lhs_interpolation != rhs_interpolation) {
+      if (lhs_interpolation == Interpolation::Stepwise) lhs_runs = constant_runs(lhs_runs);
+      if (rhs_interpolation == Interpolation::Stepwise) rhs_runs = constant_runs(rhs_runs);
+    }
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < lhs_runs.size() && j < rhs_runs.size()) {
+      Run const &a = lhs_runs[i];
+      Run const &b = rhs_runs[j];
+      synchronize_runs(a, b, sink);
+
+      // Move past the run ending first. When both end together, the one
+      // including its end could still meet the next run of the other.
+      time_point const a_end = a.timestamps[a.size - 1];
+      time_point const b_end = b.timestamps[b.size - 1];
+      if (a_end < b_end || (a_end == b_end && !a.upper_inc && b.upper_inc)) {
+        i++;
+      } else if (b_end < a_end || (a_end == b_end && a.upper_inc && !b.upper_inc)) {
+        j++;
+      } else {
+        i++;
+        j++;
+      }
+    }
+  }
+
+private:
+  /**
+   * @brief A sequence, pointing into its stored instants.
+   *
+   * Constant runs hold their first value until their end, as the pieces of a
+   * stepwise sequence made linear.
+   */
+  struct Run {
+    time_point const *timestamps;
+    BaseType const *values;
+    size_t size;
+    bool lower_inc;
+    bool upper_inc;
+    Interpolation interpolation;
+    bool constant;
+  };
+
+  static BaseType interpolate(BaseType const &from, BaseType const &, double) { return from; }
+
+  static Run sequence_run(TSequence<BaseType> const &sequence) {
+    return {sequence.storedTimestamps().data(),
+            sequence.storedValues().data(),
+            sequence.storedTimestamps().size(),
+            sequence.lower_inc(),
+            sequence.upper_inc(),
+            sequence.interpolation(),
+            false};
+  }
+
+  /**
+   * @brief Runs of a sequence or sequence set, in order of time.
+   */
+  static std::vector<Run> runs(Temporal<BaseType> const &temporal) {
+    std::vector<Run> result;
+    if (temporal.duration() == TemporalDuration::Sequence) {
+      auto const &sequence = static_cast<TSequence<BaseType> const &>(temporal);
+      result.push_back(sequence_run(sequence));
+    } else {
+      auto const &sequence_set = static_cast<TSequenceSet<BaseType> const &>(temporal);
+      result.reserve(sequence_set.numSequences());
+      for (TSequence<BaseType> const *sequence : sequence_set.orderedSequences()) {
+        result.push_back(sequence_run(*sequence));
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Cuts stepwise runs into linear constant ones, one per segment, and
+   * one for the last instant if it is included.
+   */
+  static std::vector<Run> constant_runs(std::vector<Run> const &stepwise) {
+    std::vector<Run> result;
+    for (Run const &run : stepwise) {
+      if (run.size == 1) {
+        result.push_back({run.timestamps, run.values, 1, true, true, Interpolation::Linear, true});
+        continue;
+      }
+      for (size_t k = 0; k + 1 < run.size; k++) {
+        result.push_back({run.timestamps + k, run.values + k, 2, k == 0 ? run.lower_inc : true,
+                          false, Interpolation::Linear, true});
+      }
+      if (run.upper_inc) {
+        size_t const last = run.size - 1;
+        result.push_back({run.timestamps + last, run.values + last, 1, true, true,
+                          Interpolation::Linear, true});
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Value of the run at t, moving segment forward as value_at() does
+   * for sequences. With held, the value at t is the one held just before it,
+   * as needed at exclusive stepwise cuts.
+   */
+  static BaseType value_at(Run const &run, time_point const t, size_t &segment,
+                           bool const held = false) {
+    if (run.constant) return run.values[0];
+    while (segment + 1 < run.size
+           && (held ? run.timestamps[segment + 1] < t : run.timestamps[segment + 1] <= t)) {
+      segment++;
+    }
+    time_point const from = run.timestamps[segment];
+    if (from == t || segment + 1 == run.size || run.interpolation == Interpolation::Stepwise) {
+      return run.values[segment];
+    }
+    double const ratio = static_cast<double>((t - from).count())
+                         / static_cast<double>((run.timestamps[segment + 1] - from).count());
+    return interpolate(run.values[segment], run.values[segment + 1], ratio);
+  }
+
+  template <typename Sink> static void synchronize_runs(Run const &a, Run const &b, Sink &sink) {
+    time_point const a_start = a.timestamps[0];
+    time_point const b_start = b.timestamps[0];
+    time_point const a_end = a.timestamps[a.size - 1];
+    time_point const b_end = b.timestamps[b.size - 1];
+
+    time_point const lower = std::max(a_start, b_start);
+    bool const lower_inc = (a_start < lower || a.lower_inc) && (b_start < lower || b.lower_inc);
+    time_point const upper = std::min(a_end, b_end);
+    bool const upper_inc = (upper < a_end || a.upper_inc) && (upper < b_end || b.upper_inc);
+    if (lower > upper || (lower == upper && !(lower_inc && upper_inc))) return;
+
+    // Positions of the first timestamps strictly after the lower bound
+    size_t ia = std::upper_bound(a.timestamps, a.timestamps + a.size, lower) - a.timestamps;
+    size_t ib = std::upper_bound(b.timestamps, b.timestamps + b.size, lower) - b.timestamps;
+    size_t a_segment = ia - 1;
+    size_t b_segment = ib - 1;
+    sink.begin(lower_inc, a.interpolation);
+    sink.add(lower, value_at(a, lower, a_segment), value_at(b, lower, b_segment));
+    if (lower < upper) {
+      // Timestamps of either run strictly between the bounds, merged
+      while (true) {
+        time_point t = upper;
+        if (ia < a.size && a.timestamps[ia] < t) t = a.timestamps[ia];
+        if (ib < b.size && b.timestamps[ib] < t) t = b.timestamps[ib];
+        if (t == upper) break;
+        sink.add(t, value_at(a, t, a_segment), value_at(b, t, b_segment));
+        if (ia < a.size && a.timestamps[ia] == t) ia++;
+        if (ib < b.size && b.timestamps[ib] == t) ib++;
+      }
+
+      // With stepwise interpolation, the value held until an exclusive cut is the previous one
+      bool const stepwise = a.interpolation == Interpolation::Stepwise;
+      bool const a_held = stepwise && !upper_inc && upper < a_end;
+      bool const b_held = stepwise && !upper_inc && upper < b_end;
+      sink.add(upper, value_at(a, upper, a_segment, a_held),
+               value_at(b, upper, b_segment, b_held));
+    }
+    sink.end(upper_inc);
+  }
+
+  /**
+   * @brief Calls f(t, value, other_value) for each instant of the discrete
+   * value at which the other one is defined.
+   */
+  template <typename Function> static void synchronize_discrete(Temporal<BaseType> const &discrete,
+                                                                Temporal<BaseType> const &other,
+                                                                Function const &f) {
+    if (discrete.duration() == TemporalDuration::Instant) {
+      auto const &instant = static_cast<TInstant<BaseType> const &>(discrete);
+      auto const values = other.valuesAtTimestamps({instant.getTimestamp()});
+      if (!values.empty()) f(instant.getTimestamp(), instant.getValue(), values.front().first);
+      return;
+    }
+
+    auto const &instant_set = static_cast<TInstantSet<BaseType> const &>(discrete);
+    SharedVector<time_point> const &timestamps = instant_set.storedTimestamps();
+    SharedVector<BaseType> const &values = instant_set.storedValues();
+    // The values of the other one are at a subsequence of the timestamps
+    size_t k = 0;
+    for (auto const &value : other.valuesAtTimestamps(timestamps.copy())) {
+      while (timestamps[k] < value.second) k++;
+      f(value.second, values[k], value.first);
+    }
+  }
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <>
+inline float Synchronizer<float>::interpolate(float const &from, float const &to, double ratio) {
+  return static_cast<float>(from + (static_cast<double>(to) - from) * ratio);
+}
+#endif
+
+}  // namespace meos
@@ -51,6 +51,7 @@ public:
 
   // Comparision functions
   int compare(Temporal<BaseType> const &other) const override;
+  size_t hash() const override;
 
   // Accessor functions
   BaseType getValue() const;
@@ -69,10 +70,16 @@ public:
 
   duration_ms timespan() const override;
   std::set<Range<BaseType>> getValues() const override;
+  bbox_t<BaseType> boundingBox() const override;
   std::set<time_point> timestamps() const override;
+  size_t numTimestamps() const override;
+  time_point startTimestamp() const override;
+  time_point endTimestamp() const override;
+  time_point timestampN(size_t n) const override;
   PeriodSet getTime() const override;
   Period period() const override;
   std::unique_ptr<TInstant> shift(duration_ms const timedelta) const;
+  BaseType valueAtTimestamp(time_point const datetime) const override;
   bool intersectsTimestamp(time_point const datetime) const override;
   bool intersectsPeriod(Period const period) const override;
 
@@ -92,6 +99,10 @@ private:
 
   void validate();
 
+  size_t instants_size() const { return 1; }
+  TInstant instant_at(size_t) const { return *this; }
+  friend TInstantFunctions<TInstant<BaseType>, TInstant<BaseType>, BaseType>;
+
   /**
    * @brief Compares timestamp and value. Does not take SRID into account.
    */
@@ -99,6 +110,11 @@ private:
 
   TInstant *clone_impl() const override;
   TInstant *shift_impl(duration_ms const timedelta) const override;
+  void values_at_timestamps_impl(
+      std::vector<time_point> const &timestamps,
+      std::vector<std::pair<BaseType, time_point>> &values) const override;
+  TInstant *at_periods_impl(std::vector<Period> const &periods) const override;
+  bool intersects_timestamp_set_impl(TimestampSet const &timestampset) const override;
 };
 
 typedef TInstant<bool> TBoolInst;
@@ -108,3 +124,10 @@ typedef TInstant<std::string> TTextInst;
 typedef TInstant<GeomPoint> TGeomPointInst;
 
 }  // namespace meos
+
+namespace std {
+
+template <typename BaseType>
+struct hash<meos::TInstant<BaseType>> : hash<meos::Temporal<BaseType>> {};
+
+}  // namespace std
@@ -1,88 +1,74 @@
 #pragma once
 
+#include <string>
+
 namespace meos {
 
 /**
  * This template class uses CRTP pattern and assumes the presence of the
- * following function defined on the TemporalType class:
+ * following functions defined on the TemporalType class:
  *
- *   set<TInstantType> TemporalType::instants() const
+ *   size_t TemporalType::instants_size() const
+ *   TInstantType TemporalType::instant_at(size_t n) const
  *
  * where TemporalType == a class extending Temporal<BaseType>
  *   and TInstantType == TInstant<BaseType>
+ *
+ * instant_at(n) must return the n-th instant of TemporalType::instants(), for
+ * any n < instants_size(), without having to materialize the whole set.
  */
 template <typename TemporalType, typename TInstantType, typename BaseType>
 struct TInstantFunctions {
   /**
    * @brief Number of distinct instants.
    */
-  size_t numInstants() const { return this->temporal().instants().size(); };
+  size_t numInstants() const { return this->temporal().instants_size(); };
 
   /**
    * @brief Start instant, irrespective of whether the bounds are inclusive or not.
    */
   TInstantType startInstant() const {
-    auto s = this->temporal().instants();
-    if (s.size() <= 0) {
+    if (this->numInstants() <= 0) {
       throw "At least one instant expected";
     }
-    return *s.begin();
+    return this->temporal().instant_at(0);
   };
 
   /**
    * @brief End instant, irrespective of whether the bounds are inclusive or not.
    */
   TInstantType endInstant() const {
-    auto s = this->temporal().instants();
-    if (s.size() <= 0) {
+    size_t const n = this->numInstants();
+    if (n <= 0) {
       throw "At least one instant expected";
     }
-    return *s.rbegin();
+    return this->temporal().instant_at(n - 1);
   };
 
   /**
    * @brief N-th distinct instant, irrespective of whether the bounds are inclusive or not.
    */
   TInstantType instantN(size_t n) const {
-    auto s = this->temporal().instants();
-    if (s.size() <= n) {
+    if (this->numInstants() <= n) {
       throw "At least " + std::to_string(n) + " instant(s) expected";
     }
-    return *next(s.begin(), n);
+    return this->temporal().instant_at(n);
   };
 
   /**
    * @brief Start value, irrespective of whether the bounds are inclusive or not.
    */
-  BaseType startValue() const {
-    auto s = this->temporal().instants();
-    if (s.size() <= 0) {
-      throw "At least one instant expected";
-    }
-    return this->temporal().startInstant().getValue();
-  }
+  BaseType startValue() const { return this->startInstant().getValue(); }
 
   /**
    * @brief End value, irrespective of whether the bounds are inclusive or not.
    */
-  BaseType endValue() const {
-    auto s = this->temporal().instants();
-    if (s.size() <= 0) {
-      throw "At least one instant expected";
-    }
-    return this->temporal().endInstant().getValue();
-  }
+  BaseType endValue() const { return this->endInstant().getValue(); }
 
   /**
    * @brief N-th value, irrespective of whether the bounds are inclusive or not.
    */
-  BaseType valueN(size_t n) const {
-    auto s = this->temporal().instants();
-    if (s.size() <= n) {
-      throw "At least " + std::to_string(n) + " instant(s) expected";
-    }
-    return this->temporal().instantN(n).getValue();
-  }
+  BaseType valueN(size_t n) const { return this->instantN(n).getValue(); }
 
 private:
   TemporalType &temporal() { return static_cast<TemporalType &>(*this); }
@@ -4,8 +4,10 @@
 #include <meos/types/temporal/TInstant.hpp>
 #include <meos/types/temporal/Temporal.hpp>
 #include <meos/types/temporal/TemporalSet.hpp>
+#include <meos/types/traits.hpp>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace meos {
 
@@ -19,6 +21,12 @@ template <typename BaseType = float> class TInstantSet : public TemporalSet<Base
 public:
   TInstantSet();
   TInstantSet(std::set<TInstant<BaseType>> const &instants);
+
+  /**
+   * @brief Builds the instant set in one pass from timestamps and values already
+   * ordered by timestamp and then by value.
+   */
+  TInstantSet(std::vector<time_point> timestamps, std::vector<BaseType> values);
   TInstantSet(std::set<std::string> const &instants);
   TInstantSet(std::string const &serialized);
 
@@ -32,7 +40,29 @@ public:
   template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
   TInstantSet(std::string const &serialized, int srid);
 
+  /**
+   * @brief Integral of the values over time, which is 0, as the instants of an
+   * instant set have no duration.
+   */
+  template <typename B = BaseType, typename is_number<B>::type * = nullptr>
+  double integral() const;
+
+  /**
+   * @brief Time-weighted average of the values. The instants have no duration,
+   * so they all weigh the same.
+   */
+  template <typename B = BaseType, typename is_number<B>::type * = nullptr>
+  double twAvg() const;
+
+  /**
+   * @brief Time-weighted centroid of the points, as twAvg() of each of their
+   * coordinates.
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  GeomPoint twCentroid() const;
+
   int compare(Temporal<BaseType> const &other) const override;
+  size_t hash() const override;
 
   std::unique_ptr<TInstantSet<BaseType>> clone() const {
     return std::unique_ptr<TInstantSet<BaseType>>(this->clone_impl());
@@ -46,6 +76,7 @@ public:
   Period period() const override;
   std::unique_ptr<TInstantSet<BaseType>> shift(duration_ms const timedelta) const;
   TInstantSet<BaseType> *shift_impl(duration_ms const timedelta) const override;
+  BaseType valueAtTimestamp(time_point const datetime) const override;
   bool intersectsTimestamp(time_point const datetime) const override;
   bool intersectsPeriod(Period const period) const override;
 
@@ -89,6 +120,14 @@ private:
   std::ostream &write_internal(std::ostream &os) const;
 
   TInstantSet<BaseType> *clone_impl() const override { return new TInstantSet<BaseType>(*this); };
+
+  void values_at_timestamps_impl(
+      std::vector<time_point> const &timestamps,
+      std::vector<std::pair<BaseType, time_point>> &values) const override;
+
+  TInstantSet<BaseType> *at_periods_impl(std::vector<Period> const &periods) const override;
+
+  bool intersects_timestamp_set_impl(TimestampSet const &timestampset) const override;
 };
 
 typedef TInstantSet<bool> TBoolInstSet;
@@ -98,3 +137,10 @@ typedef TInstantSet<std::string> TTextInstSet;
 typedef TInstantSet<GeomPoint> TGeomPointInstSet;
 
 }  // namespace meos
+
+namespace std {
+
+template <typename BaseType>
+struct hash<meos::TInstantSet<BaseType>> : hash<meos::Temporal<BaseType>> {};
+
+}  // namespace std
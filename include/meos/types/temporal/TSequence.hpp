@@ -5,30 +5,44 @@
 #include <meos/types/temporal/TInstant.hpp>
 #include <meos/types/temporal/Temporal.hpp>
 #include <meos/types/temporal/TemporalSet.hpp>
+#include <meos/types/traits.hpp>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace meos {
 
 using time_point = std::chrono::system_clock::time_point;
 using duration_ms = std::chrono::milliseconds;
 
+template <typename BaseType> class TSequenceSet;
+template <typename BaseType> class TSequenceBuilder;
+
 /**
  * @brief Set of TInstant objects, with exclusive/inclusive bounds and \link Interpolation \endlink.
  */
 template <typename BaseType = float> class TSequence : public TemporalSet<BaseType> {
 public:
   TSequence();
-  TSequence(std::set<TInstant<BaseType>> &instants_, bool lower_inc = true, bool upper_inc = false,
-            Interpolation interpolation = default_interp_v<BaseType>);
+  TSequence(std::set<TInstant<BaseType>> const &instants, bool lower_inc = true,
+            bool upper_inc = false, Interpolation interpolation = default_interp_v<BaseType>);
   TSequence(std::set<std::string> const &instants, bool lower_inc = true, bool upper_inc = false,
             Interpolation interpolation = default_interp_v<BaseType>);
   TSequence(std::string const &serialized);
 
+  /**
+   * @brief Builds the sequence in one pass from timestamps and values already
+   * ordered by timestamp and then by value.
+   */
+  TSequence(std::vector<time_point> timestamps, std::vector<BaseType> values,
+            bool lower_inc = true, bool upper_inc = false,
+            Interpolation interpolation = default_interp_v<BaseType>);
+
   // Additional constructors for GeomPoint base type to specify SRID
   template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
-  TSequence(std::set<TInstant<BaseType>> &instants_, bool lower_inc = true, bool upper_inc = false,
-            int srid = SRID_DEFAULT, Interpolation interpolation = default_interp_v<BaseType>);
+  TSequence(std::set<TInstant<BaseType>> const &instants, bool lower_inc = true,
+            bool upper_inc = false, int srid = SRID_DEFAULT,
+            Interpolation interpolation = default_interp_v<BaseType>);
 
   template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
   TSequence(std::set<std::string> const &instants, bool lower_inc = true, bool upper_inc = false,
@@ -42,7 +56,101 @@ public:
 
   TSequence<BaseType> with_interp(Interpolation interpolation) const;
 
+  /**
+   * @brief Douglas-Peucker simplification, keeping the instants needed for the
+   * trajectory to stay within epsilon of the original one.
+   *
+   * The spatial variant measures the distance of each dropped point to the
+   * segment replacing it, while the synchronized one measures the distance to
+   * the position on that segment at the same timestamp (SED), so that the
+   * speed along the trajectory is preserved too. Stepwise sequences always use
+   * the distance to the previous kept point.
+   *
+   * The first and last instants are always kept, so the bounds, the
+   * interpolation and the SRID are preserved.
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  TSequence<BaseType> simplify(double epsilon, bool synchronized = false) const;
+
+  /**
+   * @brief Distance travelled, in the units of the SRID.
+   *
+   * Points only move along the segments of linear sequences, so stepwise ones
+   * have a length of 0. The z coordinates are taken into account when present.
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  double length() const;
+
+  /**
+   * @brief Distance travelled since the start of the sequence, at any time.
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  TSequence<float> cumulativeLength() const;
+
+  /**
+   * @brief Speed on each segment, in units of the SRID per second, as a
+   * stepwise sequence. Instantaneous sequences have no speed, so nullptr is
+   * returned for them.
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  std::unique_ptr<TSequence<float>> speed() const;
+
+  /**
+   * @brief Heading on each segment, in radians clockwise from the north, as
+   * stepwise sequences.
+   *
+   * The heading is undefined while the point doesn't move, so these periods
+   * are left out. nullptr is returned when nothing remains, and for stepwise
+   * sequences, whose points never move along a segment.
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  std::unique_ptr<TSequenceSet<float>> azimuth() const;
+
+  /**
+   * @brief Integral of the values over time, in value-seconds.
+   *
+   * Linear segments are integrated by the trapezoid rule, while stepwise ones
+   * hold their first value until the next instant. The bounds don't matter, as
+   * an instant alone has no duration.
+   */
+  template <typename B = BaseType, typename is_number<B>::type * = nullptr>
+  double integral() const;
+
+  /**
+   * @brief Time-weighted average of the values, i.e, integral() over the
+   * duration. Instantaneous sequences give their only value.
+   */
+  template <typename B = BaseType, typename is_number<B>::type * = nullptr>
+  double twAvg() const;
+
+  /**
+   * @brief Time-weighted centroid of the points, i.e, twAvg() of each of
+   * their coordinates, with the SRID of the sequence.
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  GeomPoint twCentroid() const;
+
+  /**
+   * @brief Douglas-Peucker simplification, keeping the instants needed for the
+   * values to stay within epsilon of the original ones at all times.
+   */
+  template <typename B = BaseType,
+            typename std::enable_if<std::is_same<B, float>::value>::type * = nullptr>
+  TSequence<BaseType> simplify(double epsilon) const;
+
+  /**
+   * @brief Douglas-Peucker simplification, keeping the instants needed for the
+   * speed of each segment, i.e, the change of value per second, to stay within
+   * epsilon of the original speed at all times.
+   *
+   * Only linear sequences have a speed, stepwise ones are rejected.
+   */
+  template <typename B = BaseType,
+            typename std::enable_if<std::is_same<B, float>::value>::type * = nullptr>
+  TSequence<BaseType> simplifyMaxSpeed(double epsilon) const;
+
   int compare(Temporal<BaseType> const &other) const override;
+  size_t hash() const override;
 
   std::unique_ptr<TSequence<BaseType>> clone() const {
     return std::unique_ptr<TSequence<BaseType>>(this->clone_impl());
@@ -60,6 +168,7 @@ public:
   Period period() const override;
   std::unique_ptr<TSequence<BaseType>> shift(duration_ms const timedelta) const;
   TSequence<BaseType> *shift_impl(duration_ms const timedelta) const override;
+  BaseType valueAtTimestamp(time_point const datetime) const override;
   bool intersectsTimestamp(time_point const datetime) const override;
   bool intersectsPeriod(Period const period) const override;
 
@@ -110,6 +219,46 @@ private:
   std::ostream &write_internal(std::ostream &os, bool with_interp = true) const;
 
   TSequence<BaseType> *clone_impl() const override { return new TSequence<BaseType>(*this); };
+
+  /**
+   * @brief Sequence made of the instants at the given sorted positions, which
+   * include the first and the last one.
+   */
+  TSequence<BaseType> with_instants(std::vector<size_t> const &positions) const;
+
+  /**
+   * @brief cumulativeLength() starting from the given length rather than 0, so
+   * that sequence sets can chain their sequences.
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  TSequence<float> cumulative_length(double start) const;
+
+  /**
+   * @brief Value at a timestamp the sequence is defined at.
+   *
+   * segment is the index of an instant at or before the timestamp. It is moved
+   * forward to the start of the segment holding the timestamp, so that sorted
+   * timestamps can be evaluated in a single pass by reusing the same index.
+   */
+  BaseType value_at(time_point const t, size_t &segment) const;
+  friend class TSequenceSet<BaseType>;
+  friend class TSequenceBuilder<BaseType>;
+
+  void values_at_timestamps_impl(
+      std::vector<time_point> const &timestamps,
+      std::vector<std::pair<BaseType, time_point>> &values) const override;
+
+  /**
+   * @brief Part of the sequence within the period, or nullptr if they don't intersect.
+   *
+   * The instants strictly within the period are found by binary search, and
+   * the segments crossing its bounds are cut there.
+   */
+  TSequence<BaseType> *at_period(Period const &period) const;
+
+  Temporal<BaseType> *at_periods_impl(std::vector<Period> const &periods) const override;
+
+  bool intersects_timestamp_set_impl(TimestampSet const &timestampset) const override;
 };
 
 typedef TSequence<bool> TBoolSeq;
@@ -119,3 +268,10 @@ typedef TSequence<std::string> TTextSeq;
 typedef TSequence<GeomPoint> TGeomPointSeq;
 
 }  // namespace meos
+
+namespace std {
+
+template <typename BaseType>
+struct hash<meos::TSequence<BaseType>> : hash<meos::Temporal<BaseType>> {};
+
+}  // namespace std
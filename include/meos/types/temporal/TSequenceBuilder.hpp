@@ -0,0 +1,82 @@
+#pragma once
+
+#include <meos/types/geom/SRIDMembers.hpp>
+#include <meos/types/temporal/BoundingBox.hpp>
+#include <meos/types/temporal/Interpolation.hpp>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/util/shared_vector.hpp>
+#include <memory>
+#include <vector>
+
+namespace meos {
+
+using time_point = std::chrono::system_clock::time_point;
+
+/**
+ * @brief Grows a sequence one instant at a time, e.g. from a live feed.
+ *
+ * Each appended instant is only checked against the last one, and the
+ * bounding box is extended as instants come, so appending is amortised O(1)
+ * instead of rebuilding and revalidating the whole sequence. The sequences
+ * produced include both of their bounds.
+ */
+template <typename BaseType = float> class TSequenceBuilder {
+public:
+  TSequenceBuilder(Interpolation interpolation = default_interp_v<BaseType>);
+
+  void reserve(size_t capacity);
+  size_t size() const;
+  bool empty() const;
+
+  /**
+   * @brief Appends an instant, which must be strictly after the last one.
+   *
+   * Points must share the SRID of the first point appended, and take it
+   * when they don't have any. Points appended after a build keep to it too.
+   */
+  void append(BaseType value, time_point t);
+  void append(TInstant<BaseType> const &instant);
+
+  /**
+   * @brief Last instant appended.
+   */
+  TInstant<BaseType> endInstant() const;
+
+  /**
+   * @brief The sequence as appended so far. The builder can keep on appending.
+   *
+   * The snapshot shares the instants appended so far with the builder, so
+   * taking one is O(1) whatever their number. They are neither sorted nor
+   * validated again.
+   */
+  TSequence<BaseType> snapshot() const;
+
+  /**
+   * @brief The sequence as appended so far, leaving the builder empty.
+   *
+   * The builder keeps its interpolation and SRID for what is appended next.
+   */
+  TSequence<BaseType> build();
+
+private:
+  Interpolation m_interpolation;
+  // Snapshots view the beginning of these, and appending only writes past
+  // it. A buffer that a snapshot still views is never reallocated in place,
+  // it is copied into a larger one instead.
+  std::shared_ptr<std::vector<time_point>> m_timestamps;
+  std::shared_ptr<std::vector<BaseType>> m_values;
+  bbox_t<BaseType> m_bbox;
+  int m_srid = SRID_DEFAULT;
+
+  /**
+   * @brief Makes room for capacity instants without moving the ones viewed
+   * by snapshots.
+   */
+  void grow(size_t capacity);
+
+  TSequence<BaseType> make_sequence(SharedVector<time_point> timestamps,
+                                    SharedVector<BaseType> values) const;
+};
+
+}  // namespace meos
@@ -8,9 +8,11 @@
 #include <meos/types/temporal/TSequence.hpp>
 #include <meos/types/temporal/Temporal.hpp>
 #include <meos/types/temporal/TemporalComparators.hpp>
+#include <meos/types/traits.hpp>
 #include <meos/util/serializing.hpp>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace meos {
 
@@ -28,15 +30,31 @@ public:
   TSequenceSet();
   TSequenceSet(std::set<TSequence<BaseType>> const &sequences,
                Interpolation interpolation = default_interp_v<BaseType>);
+
+  /**
+   * @brief Takes over the given sequences instead of copying them.
+   */
+  TSequenceSet(std::set<TSequence<BaseType>> &&sequences,
+               Interpolation interpolation = default_interp_v<BaseType>);
   TSequenceSet(std::set<std::string> const &sequences,
                Interpolation interpolation = default_interp_v<BaseType>);
   TSequenceSet(std::string const &serialized);
 
+  // The time index points into the stored sequences, so copies build their own
+  TSequenceSet(TSequenceSet const &other);
+  TSequenceSet(TSequenceSet &&other) = default;
+  TSequenceSet &operator=(TSequenceSet const &other);
+  TSequenceSet &operator=(TSequenceSet &&other) = default;
+
   // Additional constructors for GeomPoint base type to specify SRID
   template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
   TSequenceSet(std::set<TSequence<BaseType>> const &sequences, int srid,
                Interpolation interpolation = default_interp_v<BaseType>);
 
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  TSequenceSet(std::set<TSequence<BaseType>> &&sequences, int srid,
+               Interpolation interpolation = default_interp_v<BaseType>);
+
   template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
   TSequenceSet(std::set<std::string> const &sequences, int srid,
                Interpolation interpolation = default_interp_v<BaseType>);
@@ -45,6 +63,7 @@ public:
   TSequenceSet(std::string const &serialized, int srid);
 
   int compare(Temporal<BaseType> const &other) const override;
+  size_t hash() const override;
 
   std::unique_ptr<TSequenceSet<BaseType>> clone() const {
     return std::unique_ptr<TSequenceSet<BaseType>>(this->clone_impl());
@@ -59,6 +78,23 @@ public:
    */
   std::set<TSequence<BaseType>> sequences() const;
 
+  /**
+   * @brief The sequences as they are stored, without copying them.
+   *
+   * The reference is only valid for as long as this value is.
+   */
+  std::set<TSequence<BaseType>> const &storedSequences() const { return this->m_sequences; }
+
+  /**
+   * @brief The stored sequences in order of time, the ones with an inclusive
+   * lower bound first when they start together.
+   *
+   * The pointers are only valid for as long as this value is.
+   */
+  std::vector<TSequence<BaseType> const *> const &orderedSequences() const {
+    return this->m_ordered;
+  }
+
   /**
    * @brief Number of distinct sequences.
    */
@@ -84,13 +120,68 @@ public:
    */
   std::set<TInstant<BaseType>> instants() const;
 
+  /**
+   * @brief Distance travelled over all the sequences, as TSequence::length().
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  double length() const;
+
+  /**
+   * @brief Distance travelled since the start of the first sequence, at any
+   * time. It stays the same over the gaps between sequences.
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  TSequenceSet<float> cumulativeLength() const;
+
+  /**
+   * @brief Speed on each segment, as TSequence::speed(), or nullptr when all
+   * the sequences are instantaneous.
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  std::unique_ptr<TSequenceSet<float>> speed() const;
+
+  /**
+   * @brief Heading on each segment, as TSequence::azimuth(), or nullptr when
+   * the point never moves.
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  std::unique_ptr<TSequenceSet<float>> azimuth() const;
+
+  /**
+   * @brief Integral of the values over time, as TSequence::integral(). The
+   * gaps between sequences add nothing.
+   */
+  template <typename B = BaseType, typename is_number<B>::type * = nullptr>
+  double integral() const;
+
+  /**
+   * @brief Time-weighted average of the values over the time at which they
+   * are defined, leaving out the gaps. When all the sequences are
+   * instantaneous, their values all weigh the same.
+   */
+  template <typename B = BaseType, typename is_number<B>::type * = nullptr>
+  double twAvg() const;
+
+  /**
+   * @brief Time-weighted centroid of the points, as twAvg() of each of their
+   * coordinates.
+   */
+  template <typename B = BaseType, typename is_geometry<B>::type * = nullptr>
+  GeomPoint twCentroid() const;
+
   duration_ms timespan() const override;
   std::set<Range<BaseType>> getValues() const override;
+  bbox_t<BaseType> boundingBox() const override;
   std::set<time_point> timestamps() const override;
+  size_t numTimestamps() const override;
+  time_point startTimestamp() const override;
+  time_point endTimestamp() const override;
+  time_point timestampN(size_t n) const override;
   PeriodSet getTime() const override;
   Period period() const override;
   std::unique_ptr<TSequenceSet<BaseType>> shift(duration_ms const timedelta) const;
   TSequenceSet<BaseType> *shift_impl(duration_ms const timedelta) const override;
+  BaseType valueAtTimestamp(time_point const datetime) const override;
   bool intersectsTimestamp(time_point const datetime) const override;
   bool intersectsPeriod(Period const period) const override;
 
@@ -109,7 +200,34 @@ private:
   std::set<TSequence<BaseType>> m_sequences;
   Interpolation m_interpolation;
 
+  /**
+   * @brief Cached bounding box, the union of the ones of the sequences.
+   */
+  bbox_t<BaseType> m_bbox;
+
+  /**
+   * @brief Index of the sequences in order of time, built on validation.
+   *
+   * Holds the number of distinct instants and timestamps before each sequence,
+   * counting once those shared by consecutive sequences at their boundary.
+   */
+  std::vector<TSequence<BaseType> const *> m_ordered;
+  std::vector<size_t> m_instants_before;
+  std::vector<size_t> m_timestamps_before;
+
+  /**
+   * @brief Do consecutive sequences at most touch? Otherwise, the instant
+   * functions fall back to merging all the instants.
+   */
+  bool m_disjoint = true;
+
   void validate();
+  void update_bbox();
+  void update_index();
+
+  size_t instants_size() const;
+  TInstant<BaseType> instant_at(size_t n) const;
+  friend TInstantFunctions<TSequenceSet<BaseType>, TInstant<BaseType>, BaseType>;
 
   /**
    * @brief Only does validations common accross all base types.
@@ -137,6 +255,14 @@ private:
   std::ostream &write_internal(std::ostream &os) const;
 
   TSequenceSet<BaseType> *clone_impl() const override { return new TSequenceSet<BaseType>(*this); };
+
+  void values_at_timestamps_impl(
+      std::vector<time_point> const &timestamps,
+      std::vector<std::pair<BaseType, time_point>> &values) const override;
+
+  TSequenceSet<BaseType> *at_periods_impl(std::vector<Period> const &periods) const override;
+
+  bool intersects_timestamp_set_impl(TimestampSet const &timestampset) const override;
 };
 
 typedef TSequenceSet<bool> TBoolSeqSet;
@@ -146,3 +272,10 @@ typedef TSequenceSet<std::string> TTextSeqSet;
 typedef TSequenceSet<GeomPoint> TGeomPointSeqSet;
 
 }  // namespace meos
+
+namespace std {
+
+template <typename BaseType>
+struct hash<meos::TSequenceSet<BaseType>> : hash<meos::Temporal<BaseType>> {};
+
+}  // namespace std
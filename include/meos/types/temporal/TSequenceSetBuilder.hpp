@@ -0,0 +1,75 @@
+#pragma once
+
+#include <limits>
+#include <meos/types/temporal/Interpolation.hpp>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceBuilder.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <set>
+
+namespace meos {
+
+using time_point = std::chrono::system_clock::time_point;
+using duration_ms = std::chrono::milliseconds;
+
+/**
+ * @brief Grows a sequence set one instant at a time, e.g. from a live feed.
+ *
+ * Instants are appended to the last sequence, as with TSequenceBuilder. A new
+ * sequence is started whenever an instant comes more than max_time_gap after
+ * the previous one, or further than max_distance_gap from it. The distance is
+ * the Euclidean one for points and the absolute difference for numbers; it is
+ * not taken into account for the other base types.
+ */
+template <typename BaseType = float> class TSequenceSetBuilder {
+public:
+  TSequenceSetBuilder(duration_ms max_time_gap = duration_ms::max(),
+                      double max_distance_gap = std::numeric_limits<double>::infinity(),
+                      Interpolation interpolation = default_interp_v<BaseType>);
+
+  /**
+   * @brief Appends an instant, which must be strictly after the last one.
+   */
+  void append(BaseType value, time_point t);
+  void append(TInstant<BaseType> const &instant);
+
+  /**
+   * @brief Number of instants appended since the last build.
+   */
+  size_t numInstants() const;
+
+  /**
+   * @brief Number of sequences appended to since the last build.
+   */
+  size_t numSequences() const;
+
+  /**
+   * @brief The sequence set as appended so far. The builder can keep on appending.
+   *
+   * The instants are shared with the snapshot, as with TSequenceBuilder, so
+   * that it only costs a copy of the set of sequences. They are neither sorted
+   * nor validated again.
+   */
+  TSequenceSet<BaseType> snapshot() const;
+
+  /**
+   * @brief The sequence set as appended so far, leaving the builder empty.
+   */
+  TSequenceSet<BaseType> build();
+
+private:
+  duration_ms m_max_time_gap;
+  double m_max_distance_gap;
+  Interpolation m_interpolation;
+  std::set<TSequence<BaseType>> m_sequences;
+  TSequenceBuilder<BaseType> m_current;
+  size_t m_num_instants = 0;
+
+  /**
+   * @brief Is the instant too far from the end of the last sequence to extend it?
+   */
+  bool is_gap(BaseType const &value, time_point t) const;
+};
+
+}  // namespace meos
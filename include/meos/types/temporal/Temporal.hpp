@@ -3,12 +3,16 @@
 #include <meos/types/geom/GeomPoint.hpp>
 #include <meos/types/geom/SRIDMembers.hpp>
 #include <meos/types/range/Range.hpp>
+#include <meos/types/temporal/BoundingBox.hpp>
 #include <meos/types/temporal/TemporalDuration.hpp>
 #include <meos/types/time/Period.hpp>
 #include <meos/types/time/PeriodSet.hpp>
 #include <meos/types/time/TimestampSet.hpp>
+#include <functional>
 #include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace meos {
 
@@ -35,12 +39,24 @@ public:
   Temporal();
   virtual ~Temporal();
 
+  // The virtual destructor would otherwise suppress the moves
+  Temporal(Temporal const &) = default;
+  Temporal(Temporal &&) = default;
+  Temporal &operator=(Temporal const &) = default;
+  Temporal &operator=(Temporal &&) = default;
+
   std::unique_ptr<Temporal<BaseType>> clone() const {
     return std::unique_ptr<Temporal<BaseType>>(this->clone_impl());
   };
 
   virtual int compare(Temporal const &other) const = 0;
 
+  /**
+   * @brief Hash of the instants, bounds, interpolation and SRID, consistent
+   * with compare(). Also available as std::hash.
+   */
+  virtual size_t hash() const = 0;
+
   /**
    * @brief Duration of the temporal value, that is, one of Instant, InstantSet,
    * Sequence, or SequenceSet.
@@ -53,6 +69,14 @@ public:
    */
   virtual std::set<Range<BaseType>> getValues() const = 0;
 
+  /**
+   * @brief Bounding box of the temporal value, see bbox<BaseType> for its type.
+   *
+   * Temporal types made of many instants compute it once, when they are
+   * constructed, and return the cached box.
+   */
+  virtual bbox_t<BaseType> boundingBox() const = 0;
+
   /**
    * @brief Minimum value, irrespective of whether the bounds are inclusive or not.
    */
@@ -85,23 +109,26 @@ public:
 
   /**
    * @brief Number of distinct timestamps.
+   *
+   * The timestamp accessors fall back to materializing timestamps(). Temporal
+   * types override them to answer directly from their own storage.
    */
-  size_t numTimestamps() const;
+  virtual size_t numTimestamps() const;
 
   /**
    * @brief Start timestamp.
    */
-  time_point startTimestamp() const;
+  virtual time_point startTimestamp() const;
 
   /**
    * @brief End timestamp.
    */
-  time_point endTimestamp() const;
+  virtual time_point endTimestamp() const;
 
   /**
    * @brief N-th timestamp.
    */
-  time_point timestampN(size_t n) const;
+  virtual time_point timestampN(size_t n) const;
 
   /**
    * @brief Set of timestamps.
@@ -113,6 +140,24 @@ public:
    */
   std::unique_ptr<Temporal<BaseType>> shift(duration_ms const timedelta) const;
 
+  /**
+   * @brief Value at the timestamp, according to the interpolation.
+   *
+   * Throws std::invalid_argument if the temporal value is not defined at the
+   * timestamp. Use intersectsTimestamp() to check for that first.
+   */
+  virtual BaseType valueAtTimestamp(time_point const datetime) const = 0;
+
+  /**
+   * @brief Values at each of the given timestamps, which must be sorted.
+   *
+   * All timestamps are evaluated in a single pass over the instants, i.e, in
+   * O(n + m). Timestamps at which the temporal value is not defined are
+   * skipped, so the result can be shorter than the input.
+   */
+  std::vector<std::pair<BaseType, time_point>> valuesAtTimestamps(
+      std::vector<time_point> const &timestamps) const;
+
   /**
    * @brief Does the temporal value intersect the timestamp?
    */
@@ -120,6 +165,9 @@ public:
 
   /**
    * @brief Does the temporal value intersect the timestamp set?
+   *
+   * The timestamps are merged with the instants in a single pass, rather than
+   * looked up one by one.
    */
   bool intersectsTimestampSet(TimestampSet const timestampset) const;
 
@@ -133,10 +181,83 @@ public:
    */
   bool intersectsPeriodSet(PeriodSet const periodset) const;
 
+  /**
+   * @brief Restriction to the timestamp, or nullptr if the temporal value is not defined there.
+   */
+  std::unique_ptr<Temporal<BaseType>> atTimestamp(time_point const datetime) const;
+
+  /**
+   * @brief Restriction to the timestamp set, or nullptr if the temporal value is
+   * not defined at any of them.
+   *
+   * Instants stay instants, everything else gives an instant set.
+   */
+  std::unique_ptr<Temporal<BaseType>> atTimestampSet(TimestampSet const &timestampset) const;
+
+  /**
+   * @brief Restriction to the period, or nullptr if the two don't intersect.
+   *
+   * Segments crossing the bounds of the period are cut there, and the values at
+   * the cut points are interpolated. Instants and instant sets keep their
+   * duration. A sequence gives a sequence if a single piece remains and a
+   * sequence set otherwise, while a sequence set always gives a sequence set.
+   */
+  std::unique_ptr<Temporal<BaseType>> atPeriod(Period const &period) const;
+
+  /**
+   * @brief Restriction to the period set, or nullptr if the two don't intersect.
+   * @see atPeriod()
+   */
+  std::unique_ptr<Temporal<BaseType>> atPeriodSet(PeriodSet const &periodset) const;
+
+  /**
+   * @brief Difference with the timestamp, or nullptr if nothing remains.
+   * @see atPeriod()
+   */
+  std::unique_ptr<Temporal<BaseType>> minusTimestamp(time_point const datetime) const;
+
+  /**
+   * @brief Difference with the timestamp set, or nullptr if nothing remains.
+   * @see atPeriod()
+   */
+  std::unique_ptr<Temporal<BaseType>> minusTimestampSet(TimestampSet const &timestampset) const;
+
+  /**
+   * @brief Difference with the period, or nullptr if nothing remains.
+   * @see atPeriod()
+   */
+  std::unique_ptr<Temporal<BaseType>> minusPeriod(Period const &period) const;
+
+  /**
+   * @brief Difference with the period set, or nullptr if nothing remains.
+   * @see atPeriod()
+   */
+  std::unique_ptr<Temporal<BaseType>> minusPeriodSet(PeriodSet const &periodset) const;
+
 private:
   virtual Temporal<BaseType> *clone_impl() const = 0;
 
   virtual Temporal<BaseType> *shift_impl(duration_ms const timedelta) const = 0;
+
+  /**
+   * @brief Appends the values at the given sorted timestamps to values.
+   */
+  virtual void values_at_timestamps_impl(
+      std::vector<time_point> const &timestamps,
+      std::vector<std::pair<BaseType, time_point>> &values) const = 0;
+
+  /**
+   * @brief Restriction to the given periods, or nullptr if nothing remains.
+   *
+   * The periods are sorted, and neither overlap nor are adjacent to each other.
+   * All the at and minus operations are expressed in terms of this one.
+   */
+  virtual Temporal<BaseType> *at_periods_impl(std::vector<Period> const &periods) const = 0;
+
+  /**
+   * @brief Does the temporal value intersect any of the timestamps?
+   */
+  virtual bool intersects_timestamp_set_impl(TimestampSet const &timestampset) const = 0;
 };
 
 typedef Temporal<bool> TBool;
@@ -146,3 +267,11 @@ typedef Temporal<std::string> TText;
 typedef Temporal<GeomPoint> TGeomPoint;
 
 }  // namespace meos
+
+namespace std {
+
+template <typename BaseType> struct hash<meos::Temporal<BaseType>> {
+  size_t operator()(meos::Temporal<BaseType> const &temporal) const { return temporal.hash(); }
+};
+
+}  // namespace std
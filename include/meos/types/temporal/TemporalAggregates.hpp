@@ -0,0 +1,76 @@
+#pragma once
+
+#include <meos/types/temporal/BoundingBox.hpp>
+#include <meos/types/temporal/Temporal.hpp>
+#include <meos/types/temporal/TemporalArithmetic.hpp>
+#include <memory>
+#include <vector>
+
+namespace meos {
+
+// Temporal aggregates over collections of temporal values, as in MobilityDB.
+//
+// The result is defined whenever any of the values is: tcount gives how many
+// of them are defined at each instant, while tmin, tmax, tsum and tavg combine
+// the values of those. Instants and instant sets give an instant set, while
+// sequences and sequence sets give a sequence, or a sequence set where the
+// result has gaps or jumps it can't be interpolated over. Instants can't be
+// aggregated together with sequences, which throws std::invalid_argument. The
+// result is nullptr when there are no values.
+//
+// The result is linear when any of the values is a linear float, in which
+// case tmin and tmax get the instants at which the values cross. tcount is
+// stepwise, and so is tavg of integers.
+//
+// Each value is first copied into flat arrays, and pairs of them are then
+// merged in a single sweep over the union of their timestamps. The merges are
+// arranged as a balanced tree, so this takes O(n log k) for n instants over k
+// values, and each level of the tree is merged on num_threads threads (one
+// per core by default).
+
+/**
+ * @brief Number of the values defined at each instant.
+ */
+template <typename BaseType> std::unique_ptr<Temporal<int>> tcount(
+    std::vector<Temporal<BaseType> const *> const &temporals, size_t num_threads = 0);
+
+/**
+ * @brief Least of the values defined at each instant.
+ */
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> tmin(std::vector<Temporal<BaseType> const *> const &temporals,
+                                         size_t num_threads = 0);
+
+/**
+ * @brief Greatest of the values defined at each instant.
+ */
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> tmax(std::vector<Temporal<BaseType> const *> const &temporals,
+                                         size_t num_threads = 0);
+
+/**
+ * @brief Sum of the values defined at each instant.
+ */
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> tsum(std::vector<Temporal<BaseType> const *> const &temporals,
+                                         size_t num_threads = 0);
+
+/**
+ * @brief Average of the values defined at each instant.
+ */
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<float>> tavg(std::vector<Temporal<BaseType> const *> const &temporals,
+                                      size_t num_threads = 0);
+
+/**
+ * @brief Union of the bounding boxes of the values, see bbox<BaseType>.
+ *
+ * The boxes of contiguous chunks of the values are united on num_threads
+ * threads (one per core by default). Throws std::invalid_argument when there
+ * are no values.
+ */
+template <typename BaseType>
+bbox_t<BaseType> extent(std::vector<Temporal<BaseType> const *> const &temporals,
+                        size_t num_threads = 0);
+
+}  // namespace meos
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <meos/types/temporal/Temporal.hpp>
+#include <meos/types/traits.hpp>
+#include <memory>
+
+namespace meos {
+
+// Lifted arithmetic on temporal numbers.
+//
+// Two temporal values are combined at each of their timestamps, over the time
+// at which both are defined, see Synchronizer. The result is nullptr when they
+// don't intersect in time. Instants and instant sets give values at their own
+// timestamps only, two sequences give a sequence, and a sequence set gives a
+// sequence set. A linear and a stepwise float give a linear result, which
+// jumps where the stepwise one does.
+//
+// The product of two linear segments is not linear, so the instant at which
+// it turns is added to the result. Quotients, and quotients of a number by a
+// linear temporal, are only exact at the instants.
+//
+// A scalar is combined with each value, keeping the duration, timestamps and
+// interpolation. Dividing by zero, or by a linear value crossing zero, throws
+// std::invalid_argument. Integers divide as in C++.
+
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> operator+(Temporal<BaseType> const &lhs,
+                                              Temporal<BaseType> const &rhs);
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> operator+(Temporal<BaseType> const &lhs,
+                                              typename is_number<BaseType>::type rhs);
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> operator+(typename is_number<BaseType>::type lhs,
+                                              Temporal<BaseType> const &rhs);
+
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> operator-(Temporal<BaseType> const &lhs,
+                                              Temporal<BaseType> const &rhs);
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> operator-(Temporal<BaseType> const &lhs,
+                                              typename is_number<BaseType>::type rhs);
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> operator-(typename is_number<BaseType>::type lhs,
+                                              Temporal<BaseType> const &rhs);
+
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> operator*(Temporal<BaseType> const &lhs,
+                                              Temporal<BaseType> const &rhs);
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> operator*(Temporal<BaseType> const &lhs,
+                                              typename is_number<BaseType>::type rhs);
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> operator*(typename is_number<BaseType>::type lhs,
+                                              Temporal<BaseType> const &rhs);
+
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> operator/(Temporal<BaseType> const &lhs,
+                                              Temporal<BaseType> const &rhs);
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> operator/(Temporal<BaseType> const &lhs,
+                                              typename is_number<BaseType>::type rhs);
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<BaseType>> operator/(typename is_number<BaseType>::type lhs,
+                                              Temporal<BaseType> const &rhs);
+
+}  // namespace meos
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <meos/types/temporal/Interpolation.hpp>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <set>
+#include <vector>
+
+namespace meos {
+
+using time_point = std::chrono::system_clock::time_point;
+
+/**
+ * @brief Collects instants to construct a TInstantSet, TSequence or TSequenceSet
+ * in place, without going through a std::set of instants.
+ *
+ * Instants can be added in any order, they are only sorted when building if
+ * they did not arrive ordered. With enough capacity reserved, adding them does
+ * not allocate, and building hands the collected arrays over to the temporal
+ * value, leaving the builder empty.
+ */
+template <typename BaseType = float> class TemporalBuilder {
+public:
+  TemporalBuilder();
+  explicit TemporalBuilder(size_t capacity);
+
+  /**
+   * @brief Reserves room for the instants of the next value built.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Number of instants added since the last build.
+   */
+  size_t size() const;
+
+  void add(BaseType value, time_point t);
+  void add(TInstant<BaseType> const &instant);
+
+  TInstantSet<BaseType> buildInstantSet();
+  TSequence<BaseType> buildSequence(bool lower_inc = true, bool upper_inc = false,
+                                    Interpolation interpolation = default_interp_v<BaseType>);
+
+  /**
+   * @brief Turns the instants added so far into one of the sequences of
+   * buildSequenceSet().
+   */
+  void closeSequence(bool lower_inc = true, bool upper_inc = false,
+                     Interpolation interpolation = default_interp_v<BaseType>);
+
+  /**
+   * @brief Sequence set of the sequences closed so far.
+   */
+  TSequenceSet<BaseType> buildSequenceSet();
+
+private:
+  std::vector<time_point> m_timestamps;
+  std::vector<BaseType> m_values;
+  std::set<TSequence<BaseType>> m_sequences;
+};
+
+}  // namespace meos
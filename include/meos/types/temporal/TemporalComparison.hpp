@@ -0,0 +1,82 @@
+#pragma once
+
+#include <meos/types/temporal/Temporal.hpp>
+#include <meos/types/traits.hpp>
+#include <memory>
+#include <string>
+
+namespace meos {
+
+// Lifted comparisons, giving a temporal boolean.
+//
+// These are named functions as in MobilityDB: the relational operators of
+// temporal values are the total order used to sort them, e.g. in std::set.
+//
+// Two temporal values are compared over the time at which both are defined,
+// see Synchronizer, and the result is nullptr when they don't intersect in
+// time. Instants and instant sets give results at their own timestamps only,
+// and the other ones give a stepwise temporal boolean. Where linear floats
+// cross each other, or the scalar they are compared with, it changes at the
+// exact instant of the crossing. A stepwise sequence can't have a value at an
+// instant alone, e.g. equality at a crossing, so the result is then split
+// into a sequence set.
+//
+// The bounding boxes of temporal numbers are looked at first: when the values
+// of one are all above the values of the other, the result is constant, and
+// the instants aren't walked.
+
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> teq(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs);
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> teq(Temporal<BaseType> const &lhs,
+                                    typename is_ordered<BaseType>::type const &rhs);
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> teq(typename is_ordered<BaseType>::type const &lhs,
+                                    Temporal<BaseType> const &rhs);
+
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tne(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs);
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tne(Temporal<BaseType> const &lhs,
+                                    typename is_ordered<BaseType>::type const &rhs);
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tne(typename is_ordered<BaseType>::type const &lhs,
+                                    Temporal<BaseType> const &rhs);
+
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tlt(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs);
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tlt(Temporal<BaseType> const &lhs,
+                                    typename is_ordered<BaseType>::type const &rhs);
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tlt(typename is_ordered<BaseType>::type const &lhs,
+                                    Temporal<BaseType> const &rhs);
+
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tle(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs);
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tle(Temporal<BaseType> const &lhs,
+                                    typename is_ordered<BaseType>::type const &rhs);
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tle(typename is_ordered<BaseType>::type const &lhs,
+                                    Temporal<BaseType> const &rhs);
+
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tgt(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs);
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tgt(Temporal<BaseType> const &lhs,
+                                    typename is_ordered<BaseType>::type const &rhs);
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tgt(typename is_ordered<BaseType>::type const &lhs,
+                                    Temporal<BaseType> const &rhs);
+
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tge(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs);
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tge(Temporal<BaseType> const &lhs,
+                                    typename is_ordered<BaseType>::type const &rhs);
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+std::unique_ptr<Temporal<bool>> tge(typename is_ordered<BaseType>::type const &lhs,
+                                    Temporal<BaseType> const &rhs);
+
+}  // namespace meos
@@ -5,8 +5,10 @@
 #include <meos/types/temporal/Temporal.hpp>
 #include <meos/types/temporal/TemporalComparators.hpp>
 #include <meos/util/serializing.hpp>
+#include <meos/util/shared_vector.hpp>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace meos {
 
@@ -15,6 +17,13 @@ using duration_ms = std::chrono::milliseconds;
 
 /**
  * @brief Base class for TInstantSet and TSequence.
+ *
+ * Instants are not stored as TInstant objects. Instead, their timestamps and
+ * values are kept in two parallel contiguous arrays (struct-of-arrays), sorted
+ * in the same order a std::set<TInstant<BaseType>> would have them, i.e, by
+ * timestamp and then by value. TInstant objects are only materialized when
+ * requested through the accessors. The arrays are immutable and shared by
+ * copies.
  */
 template <typename BaseType = float> class TemporalSet
     : public Temporal<BaseType>,
@@ -24,6 +33,23 @@ public:
   TemporalSet();
   TemporalSet(std::set<TInstant<BaseType>> const &instants);
 
+  /**
+   * @brief Builds the storage in one pass from already ordered timestamps and values.
+   *
+   * The input is expected to be sorted by timestamp and then by value. Exact
+   * duplicates are dropped, just like a set would. Throws if the arrays are of
+   * different lengths or are not ordered.
+   */
+  TemporalSet(std::vector<time_point> timestamps, std::vector<BaseType> values);
+
+  /**
+   * @brief Sorts parallel arrays of timestamps and values by timestamp and then
+   * by value, the order the array constructors expect.
+   *
+   * Already ordered input is only checked, in one pass.
+   */
+  static void sort_instants(std::vector<time_point> &timestamps, std::vector<BaseType> &values);
+
   /**
    * @brief Set of instants.
    */
@@ -34,8 +60,84 @@ public:
    */
   std::set<time_point> timestamps() const override;
 
+  /**
+   * @brief Timestamps of the instants, one per instant, as they are stored.
+   *
+   * Unlike timestamps(), nothing is copied, and copies of the array keep the
+   * storage alive on their own.
+   */
+  SharedVector<time_point> const &storedTimestamps() const { return this->m_timestamps; }
+
+  /**
+   * @brief Values of the instants, in the same order as storedTimestamps().
+   */
+  SharedVector<BaseType> const &storedValues() const { return this->m_values; }
+
+  /**
+   * @brief Does this value share the stored instants of the other one?
+   *
+   * Copies share them, as the instants are never changed in place, and so do
+   * the snapshots of a builder until it needs more room.
+   */
+  bool sharesInstants(TemporalSet const &other) const {
+    return this->m_timestamps.shares(other.m_timestamps) && this->m_values.shares(other.m_values);
+  }
+
+  bbox_t<BaseType> boundingBox() const override;
+  size_t numTimestamps() const override;
+  time_point startTimestamp() const override;
+  time_point endTimestamp() const override;
+  time_point timestampN(size_t n) const override;
+
 protected:
-  std::set<TInstant<BaseType>> m_instants;
+  SharedVector<time_point> m_timestamps;
+  SharedVector<BaseType> m_values;
+
+  /**
+   * @brief Number of distinct timestamps in m_timestamps.
+   *
+   * The same timestamp can appear more than once with different values, so
+   * this is kept up to date whenever the storage is replaced.
+   */
+  size_t m_num_timestamps = 0;
+
+  /**
+   * @brief Cached bounding box, computed by the subclasses once they are validated.
+   */
+  bbox_t<BaseType> m_bbox;
+
+  /**
+   * @brief Replaces the stored instants with the ones in the given set.
+   */
+  void assign_instants(std::set<TInstant<BaseType>> const &instants);
+
+  /**
+   * @brief Replaces the stored instants, taking over the given ordered arrays.
+   *
+   * See the array constructor for the expectations on the input.
+   */
+  void assign_instants(std::vector<time_point> timestamps, std::vector<BaseType> values);
+
+  /**
+   * @brief Replaces the stored instants with the serialized ones, in any order.
+   */
+  void parse_instants(std::set<std::string> const &instants);
+
+  /**
+   * @brief Materializes the instant stored at the given position.
+   */
+  TInstant<BaseType> instant_at(size_t i) const;
+
+  /**
+   * @brief Hash of the stored instants, for the hash() of the subclasses.
+   */
+  size_t hash_instants() const;
+
+  size_t instants_size() const { return this->m_timestamps.size(); }
+  friend TInstantFunctions<TemporalSet<BaseType>, TInstant<BaseType>, BaseType>;
+
+private:
+  void count_timestamps();
 };
 
 typedef TemporalSet<bool> TBoolSet;
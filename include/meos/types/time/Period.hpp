@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <functional>
 #include <iomanip>
 #include <string>
 
@@ -45,6 +46,11 @@ public:
   bool overlap(Period const &period) const;
   bool contains_timestamp(time_point const timestamp) const;
 
+  /**
+   * @brief Hash consistent with ==, also available as std::hash<Period>.
+   */
+  size_t hash() const;
+
   friend bool operator==(Period const &lhs, Period const &rhs);
   friend bool operator!=(Period const &lhs, Period const &rhs);
   friend bool operator<(Period const &lhs, Period const &rhs);
@@ -57,3 +63,11 @@ public:
 };
 
 }  // namespace meos
+
+namespace std {
+
+template <> struct hash<meos::Period> {
+  size_t operator()(meos::Period const &period) const { return period.hash(); }
+};
+
+}  // namespace std
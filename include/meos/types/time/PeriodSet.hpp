@@ -1,11 +1,14 @@
 #pragma once
 
+#include <functional>
 #include <iomanip>
 #include <iterator>
 #include <meos/types/time/Period.hpp>
+#include <meos/types/time/TimestampSet.hpp>
 #include <meos/util/serializing.hpp>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace meos {
 
@@ -14,6 +17,10 @@ using duration_ms = std::chrono::milliseconds;
 
 /**
  * @brief Set of one or more Period objects.
+ *
+ * The periods are kept normalized in a sorted array, i.e, overlapping or
+ * adjacent periods given on construction are merged together. Lookups are
+ * binary searches and the set operations are linear merges of the arrays.
  */
 class PeriodSet {
 public:
@@ -33,6 +40,12 @@ public:
   Period endPeriod() const;
   Period periodN(size_t n) const;
 
+  /**
+   * @brief Iterators over the normalized periods, in order.
+   */
+  std::vector<Period>::const_iterator begin() const;
+  std::vector<Period>::const_iterator end() const;
+
   duration_ms timespan() const;
   std::unique_ptr<PeriodSet> shift(duration_ms const timedelta) const;
 
@@ -42,6 +55,25 @@ public:
   time_point endTimestamp() const;
   time_point timestampN(size_t n) const;
 
+  bool contains_timestamp(time_point const timestamp) const;
+  bool overlap(Period const &period) const;
+  bool overlap(PeriodSet const &other) const;
+
+  PeriodSet union_(Period const &period) const;
+  PeriodSet union_(PeriodSet const &other) const;
+  PeriodSet union_(TimestampSet const &timestampset) const;
+  PeriodSet intersection(Period const &period) const;
+  PeriodSet intersection(PeriodSet const &other) const;
+  TimestampSet intersection(TimestampSet const &timestampset) const;
+  PeriodSet minus(Period const &period) const;
+  PeriodSet minus(PeriodSet const &other) const;
+  PeriodSet minus(TimestampSet const &timestampset) const;
+
+  /**
+   * @brief Hash consistent with ==, also available as std::hash<PeriodSet>.
+   */
+  size_t hash() const;
+
   friend bool operator==(PeriodSet const &lhs, PeriodSet const &rhs);
   friend bool operator!=(PeriodSet const &lhs, PeriodSet const &rhs);
   friend bool operator<(PeriodSet const &lhs, PeriodSet const &rhs);
@@ -53,7 +85,24 @@ public:
   friend std::ostream &operator<<(std::ostream &os, PeriodSet const &period_set);
 
 protected:
-  std::set<std::unique_ptr<Period>> m_periods;
+  /**
+   * @brief Sorted, disjoint and non adjacent periods.
+   */
+  std::vector<Period> m_periods;
+
+private:
+  /**
+   * @brief Wraps periods which are already sorted, disjoint and non adjacent.
+   */
+  static PeriodSet from_normalized(std::vector<Period> periods);
 };
 
 }  // namespace meos
+
+namespace std {
+
+template <> struct hash<meos::PeriodSet> {
+  size_t operator()(meos::PeriodSet const &period_set) const { return period_set.hash(); }
+};
+
+}  // namespace std
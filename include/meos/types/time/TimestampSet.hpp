@@ -1,25 +1,34 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <iomanip>
 #include <iterator>
 #include <meos/types/time/Period.hpp>
 #include <meos/util/serializing.hpp>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace meos {
 
 using time_point = std::chrono::system_clock::time_point;
 using duration_ms = std::chrono::milliseconds;
 
+class PeriodSet;
+
 /**
  * @brief Set of one or more \link time_point \endlink objects.
+ *
+ * The timestamps are kept as a sorted array of their tick counts, so that
+ * lookups are binary searches and operations on many timestamps at once are
+ * merges of sorted arrays.
  */
 class TimestampSet {
 public:
   TimestampSet();
-  TimestampSet(std::set<time_point> &timestamps);
-  TimestampSet(std::set<std::string> &timestamps);
+  TimestampSet(std::set<time_point> const &timestamps);
+  TimestampSet(std::set<std::string> const &timestamps);
   TimestampSet(std::string const &serialized);
 
   std::set<Period> periods() const;
@@ -38,6 +47,46 @@ public:
   time_point endTimestamp() const;
   time_point timestampN(size_t n) const;
 
+  bool contains_timestamp(time_point const timestamp) const;
+
+  /**
+   * @brief Whether each of the given timestamps is in the set.
+   *
+   * Sorted timestamps are merged with the set in a single pass, others are
+   * looked up one by one.
+   */
+  std::vector<bool> contains_timestamps(std::vector<time_point> const &timestamps) const;
+
+  /**
+   * @brief Whether any of the given timestamps is in the set.
+   *
+   * Sorted timestamps are merged with the set in a single pass, others are
+   * looked up one by one.
+   */
+  bool contains_any(std::vector<time_point> const &timestamps) const;
+
+  /**
+   * @brief Same as above, for the size timestamps starting at the given one.
+   */
+  bool contains_any(time_point const *timestamps, size_t size) const;
+
+  bool overlap(Period const &period) const;
+
+  TimestampSet union_(TimestampSet const &other) const;
+  PeriodSet union_(Period const &period) const;
+  PeriodSet union_(PeriodSet const &periodset) const;
+  TimestampSet intersection(TimestampSet const &other) const;
+  TimestampSet intersection(Period const &period) const;
+  TimestampSet intersection(PeriodSet const &periodset) const;
+  TimestampSet minus(TimestampSet const &other) const;
+  TimestampSet minus(Period const &period) const;
+  TimestampSet minus(PeriodSet const &periodset) const;
+
+  /**
+   * @brief Hash consistent with ==, also available as std::hash<TimestampSet>.
+   */
+  size_t hash() const;
+
   friend bool operator==(TimestampSet const &lhs, TimestampSet const &rhs);
   friend bool operator!=(TimestampSet const &lhs, TimestampSet const &rhs);
   friend bool operator<(TimestampSet const &lhs, TimestampSet const &rhs);
@@ -49,7 +98,21 @@ public:
   friend std::ostream &operator<<(std::ostream &os, TimestampSet const &timestamp_set);
 
 protected:
-  std::set<time_point> m_timestamps;
+  /**
+   * @brief Sorted and distinct tick counts of the timestamps.
+   */
+  std::vector<int64_t> m_timestamps;
+
+private:
+  static TimestampSet from_sorted(std::vector<int64_t> timestamps);
 };
 
 }  // namespace meos
+
+namespace std {
+
+template <> struct hash<meos::TimestampSet> {
+  size_t operator()(meos::TimestampSet const &timestamp_set) const { return timestamp_set.hash(); }
+};
+
+}  // namespace std
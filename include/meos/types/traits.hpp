@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cmath>
+#include <meos/types/geom/GeomPoint.hpp>
+#include <string>
+
+namespace meos {
+
+// Traits telling which operations a base type supports, used to enable them
+// on temporal values. is_geometry comes along with GeomPoint.
+
+/**
+ * @brief Helps find out if a base type is a number, i.e, int or float
+ *
+ * Temporal numbers, TInt and TFloat, get lifted arithmetic and comparisons.
+ */
+template <typename BaseType> struct is_number { static const bool value = false; };
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <> struct is_number<int> {
+  static const bool value = true;
+  typedef int type;
+};
+template <> struct is_number<float> {
+  static const bool value = true;
+  typedef float type;
+};
+#endif
+
+/**
+ * @brief Shorthand for is_number<BaseType>::value
+ */
+template <typename BaseType> constexpr bool is_number_v = is_number<BaseType>::value;
+
+/**
+ * @brief Helps find out if a base type is ordered, i.e, int, float or text
+ *
+ * Temporal values of these types get lifted comparisons.
+ */
+template <typename BaseType> struct is_ordered { static const bool value = false; };
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <> struct is_ordered<int> {
+  static const bool value = true;
+  typedef int type;
+};
+template <> struct is_ordered<float> {
+  static const bool value = true;
+  typedef float type;
+};
+template <> struct is_ordered<std::string> {
+  static const bool value = true;
+  typedef std::string type;
+};
+#endif
+
+/**
+ * @brief Shorthand for is_ordered<BaseType>::value
+ */
+template <typename BaseType> constexpr bool is_ordered_v = is_ordered<BaseType>::value;
+
+/**
+ * @brief Distance between two values, i.e, their absolute difference for
+ * numbers and the euclidean distance for points. 0 for the other types.
+ */
+template <typename BaseType> double value_distance(BaseType const &, BaseType const &) {
+  return 0;
+}
+
+inline double value_distance(int const &from, int const &to) {
+  return std::abs(static_cast<double>(to) - from);
+}
+
+inline double value_distance(float const &from, float const &to) {
+  return std::abs(static_cast<double>(to) - from);
+}
+
+inline double value_distance(GeomPoint const &from, GeomPoint const &to) {
+  return from.distance(to);
+}
+
+}  // namespace meos
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+
+namespace meos {
+
+// Helpers to build structural hashes of composite values, which must agree
+// with their compare() methods: values comparing equal hash equally.
+
+// mixes the hash of the next field into the seed, as boost::hash_combine does
+inline void hash_combine(size_t &seed, size_t value) {
+  seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+// hash of a single field, through std::hash
+template <typename T> size_t hash_value(T const &value) { return std::hash<T>()(value); }
+
+// 0.0 and -0.0 compare equal, so they must hash equally too
+inline size_t hash_value(double value) { return value == 0 ? 0 : std::hash<double>()(value); }
+
+inline size_t hash_value(float value) { return hash_value(static_cast<double>(value)); }
+
+inline size_t hash_value(std::chrono::system_clock::time_point const &t) {
+  return std::hash<std::chrono::system_clock::rep>()(t.time_since_epoch().count());
+}
+
+// hash of all the given fields, in order
+inline size_t hash_fields() { return 0; }
+
+template <typename T, typename... Ts> size_t hash_fields(T const &first, Ts const &...rest) {
+  size_t seed = hash_fields(rest...);
+  hash_combine(seed, hash_value(first));
+  return seed;
+}
+
+// hash of the elements of a range, in order, and of their number
+template <typename Iterator> size_t hash_range(Iterator first, Iterator last) {
+  size_t seed = 0;
+  size_t n = 0;
+  for (; first != last; ++first, ++n) hash_combine(seed, hash_value(*first));
+  hash_combine(seed, n);
+  return seed;
+}
+
+}  // namespace meos
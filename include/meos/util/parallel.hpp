@@ -0,0 +1,51 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace meos {
+
+// number of threads to use when none is asked for: one per core, or a single
+// one if that can't be told
+inline size_t default_num_threads() {
+  return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+// calls f(i) for each i in [0, n), splitting the range in contiguous chunks
+// over up to num_threads threads (0 meaning default_num_threads()). f must be
+// safe to call concurrently for different i. The calling thread takes the
+// first chunk. If any call throws, the first exception is rethrown once all
+// the threads are done, and the rest of the chunk it was thrown from is skipped.
+template <typename Function>
+void parallel_for(size_t n, Function const &f, size_t num_threads = 0) {
+  if (num_threads == 0) num_threads = default_num_threads();
+  num_threads = std::min(num_threads, n);
+  if (num_threads <= 1) {
+    for (size_t i = 0; i < n; i++) f(i);
+    return;
+  }
+
+  std::vector<std::exception_ptr> errors(num_threads);
+  auto const run_chunk = [&](size_t chunk) {
+    try {
+      for (size_t i = chunk * n / num_threads; i < (chunk + 1) * n / num_threads; i++) f(i);
+    } catch (...) {
+      errors[chunk] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (size_t chunk = 1; chunk < num_threads; chunk++) threads.emplace_back(run_chunk, chunk);
+  run_chunk(0);
+  for (std::thread &thread : threads) thread.join();
+
+  for (std::exception_ptr const &error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+}
+
+}  // namespace meos
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <string>
 
 namespace meos {
@@ -9,4 +10,11 @@ using time_point = std::chrono::system_clock::time_point;
 
 std::string write_ISO8601_time(time_point const &t);
 
+/**
+ * Writes the time in ISO8601 format (in UTC, with milliseconds only if
+ * non-zero) to the given buffer, which must be able to hold at least 32
+ * characters. Returns the number of characters written.
+ */
+size_t write_ISO8601_time(time_point const &t, char *buffer);
+
 }  // namespace meos
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace meos {
+
+// immutable array whose copies share the same storage, so copying it is O(1)
+// whatever its size. It reads like a const std::vector, and can only be
+// changed by assigning it a whole new one.
+//
+// It can also cover only the first elements of a vector that is still being
+// appended to, which is how the builders hand out snapshots without copying.
+// The owner of such a vector must neither change the elements covered, nor
+// reallocate the vector, i.e. push past its capacity, once it is shared.
+template <typename T> class SharedVector {
+public:
+  using const_iterator = typename std::vector<T>::const_iterator;
+  using const_reference = typename std::vector<T>::const_reference;
+
+  SharedVector() : m_vector(empty_vector()) {}
+  SharedVector(std::vector<T> const &vector)
+      : m_vector(std::make_shared<std::vector<T> const>(vector)), m_size(m_vector->size()) {}
+  SharedVector(std::vector<T> &&vector)
+      : m_vector(std::make_shared<std::vector<T> const>(std::move(vector))),
+        m_size(m_vector->size()) {}
+
+  // the first size elements of the given vector
+  SharedVector(std::shared_ptr<std::vector<T> const> vector, size_t size)
+      : m_vector(std::move(vector)), m_size(size) {}
+
+  // whether the two share the same storage
+  bool shares(SharedVector const &other) const { return this->m_vector == other.m_vector; }
+
+  size_t size() const { return this->m_size; }
+  bool empty() const { return this->m_size == 0; }
+  T const *data() const { return this->m_vector->data(); }
+  const_iterator begin() const { return this->m_vector->begin(); }
+  const_iterator end() const { return this->m_vector->begin() + this->m_size; }
+  const_reference front() const { return (*this->m_vector)[0]; }
+  const_reference back() const { return (*this->m_vector)[this->m_size - 1]; }
+  const_reference operator[](size_t i) const { return (*this->m_vector)[i]; }
+
+  // copy of the elements, to be changed and assigned back
+  std::vector<T> copy() const { return std::vector<T>(this->begin(), this->end()); }
+
+  friend bool operator==(SharedVector const &lhs, std::vector<T> const &rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+private:
+  std::shared_ptr<std::vector<T> const> m_vector;
+  size_t m_size = 0;
+
+  // all the empty ones share the same storage, so that they don't allocate
+  static std::shared_ptr<std::vector<T> const> const &empty_vector() {
+    static std::shared_ptr<std::vector<T> const> const vector
+        = std::make_shared<std::vector<T> const>();
+    return vector;
+  }
+};
+
+}  // namespace meos
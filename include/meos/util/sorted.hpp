@@ -0,0 +1,20 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace meos {
+
+// Kernels over sorted arrays of time points, given either as their tick
+// counts or as the time points themselves. Both are compared by tick count.
+
+// position of the first value not less than the given tick count, searching
+// forward from position i, which must be at most n
+template <typename T> size_t advance_to(T const *values, size_t i, size_t n, int64_t value);
+
+// whether the two arrays have at least one tick count in common
+template <typename L, typename R>
+bool intersects_sorted(L const *lhs, size_t lhs_n, R const *rhs, size_t rhs_n);
+
+}  // namespace meos
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace meos {
+
+// Calendar conversions for the proleptic Gregorian calendar, without going
+// through libc. Based on Howard Hinnant's chrono-compatible date algorithms.
+
+// number of days since 1970-01-01 for the given date
+int64_t days_from_civil(int64_t year, unsigned month, unsigned day);
+
+// date for the given number of days since 1970-01-01
+void civil_from_days(int64_t days, int64_t &year, unsigned &month, unsigned &day);
+
+// number of days in the given month, taking leap years into account
+unsigned days_in_month(int64_t year, unsigned month);
+
+}  // namespace meos
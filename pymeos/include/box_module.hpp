@@ -40,6 +40,7 @@ void def_box_module(py::module &m) {
       .def(py::self >= py::self)
       .def("__str__", &to_ostream<TBox>)
       .def("__repr__", &to_ostream<TBox>)
+      .def("__hash__", &to_hash<TBox>)
       .def_property_readonly("xmin", &TBox::xmin)
       .def_property_readonly("tmin", &TBox::tmin)
       .def_property_readonly("xmax", &TBox::xmax)
@@ -81,6 +82,7 @@ void def_box_module(py::module &m) {
       .def(py::self >= py::self)
       .def("__str__", &to_ostream<STBox>)
       .def("__repr__", &to_ostream<STBox>)
+      .def("__hash__", &to_hash<STBox>)
       .def_property_readonly("xmin", &STBox::xmin)
       .def_property_readonly("ymin", &STBox::ymin)
       .def_property_readonly("zmin", &STBox::zmin)
@@ -90,5 +92,13 @@ void def_box_module(py::module &m) {
       .def_property_readonly("zmax", &STBox::zmax)
       .def_property_readonly("tmax", &STBox::tmax)
       .def_property_readonly("srid", &STBox::srid)
-      .def_property_readonly("geodetic", &STBox::geodetic);
+      .def_property_readonly("geodetic", &STBox::geodetic)
+      .def("overlaps", &STBox::overlaps, py::arg("other"))
+      .def("contains", &STBox::contains, py::arg("other"))
+      .def("adjacent", &STBox::adjacent, py::arg("other"))
+      .def("expand", py::overload_cast<double const>(&STBox::expand, py::const_),
+           py::arg("distance"))
+      .def("expand", py::overload_cast<duration_ms const>(&STBox::expand, py::const_),
+           py::arg("interval"))
+      .def("union", &STBox::union_, py::arg("other"));
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <pybind11/pybind11.h>
+
+#include <functional>
 #include <sstream>
 #include <string>
 
@@ -8,3 +11,16 @@ template <typename T> std::string to_ostream(T self) {
   s << self;
   return s.str();
 }
+
+/**
+ * Hash consistent with ==, for __hash__. Python would otherwise make the types
+ * defining __eq__ unhashable.
+ */
+template <typename T> size_t to_hash(T const &self) { return std::hash<T>()(self); }
+
+/**
+ * Releases the GIL while the bound function runs, so that other Python threads
+ * can run meanwhile. Only for functions which don't touch Python objects, i.e,
+ * whose arguments and return value are converted from and to C++ ones.
+ */
+using release_gil = pybind11::call_guard<pybind11::gil_scoped_release>;
@@ -17,6 +17,7 @@ void def_geompoint_class(py::module &m) {
       .def(py::init<double, double>())
       .def(py::init<std::string, int>())
       .def(py::init<double, double, int>())
+      .def(py::init<double, double, double, int>())
       .def(py::init<GeomPoint>())
       .def(py::self + py::self, py::arg("other"))
       .def(py::self - py::self, py::arg("other"))
@@ -28,10 +29,14 @@ void def_geompoint_class(py::module &m) {
       .def(py::self >= py::self, py::arg("other"))
       .def("__str__", &to_ostream<GeomPoint>)
       .def("__repr__", &to_ostream<GeomPoint>)
+      .def("__hash__", &to_hash<GeomPoint>)
       .def("compare", &GeomPoint::compare, py::arg("other"))
       .def_property_readonly("x", &GeomPoint::x)
       .def_property_readonly("y", &GeomPoint::y)
+      .def_property_readonly("z", &GeomPoint::z)
+      .def_property_readonly("has_z", &GeomPoint::has_z)
       .def_property_readonly("srid", &GeomPoint::srid)
+      .def("with_srid", &GeomPoint::with_srid, py::arg("srid"))
       .def("fromEWKB", &GeomPoint::fromEWKB)
       .def("toEWKB", &GeomPoint::toEWKB)
       .def("fromEWKT", &GeomPoint::fromEWKT)
@@ -1,33 +1,92 @@
 #pragma once
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
+#include <meos/io/BinaryDeserializer.hpp>
+#include <meos/io/BinarySerializer.hpp>
 #include <meos/io/Deserializer.hpp>
 #include <meos/io/Serializer.hpp>
+#include <meos/io/batch.hpp>
 #include <string>
 
+#include "common.hpp"
+
 using namespace meos;
 namespace py = pybind11;
 
 template <typename T> void declare_serdes(py::module &m, std::string const &typesuffix) {
   py::class_<Serializer<T>>(m, ("Serializer" + typesuffix).c_str())
       .def(py::init<>())
-      .def("write", (std::string(Serializer<T>::*)(TInstant<T> const *)) & Serializer<T>::write)
-      .def("write", (std::string(Serializer<T>::*)(TInstantSet<T> const *)) & Serializer<T>::write)
-      .def("write", (std::string(Serializer<T>::*)(TSequence<T> const *)) & Serializer<T>::write)
-      .def("write", (std::string(Serializer<T>::*)(TSequenceSet<T> const *)) & Serializer<T>::write)
-      .def("write", (std::string(Serializer<T>::*)(Period const *)) & Serializer<T>::write)
-      .def("write", (std::string(Serializer<T>::*)(PeriodSet const *)) & Serializer<T>::write);
+      .def("write", (std::string(Serializer<T>::*)(TInstant<T> const *)) & Serializer<T>::write,
+           release_gil())
+      .def("write", (std::string(Serializer<T>::*)(TInstantSet<T> const *)) & Serializer<T>::write,
+           release_gil())
+      .def("write", (std::string(Serializer<T>::*)(TSequence<T> const *)) & Serializer<T>::write,
+           release_gil())
+      .def("write",
+           (std::string(Serializer<T>::*)(TSequenceSet<T> const *)) & Serializer<T>::write,
+           release_gil())
+      .def("write", (std::string(Serializer<T>::*)(Period const *)) & Serializer<T>::write,
+           release_gil())
+      .def("write", (std::string(Serializer<T>::*)(PeriodSet const *)) & Serializer<T>::write,
+           release_gil())
+      .def_static("writeTemporals", &write_temporals<T>, py::arg("temporals"),
+                  py::arg("num_threads") = 0, release_gil(),
+                  "Writes each temporal value, on num_threads threads (one per core by default)");
 
   py::class_<Deserializer<T>>(m, ("Deserializer" + typesuffix).c_str())
-      .def(py::init<std::string const &>())
-      .def("nextTemporal", &Deserializer<T>::nextTemporal)
-      .def("nextTInstant", &Deserializer<T>::nextTInstant)
-      .def("nextTInstantSet", &Deserializer<T>::nextTInstantSet)
-      .def("nextTSequence", &Deserializer<T>::nextTSequence)
-      .def("nextTSequenceSet", &Deserializer<T>::nextTSequenceSet)
-      .def("nextPeriod", &Deserializer<T>::nextPeriod)
-      .def("nextPeriodSet", &Deserializer<T>::nextPeriodSet);
+      .def(py::init<std::string const &>(), release_gil())
+      .def("nextTemporal", &Deserializer<T>::nextTemporal, release_gil())
+      .def("nextTInstant", &Deserializer<T>::nextTInstant, release_gil())
+      .def("nextTInstantSet", &Deserializer<T>::nextTInstantSet, release_gil())
+      .def("nextTSequence", &Deserializer<T>::nextTSequence, release_gil())
+      .def("nextTSequenceSet", &Deserializer<T>::nextTSequenceSet, release_gil())
+      .def("nextPeriod", &Deserializer<T>::nextPeriod, release_gil())
+      .def("nextPeriodSet", &Deserializer<T>::nextPeriodSet, release_gil())
+      .def_static("readTemporals", &read_temporals<T>, py::arg("serialized"),
+                  py::arg("num_threads") = 0, release_gil(),
+                  "Reads a temporal value from each string, on num_threads threads (one per core "
+                  "by default)");
+}
+
+template <typename T, typename V> void def_binary_write(py::class_<BinarySerializer<T>> &c) {
+  c.def("write", [](BinarySerializer<T> &w, V const *value) {
+    std::string bytes;
+    {
+      py::gil_scoped_release release;
+      bytes = w.write(value);
+    }
+    return py::bytes(bytes);
+  });
+}
+
+template <typename T> void declare_binary_serdes(py::module &m, std::string const &typesuffix) {
+  py::class_<BinarySerializer<T>> serializer(m, ("BinarySerializer" + typesuffix).c_str());
+  serializer.def(py::init<>());
+  def_binary_write<T, TInstant<T>>(serializer);
+  def_binary_write<T, TInstantSet<T>>(serializer);
+  def_binary_write<T, TSequence<T>>(serializer);
+  def_binary_write<T, TSequenceSet<T>>(serializer);
+  def_binary_write<T, Period>(serializer);
+  def_binary_write<T, PeriodSet>(serializer);
+  def_binary_write<T, TimestampSet>(serializer);
+  def_binary_write<T, TBox>(serializer);
+  def_binary_write<T, STBox>(serializer);
+
+  py::class_<BinaryDeserializer<T>>(m, ("BinaryDeserializer" + typesuffix).c_str())
+      .def(py::init<std::string const &>(), release_gil())
+      .def("hasNext", &BinaryDeserializer<T>::hasNext, release_gil())
+      .def("nextTemporal", &BinaryDeserializer<T>::nextTemporal, release_gil())
+      .def("nextTInstant", &BinaryDeserializer<T>::nextTInstant, release_gil())
+      .def("nextTInstantSet", &BinaryDeserializer<T>::nextTInstantSet, release_gil())
+      .def("nextTSequence", &BinaryDeserializer<T>::nextTSequence, release_gil())
+      .def("nextTSequenceSet", &BinaryDeserializer<T>::nextTSequenceSet, release_gil())
+      .def("nextPeriod", &BinaryDeserializer<T>::nextPeriod, release_gil())
+      .def("nextPeriodSet", &BinaryDeserializer<T>::nextPeriodSet, release_gil())
+      .def("nextTimestampSet", &BinaryDeserializer<T>::nextTimestampSet, release_gil())
+      .def("nextTBox", &BinaryDeserializer<T>::nextTBox, release_gil())
+      .def("nextSTBox", &BinaryDeserializer<T>::nextSTBox, release_gil());
 }
 
 void def_io_module(py::module &m) {
@@ -40,4 +99,10 @@ void def_io_module(py::module &m) {
   declare_serdes<float>(io_module, "Float");
   declare_serdes<std::string>(io_module, "Text");
   declare_serdes<GeomPoint>(io_module, "Geom");
+
+  declare_binary_serdes<bool>(io_module, "Bool");
+  declare_binary_serdes<int>(io_module, "Int");
+  declare_binary_serdes<float>(io_module, "Float");
+  declare_binary_serdes<std::string>(io_module, "Text");
+  declare_binary_serdes<GeomPoint>(io_module, "Geom");
 }
@@ -29,11 +29,7 @@ template <typename T> void def_range_type(py::module &m, std::string const &type
       .def(py::self >= py::self)
       .def("__str__", &to_ostream<Range<T>>)
       .def("__repr__", &to_ostream<Range<T>>)
-      .def("__hash__",
-           [](Range<T> const &range) {
-             return py::hash(py::make_tuple(range.lower(), range.upper(), range.lower_inc(),
-                                            range.upper_inc()));
-           })
+      .def("__hash__", &to_hash<Range<T>>)
       .def_property_readonly("lower", &Range<T>::lower)
       .def_property_readonly("upper", &Range<T>::upper)
       .def_property_readonly("lower_inc", &Range<T>::lower_inc)
@@ -4,6 +4,8 @@
 
 #include <string>
 
+#include "../common.hpp"
+
 namespace py = pybind11;
 
 template <class Interface> void def_comparator(const pybind11::module &m,
@@ -24,4 +26,14 @@ template <class Interface> void def_tinstant_functions(const pybind11::module &m
       .def_property_readonly("startValue", &Interface::startValue)
       .def_property_readonly("endValue", &Interface::endValue)
       .def("valueN", &Interface::valueN, py::arg("n"));
-}
\ No newline at end of file
+}
+
+/**
+ * Adds the integral and the time-weighted average, for TInt and TFloat.
+ */
+template <class Class, class PyClass> void def_time_weighted_average(PyClass &c) {
+  c.def("integral", [](Class const &self) { return self.integral(); }, release_gil(),
+        "Integral of the values over time, in value-seconds")
+      .def("twAvg", [](Class const &self) { return self.twAvg(); }, release_gil(),
+           "Time-weighted average of the values");
+}
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <chrono>
+#include <cstdint>
+#include <meos/types/geom/GeomPoint.hpp>
+#include <meos/types/temporal/Interpolation.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/types/temporal/TemporalSet.hpp>
+#include <meos/util/shared_vector.hpp>
+#include <ratio>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace meos;
+namespace py = pybind11;
+
+// Timestamps are handed to NumPy as they are stored, one 64 bit tick count
+// per instant, so the unit of the datetime64 arrays follows the system clock
+static_assert(sizeof(time_point) == sizeof(int64_t)
+                  && std::is_integral<time_point::rep>::value,
+              "time_point is expected to be stored as a 64 bit tick count");
+
+inline py::dtype datetime64_dtype() {
+  using period = std::chrono::system_clock::period;
+  if (std::ratio_equal<period, std::nano>::value) return py::dtype("datetime64[ns]");
+  if (std::ratio_equal<period, std::micro>::value) return py::dtype("datetime64[us]");
+  if (std::ratio_equal<period, std::milli>::value) return py::dtype("datetime64[ms]");
+  return py::dtype("datetime64[s]");
+}
+
+/**
+ * Arrays pointing into the storage of a temporal value are read only, as
+ * values are immutable.
+ */
+inline py::array read_only(py::array array) {
+  array.attr("flags").attr("writeable") = false;
+  return array;
+}
+
+/**
+ * Timestamps from a datetime64 array of any unit, or anything NumPy can turn
+ * into one.
+ */
+inline std::vector<time_point> timestamps_from_numpy(py::object const &timestamps) {
+  auto const ticks = py::module::import("numpy")
+                         .attr("asarray")(timestamps)
+                         .attr("astype")(datetime64_dtype())
+                         .attr("view")("int64")
+                         .cast<py::array_t<int64_t>>();
+  auto const t = ticks.unchecked<1>();
+  std::vector<time_point> result;
+  result.reserve(t.shape(0));
+  for (py::ssize_t i = 0; i < t.shape(0); i++) {
+    result.emplace_back(time_point::duration(t(i)));
+  }
+  return result;
+}
+
+/**
+ * Values from an array of the base type. Numbers are converted in one pass,
+ * the other base types one element at a time.
+ */
+template <typename BaseType> std::vector<BaseType> values_from_numpy(py::object const &values) {
+  return values.cast<std::vector<BaseType>>();
+}
+
+template <typename Number> std::vector<Number> numbers_from_numpy(py::object const &values) {
+  auto const array = values.cast<py::array_t<Number, py::array::c_style | py::array::forcecast>>();
+  if (array.ndim() != 1) throw std::invalid_argument("Expected a one dimensional array");
+  return std::vector<Number>(array.data(), array.data() + array.size());
+}
+
+template <> inline std::vector<int> values_from_numpy<int>(py::object const &values) {
+  return numbers_from_numpy<int>(values);
+}
+
+template <> inline std::vector<float> values_from_numpy<float>(py::object const &values) {
+  return numbers_from_numpy<float>(values);
+}
+
+/**
+ * Points from arrays of coordinates. z can be None for 2D points.
+ */
+inline std::vector<GeomPoint> points_from_numpy(py::object const &x, py::object const &y,
+                                                py::object const &z, int srid) {
+  std::vector<double> const xs = numbers_from_numpy<double>(x);
+  std::vector<double> const ys = numbers_from_numpy<double>(y);
+  std::vector<double> const zs
+      = z.is_none() ? std::vector<double>() : numbers_from_numpy<double>(z);
+  if (ys.size() != xs.size() || (!z.is_none() && zs.size() != xs.size())) {
+    throw std::invalid_argument("The coordinate arrays should be of the same length");
+  }
+  std::vector<GeomPoint> points;
+  points.reserve(xs.size());
+  for (size_t i = 0; i < xs.size(); i++) {
+    if (z.is_none()) {
+      points.emplace_back(xs[i], ys[i], srid);
+    } else {
+      points.emplace_back(xs[i], ys[i], zs[i], srid);
+    }
+  }
+  return points;
+}
+
+/**
+ * Sequences from slices of the arrays, each one starting at the given offset.
+ * Only C++ values are involved, so the GIL can be released meanwhile.
+ */
+template <typename BaseType> std::set<TSequence<BaseType>> sequences_from_numpy(
+    std::vector<time_point> const &timestamps, std::vector<BaseType> const &values,
+    std::vector<int64_t> const &offsets, bool lower_inc, bool upper_inc,
+    Interpolation interpolation) {
+  if (timestamps.size() != values.size()) {
+    throw std::invalid_argument("Expected as many values as timestamps");
+  }
+  size_t const n = timestamps.size();
+  std::set<TSequence<BaseType>> sequences;
+  for (size_t k = 0; k < offsets.size(); k++) {
+    int64_t const begin = offsets[k];
+    int64_t const end = k + 1 < offsets.size() ? offsets[k + 1] : static_cast<int64_t>(n);
+    if ((k == 0 && begin != 0) || begin >= end || end > static_cast<int64_t>(n)) {
+      throw std::invalid_argument(
+          "Sequence starts should be increasing offsets into the arrays, beginning at 0");
+    }
+    std::vector<time_point> ts(timestamps.begin() + begin, timestamps.begin() + end);
+    std::vector<BaseType> vs(values.begin() + begin, values.begin() + end);
+    TemporalSet<BaseType>::sort_instants(ts, vs);
+    sequences.insert(
+        TSequence<BaseType>(std::move(ts), std::move(vs), lower_inc, upper_inc, interpolation));
+  }
+  return sequences;
+}
+
+/**
+ * Timestamps as a datetime64 array. When an owner is given, the array is a
+ * view over the storage, which keeps the owner alive.
+ */
+inline py::array timestamps_to_numpy(SharedVector<time_point> const &timestamps,
+                                     py::handle owner = py::handle()) {
+  auto const *ticks = reinterpret_cast<int64_t const *>(timestamps.data());
+  py::array array(datetime64_dtype(), {timestamps.size()}, {sizeof(time_point)}, ticks, owner);
+  return owner ? read_only(array) : array;
+}
+
+/**
+ * Values as an array. Numbers are viewed in place when an owner is given,
+ * the other base types are always copied.
+ */
+template <typename BaseType>
+py::array values_to_numpy(SharedVector<BaseType> const &values, py::handle = py::handle()) {
+  return py::module::import("numpy").attr("array")(py::cast(values.copy()));
+}
+
+template <typename Number>
+py::array numbers_to_numpy(SharedVector<Number> const &values, py::handle owner) {
+  py::array_t<Number> array({values.size()}, {sizeof(Number)}, values.data(), owner);
+  return owner ? read_only(array) : array;
+}
+
+template <>
+inline py::array values_to_numpy<int>(SharedVector<int> const &values, py::handle owner) {
+  return numbers_to_numpy(values, owner);
+}
+
+template <>
+inline py::array values_to_numpy<float>(SharedVector<float> const &values, py::handle owner) {
+  return numbers_to_numpy(values, owner);
+}
+
+template <>
+inline py::array values_to_numpy<bool>(SharedVector<bool> const &values, py::handle) {
+  // Packed as bits, so there is no storage to view
+  py::array_t<bool> array(values.size());
+  auto a = array.mutable_unchecked<1>();
+  for (size_t i = 0; i < values.size(); i++) a(i) = values[i];
+  return array;
+}
+
+/**
+ * Coordinates of the points as an array with one row per point, and two or
+ * three columns depending on whether the points have a z coordinate.
+ */
+inline py::array coordinates_to_numpy(SharedVector<GeomPoint> const &points) {
+  bool const has_z = !points.empty() && points.front().has_z();
+  size_t const columns = has_z ? 3 : 2;
+  py::array_t<double> array({points.size(), columns});
+  auto a = array.mutable_unchecked<2>();
+  for (size_t i = 0; i < points.size(); i++) {
+    a(i, 0) = points[i].x();
+    a(i, 1) = points[i].y();
+    if (has_z) a(i, 2) = points[i].z();
+  }
+  return array;
+}
+
+/**
+ * Concatenates the arrays of the given sequences, in order of time.
+ */
+template <typename T, typename BaseType>
+SharedVector<T> concatenate(TSequenceSet<BaseType> const &sequence_set,
+                            SharedVector<T> const &(TemporalSet<BaseType>::*array)() const) {
+  std::vector<T> result;
+  result.reserve(sequence_set.numInstants());
+  for (auto const *sequence : sequence_set.orderedSequences()) {
+    auto const &part = (sequence->*array)();
+    result.insert(result.end(), part.begin(), part.end());
+  }
+  return result;
+}
+
+/**
+ * Adds the accessors returning the storage of the instants as arrays.
+ */
+template <typename BaseType, typename PyClass> void def_numpy_accessors(PyClass &c) {
+  c.def(
+       "timestampsArray",
+       [](py::object self) {
+         auto const &temporal = self.cast<TemporalSet<BaseType> const &>();
+         return timestamps_to_numpy(temporal.storedTimestamps(), self);
+       },
+       "Timestamps of the instants as a read only datetime64 array, viewing the storage")
+      .def(
+          "valuesArray",
+          [](py::object self) {
+            auto const &temporal = self.cast<TemporalSet<BaseType> const &>();
+            return values_to_numpy(temporal.storedValues(), self);
+          },
+          "Values of the instants as an array, viewing the storage for numbers");
+}
+
+/**
+ * Adds the accessors returning the instants of all the sequences as arrays.
+ *
+ * The sequences are stored apart, so their instants are always copied.
+ */
+template <typename BaseType, typename PyClass> void def_numpy_sequence_set_accessors(PyClass &c) {
+  c.def(
+       "timestampsArray",
+       [](TSequenceSet<BaseType> const &self) {
+         return timestamps_to_numpy(
+             concatenate(self, &TemporalSet<BaseType>::storedTimestamps));
+       },
+       "Timestamps of the instants of all the sequences, in order, as a datetime64 array")
+      .def(
+          "valuesArray",
+          [](TSequenceSet<BaseType> const &self) {
+            return values_to_numpy(concatenate(self, &TemporalSet<BaseType>::storedValues));
+          },
+          "Values of the instants of all the sequences, in order, as an array")
+      .def(
+          "sequenceStartsArray",
+          [](TSequenceSet<BaseType> const &self) {
+            std::vector<int64_t> starts;
+            int64_t start = 0;
+            for (auto const *sequence : self.orderedSequences()) {
+              starts.push_back(start);
+              start += sequence->numInstants();
+            }
+            return py::array_t<int64_t>(starts.size(), starts.data());
+          },
+          "Offsets of the first instant of each sequence in the arrays");
+}
@@ -1,10 +1,17 @@
 #pragma once
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 #include <meos/types/temporal/Temporal.hpp>
+#include <meos/types/temporal/TemporalAggregates.hpp>
+#include <meos/types/temporal/TemporalArithmetic.hpp>
+#include <meos/types/temporal/TemporalComparison.hpp>
 #include <string>
 #include <type_traits>
+#include <vector>
+
+#include "common.hpp"
 
 using namespace meos;
 namespace py = pybind11;
@@ -13,15 +20,134 @@ template <typename BaseType> using py_temporal
     = py::class_<Temporal<BaseType>,
                  std::conditional_t<std::is_same<BaseType, GeomPoint>::value, SRIDMembers, Empty>>;
 
+template <typename BaseType, typename std::enable_if<!is_number_v<BaseType>>::type * = nullptr>
+void def_temporal_arithmetic(py_temporal<BaseType> &) {}
+
+/**
+ * Lifted arithmetic, only for TInt and TFloat. Integers divide as in C++.
+ */
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+void def_temporal_arithmetic(py_temporal<BaseType> &c) {
+  using T = Temporal<BaseType>;
+  c.def("__add__", [](T const &lhs, T const &rhs) { return lhs + rhs; }, py::is_operator(),
+        release_gil())
+      .def("__add__", [](T const &lhs, BaseType rhs) { return lhs + rhs; }, py::is_operator(),
+           release_gil())
+      .def("__radd__", [](T const &rhs, BaseType lhs) { return lhs + rhs; }, py::is_operator(),
+           release_gil())
+      .def("__sub__", [](T const &lhs, T const &rhs) { return lhs - rhs; }, py::is_operator(),
+           release_gil())
+      .def("__sub__", [](T const &lhs, BaseType rhs) { return lhs - rhs; }, py::is_operator(),
+           release_gil())
+      .def("__rsub__", [](T const &rhs, BaseType lhs) { return lhs - rhs; }, py::is_operator(),
+           release_gil())
+      .def("__mul__", [](T const &lhs, T const &rhs) { return lhs * rhs; }, py::is_operator(),
+           release_gil())
+      .def("__mul__", [](T const &lhs, BaseType rhs) { return lhs * rhs; }, py::is_operator(),
+           release_gil())
+      .def("__rmul__", [](T const &rhs, BaseType lhs) { return lhs * rhs; }, py::is_operator(),
+           release_gil())
+      .def("__truediv__", [](T const &lhs, T const &rhs) { return lhs / rhs; },
+           py::is_operator(), release_gil())
+      .def("__truediv__", [](T const &lhs, BaseType rhs) { return lhs / rhs; },
+           py::is_operator(), release_gil())
+      .def("__rtruediv__", [](T const &rhs, BaseType lhs) { return lhs / rhs; },
+           py::is_operator(), release_gil());
+}
+
+template <typename BaseType, typename std::enable_if<!is_ordered_v<BaseType>>::type * = nullptr>
+void def_temporal_comparison(py_temporal<BaseType> &) {}
+
+/**
+ * Lifted comparisons, only for TInt, TFloat and TText, with another temporal
+ * value or a scalar. The relational operators stay the ordering of temporals.
+ */
+template <typename BaseType, typename is_ordered<BaseType>::type * = nullptr>
+void def_temporal_comparison(py_temporal<BaseType> &c) {
+  using T = Temporal<BaseType>;
+  c.def("teq", [](T const &lhs, T const &rhs) { return teq(lhs, rhs); }, py::arg("other"),
+        release_gil())
+      .def("teq", [](T const &lhs, BaseType const &rhs) { return teq(lhs, rhs); },
+           py::arg("value"), release_gil())
+      .def("tne", [](T const &lhs, T const &rhs) { return tne(lhs, rhs); }, py::arg("other"),
+           release_gil())
+      .def("tne", [](T const &lhs, BaseType const &rhs) { return tne(lhs, rhs); },
+           py::arg("value"), release_gil())
+      .def("tlt", [](T const &lhs, T const &rhs) { return tlt(lhs, rhs); }, py::arg("other"),
+           release_gil())
+      .def("tlt", [](T const &lhs, BaseType const &rhs) { return tlt(lhs, rhs); },
+           py::arg("value"), release_gil())
+      .def("tle", [](T const &lhs, T const &rhs) { return tle(lhs, rhs); }, py::arg("other"),
+           release_gil())
+      .def("tle", [](T const &lhs, BaseType const &rhs) { return tle(lhs, rhs); },
+           py::arg("value"), release_gil())
+      .def("tgt", [](T const &lhs, T const &rhs) { return tgt(lhs, rhs); }, py::arg("other"),
+           release_gil())
+      .def("tgt", [](T const &lhs, BaseType const &rhs) { return tgt(lhs, rhs); },
+           py::arg("value"), release_gil())
+      .def("tge", [](T const &lhs, T const &rhs) { return tge(lhs, rhs); }, py::arg("other"),
+           release_gil())
+      .def("tge", [](T const &lhs, BaseType const &rhs) { return tge(lhs, rhs); },
+           py::arg("value"), release_gil());
+}
+
+template <typename BaseType, typename std::enable_if<!is_number_v<BaseType>>::type * = nullptr>
+void def_number_aggregates(py::module &) {}
+
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+void def_number_aggregates(py::module &m) {
+  m.def("tmin", &tmin<BaseType>, py::arg("temporals"), py::arg("num_threads") = 0, release_gil(),
+        "Least of the values defined at each instant");
+  m.def("tmax", &tmax<BaseType>, py::arg("temporals"), py::arg("num_threads") = 0, release_gil(),
+        "Greatest of the values defined at each instant");
+  m.def("tsum", &tsum<BaseType>, py::arg("temporals"), py::arg("num_threads") = 0, release_gil(),
+        "Sum of the values defined at each instant");
+  m.def("tavg", &tavg<BaseType>, py::arg("temporals"), py::arg("num_threads") = 0, release_gil(),
+        "Average of the values defined at each instant");
+}
+
+/**
+ * Temporal aggregates over a list of temporal values, as module functions
+ * overloaded on the base type. tmin, tmax, tsum and tavg are only for TInt
+ * and TFloat.
+ */
+template <typename BaseType> void def_temporal_aggregates(py::module &m) {
+  m.def("tcount", &tcount<BaseType>, py::arg("temporals"), py::arg("num_threads") = 0,
+        release_gil(), "Number of the values defined at each instant");
+  m.def("extent", &extent<BaseType>, py::arg("temporals"), py::arg("num_threads") = 0,
+        release_gil(), "Union of the bounding boxes of the values");
+  def_number_aggregates<BaseType>(m);
+}
+
 template <typename BaseType> void def_temporal_class(py::module &m, std::string const &typesuffix) {
-  py_temporal<BaseType>(m, ("T" + typesuffix).c_str())
+  py_temporal<BaseType> c(m, ("T" + typesuffix).c_str());
+  c
+      .def_property_readonly("boundingBox", &Temporal<BaseType>::boundingBox)
       .def_property_readonly("minValue", &Temporal<BaseType>::minValue)
       .def_property_readonly("maxValue", &Temporal<BaseType>::maxValue)
       .def_property_readonly("numTimestamps", &Temporal<BaseType>::numTimestamps)
       .def_property_readonly("startTimestamp", &Temporal<BaseType>::startTimestamp)
       .def_property_readonly("endTimestamp", &Temporal<BaseType>::endTimestamp)
       .def("timestampN", &Temporal<BaseType>::timestampN, py::arg("n"))
+      .def("valueAtTimestamp", &Temporal<BaseType>::valueAtTimestamp, py::arg("datetime"))
+      .def("valuesAtTimestamps", &Temporal<BaseType>::valuesAtTimestamps, py::arg("timestamps"),
+           release_gil())
       .def("intersectsTimestampSet", &Temporal<BaseType>::intersectsTimestampSet,
-           py::arg("timestampset"))
-      .def("intersectsPeriodSet", &Temporal<BaseType>::intersectsPeriodSet, py::arg("periodset"));
+           py::arg("timestampset"), release_gil())
+      .def("intersectsPeriodSet", &Temporal<BaseType>::intersectsPeriodSet, py::arg("periodset"),
+           release_gil())
+      .def("atTimestamp", &Temporal<BaseType>::atTimestamp, py::arg("datetime"), release_gil())
+      .def("atTimestampSet", &Temporal<BaseType>::atTimestampSet, py::arg("timestampset"),
+           release_gil())
+      .def("atPeriod", &Temporal<BaseType>::atPeriod, py::arg("period"), release_gil())
+      .def("atPeriodSet", &Temporal<BaseType>::atPeriodSet, py::arg("periodset"), release_gil())
+      .def("minusTimestamp", &Temporal<BaseType>::minusTimestamp, py::arg("datetime"),
+           release_gil())
+      .def("minusTimestampSet", &Temporal<BaseType>::minusTimestampSet, py::arg("timestampset"),
+           release_gil())
+      .def("minusPeriod", &Temporal<BaseType>::minusPeriod, py::arg("period"), release_gil())
+      .def("minusPeriodSet", &Temporal<BaseType>::minusPeriodSet, py::arg("periodset"),
+           release_gil());
+  def_temporal_arithmetic<BaseType>(c);
+  def_temporal_comparison<BaseType>(c);
 }
@@ -8,6 +8,7 @@
 #include <string>
 
 #include "common.hpp"
+#include "numpy.hpp"
 
 using namespace meos;
 namespace py = pybind11;
@@ -17,12 +18,29 @@ template <typename BaseType> using py_temporalset
                  TemporalComparators<TemporalSet<BaseType>>,
                  TInstantFunctions<TemporalSet<BaseType>, TInstant<BaseType>, BaseType>>;
 
+template <typename BaseType>
+void _def_temporalset_class_specializations(py_temporalset<BaseType> &c) {
+  // No specializations by default
+}
+
+template <> void _def_temporalset_class_specializations(py_temporalset<GeomPoint> &c) {
+  c.def(
+      "coordinatesArray",
+      [](TemporalSet<GeomPoint> const &self) {
+        return coordinates_to_numpy(self.storedValues());
+      },
+      "Coordinates of the points as an array with a row per instant");
+}
+
 template <typename BaseType>
 void def_temporalset_class(py::module &m, std::string const &base_type_name) {
   def_comparator<TemporalComparators<TemporalSet<BaseType>>>(m, "Set", base_type_name);
   def_tinstant_functions<TInstantFunctions<TemporalSet<BaseType>, TInstant<BaseType>, BaseType>>(
       m, "Set", base_type_name);
-  py_temporalset<BaseType>(m, ("T" + base_type_name + "Set").c_str())
-      .def_property_readonly("instants", &TemporalSet<BaseType>::instants)
-      .def_property_readonly("timestamps", &TemporalSet<BaseType>::timestamps);
+  auto temporalset_class
+      = py_temporalset<BaseType>(m, ("T" + base_type_name + "Set").c_str())
+            .def_property_readonly("instants", &TemporalSet<BaseType>::instants)
+            .def_property_readonly("timestamps", &TemporalSet<BaseType>::timestamps);
+  def_numpy_accessors<BaseType>(temporalset_class);
+  _def_temporalset_class_specializations<BaseType>(temporalset_class);
 }
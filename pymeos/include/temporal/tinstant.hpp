@@ -34,13 +34,7 @@ py_tinstant<BaseType> _def_tinstant_class_basic(py::module &m, std::string const
       .def(py::self >= py::self, py::arg("other"))
       .def("__str__", &to_ostream<TInstant<BaseType>>)
       .def("__repr__", &to_ostream<TInstant<BaseType>>)
-      .def("__hash__",
-           [](TInstant<BaseType> const &self) {
-             // TODO is there a better way?
-             std::ostringstream s;
-             s << self;
-             return py::hash(py::make_tuple(s.str()));
-           })
+      .def("__hash__", &to_hash<TInstant<BaseType>>)
       .def("compare", &TInstant<BaseType>::compare, py::arg("other"))
       .def_property_readonly("getTimestamp", &TInstant<BaseType>::getTimestamp)
       .def_property_readonly("getValue", &TInstant<BaseType>::getValue)
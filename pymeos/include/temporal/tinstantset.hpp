@@ -8,6 +8,8 @@
 #include <meos/types/temporal/TemporalSet.hpp>
 #include <string>
 
+#include "common.hpp"
+#include "numpy.hpp"
 #include "temporalset.hpp"
 
 using namespace meos;
@@ -20,9 +22,17 @@ template <typename BaseType>
 py_tinstantset<BaseType> _def_tinstantset_class_basic(py::module &m,
                                                       std::string const &base_type_name) {
   return py_tinstantset<BaseType>(m, ("T" + base_type_name + "InstSet").c_str())
-      .def(py::init<std::set<TInstant<BaseType>> &>(), py::arg("instants"))
-      .def(py::init<std::set<std::string> &>(), py::arg("instants"))
-      .def(py::init<std::string &>(), py::arg("serialized"))
+      .def(py::init<std::set<TInstant<BaseType>> &>(), py::arg("instants"), release_gil())
+      .def(py::init<std::set<std::string> &>(), py::arg("instants"), release_gil())
+      .def(py::init<std::string &>(), py::arg("serialized"), release_gil())
+      .def(py::init([](py::object const &timestamps, py::object const &values) {
+             std::vector<time_point> ts = timestamps_from_numpy(timestamps);
+             std::vector<BaseType> vs = values_from_numpy<BaseType>(values);
+             py::gil_scoped_release release;
+             TemporalSet<BaseType>::sort_instants(ts, vs);
+             return TInstantSet<BaseType>(std::move(ts), std::move(vs));
+           }),
+           py::arg("timestamps"), py::arg("values"))
       .def(py::self == py::self, py::arg("other"))
       .def(py::self != py::self, py::arg("other"))
       .def(py::self < py::self, py::arg("other"))
@@ -31,15 +41,18 @@ py_tinstantset<BaseType> _def_tinstantset_class_basic(py::module &m,
       .def(py::self >= py::self, py::arg("other"))
       .def("__str__", &to_ostream<TInstantSet<BaseType>>)
       .def("__repr__", &to_ostream<TInstantSet<BaseType>>)
+      .def("__hash__", &to_hash<TInstantSet<BaseType>>)
       .def("compare", &TInstantSet<BaseType>::compare, py::arg("other"))
       .def_property_readonly("duration", &TInstantSet<BaseType>::duration)
       .def_property_readonly("timespan", &TInstantSet<BaseType>::timespan)
       .def_property_readonly("getValues", &TInstantSet<BaseType>::getValues)
       .def_property_readonly("getTime", &TInstantSet<BaseType>::getTime)
       .def_property_readonly("period", &TInstantSet<BaseType>::period)
-      .def("shift", &TInstantSet<BaseType>::shift, py::arg("timedelta"))
-      .def("intersectsTimestamp", &TInstantSet<BaseType>::intersectsTimestamp, py::arg("datetime"))
-      .def("intersectsPeriod", &TInstantSet<BaseType>::intersectsPeriod, py::arg("period"));
+      .def("shift", &TInstantSet<BaseType>::shift, py::arg("timedelta"), release_gil())
+      .def("intersectsTimestamp", &TInstantSet<BaseType>::intersectsTimestamp, py::arg("datetime"),
+           release_gil())
+      .def("intersectsPeriod", &TInstantSet<BaseType>::intersectsPeriod, py::arg("period"),
+           release_gil());
 }
 
 template <typename BaseType>
@@ -48,11 +61,34 @@ void _def_tinstantset_class_specializations(py_tinstantset<BaseType> &c,
   // No specializations by default
 }
 
+template <> void _def_tinstantset_class_specializations(py_tinstantset<int> &c,
+                                                        std::string const &base_type_name) {
+  def_time_weighted_average<TInstantSet<int>>(c);
+}
+
+template <> void _def_tinstantset_class_specializations(py_tinstantset<float> &c,
+                                                        std::string const &base_type_name) {
+  def_time_weighted_average<TInstantSet<float>>(c);
+}
+
 template <> void _def_tinstantset_class_specializations(py_tinstantset<GeomPoint> &c,
                                                         std::string const &base_type_name) {
-  c.def(py::init<std::set<TInstant<GeomPoint>> &, int>(), py::arg("instants"), py::arg("srid"))
-      .def(py::init<std::set<std::string> &, int>(), py::arg("instants"), py::arg("srid"))
-      .def(py::init<std::string, int>(), py::arg("serialized"), py::arg("srid"));
+  c.def(py::init<std::set<TInstant<GeomPoint>> &, int>(), py::arg("instants"), py::arg("srid"),
+        release_gil())
+      .def(py::init<std::set<std::string> &, int>(), py::arg("instants"), py::arg("srid"),
+           release_gil())
+      .def(py::init<std::string, int>(), py::arg("serialized"), py::arg("srid"), release_gil())
+      .def(py::init([](py::object const &timestamps, py::object const &x, py::object const &y,
+                       py::object const &z, int srid) {
+             std::vector<time_point> ts = timestamps_from_numpy(timestamps);
+             std::vector<GeomPoint> points = points_from_numpy(x, y, z, srid);
+             py::gil_scoped_release release;
+             TemporalSet<GeomPoint>::sort_instants(ts, points);
+             return TInstantSet<GeomPoint>(std::move(ts), std::move(points));
+           }),
+           py::arg("timestamps"), py::arg("x"), py::arg("y"), py::arg("z") = py::none(),
+           py::arg("srid") = 0)
+      .def("twCentroid", &TInstantSet<GeomPoint>::twCentroid<GeomPoint>, release_gil());
 }
 
 template <typename BaseType>
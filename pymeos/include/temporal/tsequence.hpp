@@ -10,6 +10,8 @@
 #include <sstream>
 #include <string>
 
+#include "common.hpp"
+#include "numpy.hpp"
 #include "temporalset.hpp"
 
 using namespace meos;
@@ -24,11 +26,22 @@ py_tsequence<BaseType> _def_tsequence_class_basic(py::module &m,
   return py_tsequence<BaseType>(m, ("T" + base_type_name + "Seq").c_str())
       .def(py::init<std::set<TInstant<BaseType>> &, bool, bool, Interpolation>(),
            py::arg("instants"), py::arg("lower_inc") = true, py::arg("upper_inc") = false,
-           py::arg("interpolation") = default_interp_v<BaseType>)
+           py::arg("interpolation") = default_interp_v<BaseType>, release_gil())
       .def(py::init<std::set<std::string> &, bool, bool, Interpolation>(), py::arg("instants"),
            py::arg("lower_inc") = true, py::arg("upper_inc") = false,
-           py::arg("interpolation") = default_interp_v<BaseType>)
-      .def(py::init<std::string>(), py::arg("serialized"))
+           py::arg("interpolation") = default_interp_v<BaseType>, release_gil())
+      .def(py::init<std::string>(), py::arg("serialized"), release_gil())
+      .def(py::init([](py::object const &timestamps, py::object const &values, bool lower_inc,
+                       bool upper_inc, Interpolation interpolation) {
+             std::vector<time_point> ts = timestamps_from_numpy(timestamps);
+             std::vector<BaseType> vs = values_from_numpy<BaseType>(values);
+             py::gil_scoped_release release;
+             TemporalSet<BaseType>::sort_instants(ts, vs);
+             return TSequence<BaseType>(std::move(ts), std::move(vs), lower_inc, upper_inc,
+                                        interpolation);
+           }),
+           py::arg("timestamps"), py::arg("values"), py::arg("lower_inc") = true,
+           py::arg("upper_inc") = false, py::arg("interpolation") = default_interp_v<BaseType>)
       .def(py::self == py::self, py::arg("other"))
       .def(py::self != py::self, py::arg("other"))
       .def(py::self < py::self, py::arg("other"))
@@ -37,13 +50,7 @@ py_tsequence<BaseType> _def_tsequence_class_basic(py::module &m,
       .def(py::self >= py::self, py::arg("other"))
       .def("__str__", &to_ostream<TSequence<BaseType>>)
       .def("__repr__", &to_ostream<TSequence<BaseType>>)
-      .def("__hash__",
-           [](TSequence<BaseType> const &self) {
-             // TODO is there a better way?
-             std::ostringstream s;
-             s << self;
-             return py::hash(py::make_tuple(s.str()));
-           })
+      .def("__hash__", &to_hash<TSequence<BaseType>>)
       .def("compare", &TSequence<BaseType>::compare, py::arg("other"))
       .def_property_readonly("lower_inc", &TSequence<BaseType>::lower_inc)
       .def_property_readonly("upper_inc", &TSequence<BaseType>::upper_inc)
@@ -53,9 +60,11 @@ py_tsequence<BaseType> _def_tsequence_class_basic(py::module &m,
       .def_property_readonly("getValues", &TSequence<BaseType>::getValues)
       .def_property_readonly("getTime", &TSequence<BaseType>::getTime)
       .def_property_readonly("period", &TSequence<BaseType>::period)
-      .def("shift", &TSequence<BaseType>::shift, py::arg("timedelta"))
-      .def("intersectsTimestamp", &TSequence<BaseType>::intersectsTimestamp, py::arg("datetime"))
-      .def("intersectsPeriod", &TSequence<BaseType>::intersectsPeriod, py::arg("period"));
+      .def("shift", &TSequence<BaseType>::shift, py::arg("timedelta"), release_gil())
+      .def("intersectsTimestamp", &TSequence<BaseType>::intersectsTimestamp, py::arg("datetime"),
+           release_gil())
+      .def("intersectsPeriod", &TSequence<BaseType>::intersectsPeriod, py::arg("period"),
+           release_gil());
 }
 
 template <typename BaseType>
@@ -64,15 +73,48 @@ void _def_tsequence_class_specializations(py_tsequence<BaseType> &c,
   // No specializations by default
 }
 
+template <> void _def_tsequence_class_specializations(py_tsequence<int> &c,
+                                                      std::string const &base_type_name) {
+  def_time_weighted_average<TSequence<int>>(c);
+}
+
+template <> void _def_tsequence_class_specializations(py_tsequence<float> &c,
+                                                      std::string const &base_type_name) {
+  def_time_weighted_average<TSequence<float>>(c);
+  c.def("simplify", &TSequence<float>::simplify<float>, py::arg("epsilon"), release_gil())
+      .def("simplifyMaxSpeed", &TSequence<float>::simplifyMaxSpeed<float>, py::arg("epsilon"),
+           release_gil());
+}
+
 template <> void _def_tsequence_class_specializations(py_tsequence<GeomPoint> &c,
                                                       std::string const &base_type_name) {
   c.def(py::init<std::set<TInstant<GeomPoint>> &, bool, bool, int, Interpolation>(),
         py::arg("instants"), py::arg("lower_inc") = true, py::arg("upper_inc") = false,
-        py::arg("srid") = 0, py::arg("interpolation") = default_interp_v<GeomPoint>)
+        py::arg("srid") = 0, py::arg("interpolation") = default_interp_v<GeomPoint>, release_gil())
       .def(py::init<std::set<std::string> &, bool, bool, int, Interpolation>(), py::arg("instants"),
            py::arg("lower_inc") = true, py::arg("upper_inc") = false, py::arg("srid") = 0,
+           py::arg("interpolation") = default_interp_v<GeomPoint>, release_gil())
+      .def(py::init<std::string, int>(), py::arg("serialized"), py::arg("srid"), release_gil())
+      .def(py::init([](py::object const &timestamps, py::object const &x, py::object const &y,
+                       py::object const &z, int srid, bool lower_inc, bool upper_inc,
+                       Interpolation interpolation) {
+             std::vector<time_point> ts = timestamps_from_numpy(timestamps);
+             std::vector<GeomPoint> points = points_from_numpy(x, y, z, srid);
+             py::gil_scoped_release release;
+             TemporalSet<GeomPoint>::sort_instants(ts, points);
+             return TSequence<GeomPoint>(std::move(ts), std::move(points), lower_inc, upper_inc,
+                                         interpolation);
+           }),
+           py::arg("timestamps"), py::arg("x"), py::arg("y"), py::arg("z") = py::none(),
+           py::arg("srid") = 0, py::arg("lower_inc") = true, py::arg("upper_inc") = false,
            py::arg("interpolation") = default_interp_v<GeomPoint>)
-      .def(py::init<std::string, int>(), py::arg("serialized"), py::arg("srid"));
+      .def("simplify", &TSequence<GeomPoint>::simplify<GeomPoint>, py::arg("epsilon"),
+           py::arg("synchronized") = false, release_gil())
+      .def("length", &TSequence<GeomPoint>::length<GeomPoint>, release_gil())
+      .def("cumulativeLength", &TSequence<GeomPoint>::cumulativeLength<GeomPoint>, release_gil())
+      .def("speed", &TSequence<GeomPoint>::speed<GeomPoint>, release_gil())
+      .def("azimuth", &TSequence<GeomPoint>::azimuth<GeomPoint>, release_gil())
+      .def("twCentroid", &TSequence<GeomPoint>::twCentroid<GeomPoint>, release_gil());
 }
 
 template <typename BaseType>
@@ -10,6 +10,7 @@
 #include <string>
 
 #include "common.hpp"
+#include "numpy.hpp"
 
 using namespace meos;
 namespace py = pybind11;
@@ -27,10 +28,24 @@ py_tsequenceset<BaseType> _def_tsequenceset_class_basic(py::module &m,
       m, "SeqSet", base_type_name);
   return py_tsequenceset<BaseType>(m, ("T" + base_type_name + "SeqSet").c_str())
       .def(py::init<std::set<TSequence<BaseType>> &, Interpolation>(), py::arg("sequences"),
-           py::arg("interpolation") = default_interp_v<BaseType>)
+           py::arg("interpolation") = default_interp_v<BaseType>, release_gil())
       .def(py::init<std::set<std::string> &, Interpolation>(), py::arg("sequences"),
+           py::arg("interpolation") = default_interp_v<BaseType>, release_gil())
+      .def(py::init<std::string>(), py::arg("serialized"), release_gil())
+      .def(py::init([](py::object const &timestamps, py::object const &values,
+                       py::object const &starts, bool lower_inc, bool upper_inc,
+                       Interpolation interpolation) {
+             std::vector<time_point> const ts = timestamps_from_numpy(timestamps);
+             std::vector<BaseType> const vs = values_from_numpy<BaseType>(values);
+             std::vector<int64_t> const offsets = numbers_from_numpy<int64_t>(starts);
+             py::gil_scoped_release release;
+             return TSequenceSet<BaseType>(
+                 sequences_from_numpy(ts, vs, offsets, lower_inc, upper_inc, interpolation),
+                 interpolation);
+           }),
+           py::arg("timestamps"), py::arg("values"), py::arg("starts"),
+           py::arg("lower_inc") = true, py::arg("upper_inc") = false,
            py::arg("interpolation") = default_interp_v<BaseType>)
-      .def(py::init<std::string>(), py::arg("serialized"))
       .def(py::self == py::self, py::arg("other"))
       .def(py::self != py::self, py::arg("other"))
       .def(py::self < py::self, py::arg("other"))
@@ -39,6 +54,7 @@ py_tsequenceset<BaseType> _def_tsequenceset_class_basic(py::module &m,
       .def(py::self >= py::self, py::arg("other"))
       .def("__str__", &to_ostream<TSequenceSet<BaseType>>)
       .def("__repr__", &to_ostream<TSequenceSet<BaseType>>)
+      .def("__hash__", &to_hash<TSequenceSet<BaseType>>)
       .def("compare", &TSequenceSet<BaseType>::compare, py::arg("other"))
       .def_property_readonly("duration", &TSequenceSet<BaseType>::duration)
       .def_property_readonly("interpolation", &TSequenceSet<BaseType>::interpolation)
@@ -53,9 +69,11 @@ py_tsequenceset<BaseType> _def_tsequenceset_class_basic(py::module &m,
       .def_property_readonly("timestamps", &TSequenceSet<BaseType>::timestamps)
       .def_property_readonly("getTime", &TSequenceSet<BaseType>::getTime)
       .def_property_readonly("period", &TSequenceSet<BaseType>::period)
-      .def("shift", &TSequenceSet<BaseType>::shift, py::arg("timedelta"))
-      .def("intersectsTimestamp", &TSequenceSet<BaseType>::intersectsTimestamp, py::arg("datetime"))
-      .def("intersectsPeriod", &TSequenceSet<BaseType>::intersectsPeriod, py::arg("period"));
+      .def("shift", &TSequenceSet<BaseType>::shift, py::arg("timedelta"), release_gil())
+      .def("intersectsTimestamp", &TSequenceSet<BaseType>::intersectsTimestamp, py::arg("datetime"),
+           release_gil())
+      .def("intersectsPeriod", &TSequenceSet<BaseType>::intersectsPeriod, py::arg("period"),
+           release_gil());
 }
 
 template <typename BaseType>
@@ -64,17 +82,55 @@ void _def_tsequenceset_class_specializations(py_tsequenceset<BaseType> &c,
   // No specializations by default
 }
 
+template <> void _def_tsequenceset_class_specializations(py_tsequenceset<int> &c,
+                                                         std::string const &base_type_name) {
+  def_time_weighted_average<TSequenceSet<int>>(c);
+}
+
+template <> void _def_tsequenceset_class_specializations(py_tsequenceset<float> &c,
+                                                         std::string const &base_type_name) {
+  def_time_weighted_average<TSequenceSet<float>>(c);
+}
+
 template <> void _def_tsequenceset_class_specializations(py_tsequenceset<GeomPoint> &c,
                                                          std::string const &base_type_name) {
   c.def(py::init<std::set<TSequence<GeomPoint>> &, int, Interpolation>(), py::arg("sequences"),
-        py::arg("srid"), py::arg("interpolation") = default_interp_v<GeomPoint>)
+        py::arg("srid"), py::arg("interpolation") = default_interp_v<GeomPoint>, release_gil())
       .def(py::init<std::set<std::string> &, int, Interpolation>(), py::arg("sequences"),
-           py::arg("srid"), py::arg("interpolation") = default_interp_v<GeomPoint>)
-      .def(py::init<std::string, int>(), py::arg("serialized"), py::arg("srid"));
+           py::arg("srid"), py::arg("interpolation") = default_interp_v<GeomPoint>, release_gil())
+      .def(py::init<std::string, int>(), py::arg("serialized"), py::arg("srid"), release_gil())
+      .def(py::init([](py::object const &timestamps, py::object const &x, py::object const &y,
+                       py::object const &starts, py::object const &z, int srid, bool lower_inc,
+                       bool upper_inc, Interpolation interpolation) {
+             std::vector<time_point> const ts = timestamps_from_numpy(timestamps);
+             std::vector<GeomPoint> const points = points_from_numpy(x, y, z, srid);
+             std::vector<int64_t> const offsets = numbers_from_numpy<int64_t>(starts);
+             py::gil_scoped_release release;
+             return TSequenceSet<GeomPoint>(
+                 sequences_from_numpy(ts, points, offsets, lower_inc, upper_inc, interpolation),
+                 srid, interpolation);
+           }),
+           py::arg("timestamps"), py::arg("x"), py::arg("y"), py::arg("starts"),
+           py::arg("z") = py::none(), py::arg("srid") = 0, py::arg("lower_inc") = true,
+           py::arg("upper_inc") = false, py::arg("interpolation") = default_interp_v<GeomPoint>)
+      .def(
+          "coordinatesArray",
+          [](TSequenceSet<GeomPoint> const &self) {
+            return coordinates_to_numpy(
+                concatenate(self, &TemporalSet<GeomPoint>::storedValues));
+          },
+          "Coordinates of the points of all the sequences, in order, with a row per instant")
+      .def("length", &TSequenceSet<GeomPoint>::length<GeomPoint>, release_gil())
+      .def("cumulativeLength", &TSequenceSet<GeomPoint>::cumulativeLength<GeomPoint>,
+           release_gil())
+      .def("speed", &TSequenceSet<GeomPoint>::speed<GeomPoint>, release_gil())
+      .def("azimuth", &TSequenceSet<GeomPoint>::azimuth<GeomPoint>, release_gil())
+      .def("twCentroid", &TSequenceSet<GeomPoint>::twCentroid<GeomPoint>, release_gil());
 }
 
 template <typename BaseType>
 void def_tsequenceset_class(py::module &m, std::string const &base_type_name) {
   auto tsequenceset_class = _def_tsequenceset_class_basic<BaseType>(m, base_type_name);
+  def_numpy_sequence_set_accessors<BaseType>(tsequenceset_class);
   _def_tsequenceset_class_specializations<BaseType>(tsequenceset_class, base_type_name);
 }
@@ -25,6 +25,7 @@ void def_temporal_types(py::module &m, std::string const &base_type_name) {
   def_tinstantset_class<BaseType>(m, base_type_name);
   def_tsequence_class<BaseType>(m, base_type_name);
   def_tsequenceset_class<BaseType>(m, base_type_name);
+  def_temporal_aggregates<BaseType>(m);
 }
 
 void def_temporal_module(py::module &m) {
@@ -34,11 +34,7 @@ void def_time_module(py::module &m) {
       .def(py::self >= py::self)
       .def("__str__", &to_ostream<Period>)
       .def("__repr__", &to_ostream<Period>)
-      .def("__hash__",
-           [](Period const &period) {
-             return py::hash(py::make_tuple(period.lower(), period.upper(), period.lower_inc(),
-                                            period.upper_inc()));
-           })
+      .def("__hash__", &to_hash<Period>)
       .def_property_readonly("lower", &Period::lower)
       .def_property_readonly("upper", &Period::upper)
       .def_property_readonly("lower_inc", &Period::lower_inc)
@@ -60,6 +56,7 @@ void def_time_module(py::module &m) {
       .def(py::self >= py::self)
       .def("__str__", &to_ostream<PeriodSet>)
       .def("__repr__", &to_ostream<PeriodSet>)
+      .def("__hash__", &to_hash<PeriodSet>)
       .def_property_readonly("periods", &PeriodSet::periods)
       .def_property_readonly("period", &PeriodSet::period)
       .def_property_readonly("numPeriods", &PeriodSet::numPeriods)
@@ -72,7 +69,33 @@ void def_time_module(py::module &m) {
       .def_property_readonly("endTimestamp", &PeriodSet::endTimestamp)
       .def("periodN", &PeriodSet::periodN, py::arg("n"))
       .def("shift", &PeriodSet::shift, py::arg("timedelta"))
-      .def("timestampN", &PeriodSet::timestampN, py::arg("n"));
+      .def("timestampN", &PeriodSet::timestampN, py::arg("n"))
+      .def("contains_timestamp", &PeriodSet::contains_timestamp, py::arg("timestamp"))
+      .def("overlap", py::overload_cast<Period const &>(&PeriodSet::overlap, py::const_),
+           py::arg("period"))
+      .def("overlap", py::overload_cast<PeriodSet const &>(&PeriodSet::overlap, py::const_),
+           py::arg("other"))
+      .def("union", py::overload_cast<Period const &>(&PeriodSet::union_, py::const_),
+           py::arg("period"))
+      .def("union", py::overload_cast<PeriodSet const &>(&PeriodSet::union_, py::const_),
+           py::arg("other"))
+      .def("union", py::overload_cast<TimestampSet const &>(&PeriodSet::union_, py::const_),
+           py::arg("timestampset"))
+      .def("intersection",
+           py::overload_cast<Period const &>(&PeriodSet::intersection, py::const_),
+           py::arg("period"))
+      .def("intersection",
+           py::overload_cast<PeriodSet const &>(&PeriodSet::intersection, py::const_),
+           py::arg("other"))
+      .def("intersection",
+           py::overload_cast<TimestampSet const &>(&PeriodSet::intersection, py::const_),
+           py::arg("timestampset"))
+      .def("minus", py::overload_cast<Period const &>(&PeriodSet::minus, py::const_),
+           py::arg("period"))
+      .def("minus", py::overload_cast<PeriodSet const &>(&PeriodSet::minus, py::const_),
+           py::arg("other"))
+      .def("minus", py::overload_cast<TimestampSet const &>(&PeriodSet::minus, py::const_),
+           py::arg("timestampset"));
 
   py::class_<TimestampSet>(time_module, "TimestampSet")
       .def(py::init<std::set<time_point> &>(), py::arg("timestamps"))
@@ -86,6 +109,7 @@ void def_time_module(py::module &m) {
       .def(py::self >= py::self)
       .def("__str__", &to_ostream<TimestampSet>)
       .def("__repr__", &to_ostream<TimestampSet>)
+      .def("__hash__", &to_hash<TimestampSet>)
       .def_property_readonly("periods", &TimestampSet::periods)
       .def_property_readonly("period", &TimestampSet::period)
       .def_property_readonly("numPeriods", &TimestampSet::numPeriods)
@@ -98,5 +122,33 @@ void def_time_module(py::module &m) {
       .def_property_readonly("endTimestamp", &TimestampSet::endTimestamp)
       .def("periodN", &TimestampSet::periodN, py::arg("n"))
       .def("shift", &TimestampSet::shift, py::arg("timedelta"))
-      .def("timestampN", &TimestampSet::timestampN, py::arg("n"));
+      .def("timestampN", &TimestampSet::timestampN, py::arg("n"))
+      .def("contains_timestamp", &TimestampSet::contains_timestamp, py::arg("timestamp"))
+      .def("contains_timestamps", &TimestampSet::contains_timestamps, py::arg("timestamps"))
+      .def("contains_any",
+           py::overload_cast<std::vector<time_point> const &>(&TimestampSet::contains_any,
+                                                              py::const_),
+           py::arg("timestamps"))
+      .def("overlap", &TimestampSet::overlap, py::arg("period"))
+      .def("union", py::overload_cast<TimestampSet const &>(&TimestampSet::union_, py::const_),
+           py::arg("other"))
+      .def("union", py::overload_cast<Period const &>(&TimestampSet::union_, py::const_),
+           py::arg("period"))
+      .def("union", py::overload_cast<PeriodSet const &>(&TimestampSet::union_, py::const_),
+           py::arg("periodset"))
+      .def("intersection",
+           py::overload_cast<TimestampSet const &>(&TimestampSet::intersection, py::const_),
+           py::arg("other"))
+      .def("intersection",
+           py::overload_cast<Period const &>(&TimestampSet::intersection, py::const_),
+           py::arg("period"))
+      .def("intersection",
+           py::overload_cast<PeriodSet const &>(&TimestampSet::intersection, py::const_),
+           py::arg("periodset"))
+      .def("minus", py::overload_cast<TimestampSet const &>(&TimestampSet::minus, py::const_),
+           py::arg("other"))
+      .def("minus", py::overload_cast<Period const &>(&TimestampSet::minus, py::const_),
+           py::arg("period"))
+      .def("minus", py::overload_cast<PeriodSet const &>(&TimestampSet::minus, py::const_),
+           py::arg("periodset"));
 }
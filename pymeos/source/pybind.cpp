@@ -17,7 +17,7 @@ using namespace meos;
 namespace py = pybind11;
 
 PYBIND11_MODULE(_pymeos, m) {
-  // TODO will we ever get a chance to do finish_geos()?
+  // Each thread gets its own GEOS context, finished when the thread exits
   init_geos();
   def_geompoint_class(m);
 
@@ -118,8 +118,11 @@ if platform.system() == "Windows":
 else:
     extra_compile_args.append('-std=c++14')
     extra_compile_args.append('-g0')
+    extra_compile_args.append('-pthread')
 
 extra_link_args = geos_paths.get("extra_link_args", [])
+if platform.system() != "Windows":
+    extra_link_args.append('-pthread')
 
 setup(
     ext_modules=[
@@ -2,10 +2,37 @@
 
 namespace meos {
 
-GEOSContextHandle_t geos_context = NULL;
+namespace {
 
-void init_geos() { geos_context = GEOS_init_r(); }
+/**
+ * Owns the GEOS context of a thread, finishing it when the thread exits.
+ */
+struct ThreadGEOSContext {
+  GEOSContextHandle_t handle = nullptr;
 
-void finish_geos() { GEOS_finish_r(geos_context); }
+  void finish() {
+    if (handle != nullptr) GEOS_finish_r(handle);
+    handle = nullptr;
+  }
+
+  ~ThreadGEOSContext() { finish(); }
+};
+
+thread_local ThreadGEOSContext thread_geos_context;
+
+}  // namespace
+
+GEOSContextHandle_t geos_context() {
+  if (thread_geos_context.handle == nullptr) thread_geos_context.handle = GEOS_init_r();
+  return thread_geos_context.handle;
+}
+
+void init_geos() { geos_context(); }
+
+void finish_geos() { thread_geos_context.finish(); }
+
+void GEOSGeometryDeleter::operator()(GEOSGeometry *geom) const {
+  GEOSGeom_destroy_r(geos_context(), geom);
+}
 
 }  // namespace meos
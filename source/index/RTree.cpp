@@ -0,0 +1,289 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <meos/index/RTree.hpp>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+
+namespace meos {
+using namespace std;
+
+namespace {
+
+/**
+ * Center of the bounds along a dimension: 0, 1, 2 and 3 being x, y, z and t.
+ * Missing dimensions are centered at zero, to keep them comparable.
+ */
+template <typename Bounds> double center(Bounds const &b, size_t const dim) {
+  double c;
+  switch (dim) {
+    case 0:
+      c = (b.xmin + b.xmax) / 2;
+      break;
+    case 1:
+      c = (b.ymin + b.ymax) / 2;
+      break;
+    case 2:
+      c = (b.zmin + b.zmax) / 2;
+      break;
+    default:
+      c = static_cast<double>(b.tmin) / 2 + static_cast<double>(b.tmax) / 2;
+  }
+  return isfinite(c) ? c : 0;
+}
+
+template <typename Bounds> bool overlaps(Bounds const &a, Bounds const &b) {
+  return a.xmin <= b.xmax && b.xmin <= a.xmax && a.ymin <= b.ymax && b.ymin <= a.ymax
+         && a.zmin <= b.zmax && b.zmin <= a.zmax && a.tmin <= b.tmax && b.tmin <= a.tmax;
+}
+
+template <typename Bounds> void expand(Bounds &a, Bounds const &b) {
+  a.xmin = min(a.xmin, b.xmin);
+  a.ymin = min(a.ymin, b.ymin);
+  a.zmin = min(a.zmin, b.zmin);
+  a.tmin = min(a.tmin, b.tmin);
+  a.xmax = max(a.xmax, b.xmax);
+  a.ymax = max(a.ymax, b.ymax);
+  a.zmax = max(a.zmax, b.zmax);
+  a.tmax = max(a.tmax, b.tmax);
+}
+
+/**
+ * Euclidean distance between the spatial dimensions, or infinity if the
+ * bounds don't overlap in time.
+ */
+template <typename Bounds> double distance(Bounds const &a, Bounds const &b) {
+  if (a.tmax < b.tmin || b.tmax < a.tmin) return numeric_limits<double>::infinity();
+  double const dx = max(0.0, max(a.xmin, b.xmin) - min(a.xmax, b.xmax));
+  double const dy = max(0.0, max(a.ymin, b.ymin) - min(a.ymax, b.ymax));
+  double const dz = max(0.0, max(a.zmin, b.zmin) - min(a.zmax, b.zmax));
+  return sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+template <typename Bounds> Bounds to_bounds(STBox const &box) {
+  return {box.xmin(),
+          box.ymin(),
+          box.zmin(),
+          box.xmax(),
+          box.ymax(),
+          box.zmax(),
+          static_cast<int64_t>(box.tmin().time_since_epoch().count()),
+          static_cast<int64_t>(box.tmax().time_since_epoch().count())};
+}
+
+/**
+ * Sort-Tile-Recursive ordering. The items are sorted along the first
+ * dimension and cut into slabs, then each slab is ordered along the remaining
+ * dimensions the same way. Consecutive runs of capacity items end up close
+ * to each other along all the dimensions.
+ */
+template <typename Iterator, typename GetBounds>
+void str_order(Iterator begin, Iterator end, size_t const capacity, size_t const *dims,
+               size_t const num_dims, GetBounds const &get_bounds) {
+  if (num_dims == 0) return;
+  size_t const dim = dims[0];
+  using T = typename iterator_traits<Iterator>::value_type;
+  sort(begin, end, [&](T const &a, T const &b) {
+    return center(get_bounds(a), dim) < center(get_bounds(b), dim);
+  });
+  if (num_dims == 1) return;
+
+  size_t const count = end - begin;
+  double const pages = ceil(static_cast<double>(count) / capacity);
+  double const slabs = ceil(pow(pages, 1.0 / num_dims));
+  size_t const slab_size = capacity * static_cast<size_t>(ceil(pages / slabs));
+  for (Iterator slab = begin; slab != end;) {
+    Iterator const slab_end = slab + min(slab_size, static_cast<size_t>(end - slab));
+    str_order(slab, slab_end, capacity, dims + 1, num_dims - 1, get_bounds);
+    slab = slab_end;
+  }
+}
+
+}  // namespace
+
+RTree::RTree(vector<STBox> const &boxes, size_t node_capacity) : m_node_capacity(node_capacity) {
+  if (node_capacity < 2) {
+    throw invalid_argument("The node capacity must be at least 2");
+  }
+  m_entries.reserve(boxes.size());
+  for (STBox const &box : boxes) m_entries.push_back(to_bounds<Bounds>(box));
+  m_positions.resize(boxes.size());
+  iota(m_positions.begin(), m_positions.end(), 0);
+  build();
+}
+
+void RTree::build() {
+  size_t const n = m_entries.size();
+  if (n == 0) return;
+
+  // Only order along the dimensions some box actually has
+  size_t dims[4];
+  size_t num_dims = 0;
+  bool has_x = false, has_z = false, has_t = false;
+  for (Bounds const &b : m_entries) {
+    has_x = has_x || isfinite(b.xmin);
+    has_z = has_z || isfinite(b.zmin);
+    has_t = has_t || b.tmin != numeric_limits<int64_t>::min();
+  }
+  if (has_x) {
+    dims[num_dims++] = 0;
+    dims[num_dims++] = 1;
+  }
+  if (has_z) dims[num_dims++] = 2;
+  if (has_t) dims[num_dims++] = 3;
+
+  // Leaves, packed from the entries in STR order
+  vector<size_t> order(n);
+  iota(order.begin(), order.end(), 0);
+  str_order(order.begin(), order.end(), m_node_capacity, dims, num_dims,
+            [this](size_t i) -> Bounds const & { return m_entries[i]; });
+  vector<Bounds> entries;
+  entries.reserve(n);
+  for (size_t i : order) entries.push_back(m_entries[i]);
+  m_entries = move(entries);
+  m_positions = move(order);
+
+  for (size_t begin = 0; begin < n; begin += m_node_capacity) {
+    size_t const end = min(begin + m_node_capacity, n);
+    Node node = {m_entries[begin], begin, end};
+    for (size_t i = begin + 1; i < end; i++) expand(node.bounds, m_entries[i]);
+    m_nodes.push_back(node);
+  }
+  m_num_leaves = m_nodes.size();
+
+  // Upper levels, each packed from the one below in STR order, up to the root
+  size_t level_begin = 0;
+  while (m_nodes.size() - level_begin > 1) {
+    size_t const level_end = m_nodes.size();
+    str_order(m_nodes.begin() + level_begin, m_nodes.begin() + level_end, m_node_capacity, dims,
+              num_dims, [](Node const &node) -> Bounds const & { return node.bounds; });
+    for (size_t begin = level_begin; begin < level_end; begin += m_node_capacity) {
+      size_t const end = min(begin + m_node_capacity, level_end);
+      Node node = {m_nodes[begin].bounds, begin, end};
+      for (size_t i = begin + 1; i < end; i++) expand(node.bounds, m_nodes[i].bounds);
+      m_nodes.push_back(node);
+    }
+    level_begin = level_end;
+  }
+}
+
+size_t RTree::size() const { return m_entries.size(); }
+
+vector<size_t> RTree::window(STBox const &query) const {
+  vector<size_t> result;
+  if (m_nodes.empty()) return result;
+
+  Bounds const q = to_bounds<Bounds>(query);
+  vector<size_t> stack = {m_nodes.size() - 1};
+  while (!stack.empty()) {
+    size_t const index = stack.back();
+    stack.pop_back();
+    Node const &node = m_nodes[index];
+    if (!overlaps(node.bounds, q)) continue;
+    if (is_leaf(index)) {
+      for (size_t i = node.begin; i < node.end; i++) {
+        if (overlaps(m_entries[i], q)) result.push_back(m_positions[i]);
+      }
+    } else {
+      for (size_t i = node.begin; i < node.end; i++) stack.push_back(i);
+    }
+  }
+  return result;
+}
+
+vector<size_t> RTree::nearest(STBox const &query, size_t k) const {
+  Bounds const q = to_bounds<Bounds>(query);
+  if (!isfinite(q.xmin)) {
+    throw invalid_argument("Nearest neighbour queries need a box with spatial dimensions");
+  }
+
+  vector<size_t> result;
+  if (m_nodes.empty() || k == 0) return result;
+
+  // Best-first search: nodes and entries are visited closest first, so an
+  // entry coming out of the queue is nearer than anything still in it
+  struct Candidate {
+    double distance;
+    size_t index;
+    bool is_entry;
+    bool operator>(Candidate const &other) const { return distance > other.distance; }
+  };
+  priority_queue<Candidate, vector<Candidate>, greater<Candidate>> queue;
+  size_t const root = m_nodes.size() - 1;
+  queue.push({distance(m_nodes[root].bounds, q), root, false});
+
+  while (!queue.empty() && result.size() < k) {
+    Candidate const candidate = queue.top();
+    queue.pop();
+    if (isinf(candidate.distance)) break;
+    if (candidate.is_entry) {
+      result.push_back(m_positions[candidate.index]);
+      continue;
+    }
+    Node const &node = m_nodes[candidate.index];
+    bool const leaf = is_leaf(candidate.index);
+    for (size_t i = node.begin; i < node.end; i++) {
+      double const d = distance(leaf ? m_entries[i] : m_nodes[i].bounds, q);
+      if (!isinf(d)) queue.push({d, i, leaf});
+    }
+  }
+  return result;
+}
+
+vector<pair<size_t, size_t>> RTree::join(RTree const &other) const {
+  vector<pair<size_t, size_t>> result;
+  if (m_nodes.empty() || other.m_nodes.empty()) return result;
+
+  vector<pair<size_t, size_t>> stack = {{m_nodes.size() - 1, other.m_nodes.size() - 1}};
+  vector<size_t> left, right;
+  while (!stack.empty()) {
+    size_t const a_index = stack.back().first;
+    size_t const b_index = stack.back().second;
+    stack.pop_back();
+    Node const &a = m_nodes[a_index];
+    Node const &b = other.m_nodes[b_index];
+    bool const a_leaf = is_leaf(a_index);
+    bool const b_leaf = other.is_leaf(b_index);
+
+    if (a_leaf && b_leaf) {
+      for (size_t i = a.begin; i < a.end; i++) {
+        if (!overlaps(m_entries[i], b.bounds)) continue;
+        for (size_t j = b.begin; j < b.end; j++) {
+          if (overlaps(m_entries[i], other.m_entries[j])) {
+            result.emplace_back(m_positions[i], other.m_positions[j]);
+          }
+        }
+      }
+      continue;
+    }
+
+    // Descend on the sides that are not leaves yet, only keeping the children
+    // overlapping the node on the other side
+    left.clear();
+    right.clear();
+    if (a_leaf) {
+      left.push_back(a_index);
+    } else {
+      for (size_t i = a.begin; i < a.end; i++) {
+        if (overlaps(m_nodes[i].bounds, b.bounds)) left.push_back(i);
+      }
+    }
+    if (b_leaf) {
+      right.push_back(b_index);
+    } else {
+      for (size_t j = b.begin; j < b.end; j++) {
+        if (overlaps(other.m_nodes[j].bounds, a.bounds)) right.push_back(j);
+      }
+    }
+    for (size_t i : left) {
+      for (size_t j : right) {
+        if (overlaps(m_nodes[i].bounds, other.m_nodes[j].bounds)) stack.emplace_back(i, j);
+      }
+    }
+  }
+  return result;
+}
+
+}  // namespace meos
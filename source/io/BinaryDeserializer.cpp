@@ -0,0 +1,318 @@
+#include <cstring>
+#include <meos/io/BinaryDeserializer.hpp>
+#include <meos/io/DeserializationException.hpp>
+#include <string>
+
+namespace meos {
+using namespace std;
+
+namespace {
+
+// PostgreSQL timestamps count microseconds since 2000-01-01
+int64_t const postgres_epoch_us = 946684800000000L;
+
+uint32_t read_uint32(unsigned char const *p, bool little_endian) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; i++) value = (value << 8) | p[little_endian ? 3 - i : i];
+  return value;
+}
+
+double read_double(unsigned char const *p, bool little_endian) {
+  uint64_t bits = 0;
+  for (int i = 0; i < 8; i++) bits = (bits << 8) | p[little_endian ? 7 - i : i];
+  double value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+/**
+ * Smallest number of bytes an instant can take, with its timestamp and the
+ * length of its value. Used for rejecting counts that can't possibly fit in
+ * the input before allocating for them.
+ */
+template <typename T> size_t min_instant_size() { return 8 + 4 + sizeof(T); }
+template <> size_t min_instant_size<bool>() { return 8 + 4 + 1; }
+template <> size_t min_instant_size<float>() { return 8 + 4 + 8; }
+template <> size_t min_instant_size<string>() { return 8 + 4; }
+template <> size_t min_instant_size<GeomPoint>() { return 8 + 4 + 21; }
+
+}  // namespace
+
+template <typename T> BinaryDeserializer<T>::BinaryDeserializer(string const &in_) : in(in_) {}
+
+template <typename T> bool BinaryDeserializer<T>::hasNext() const { return pos < in.size(); }
+
+template <typename T> unsigned char const *BinaryDeserializer<T>::take(size_t n) {
+  if (in.size() - pos < n) {
+    throw DeserializationException("Unexpected end of input: expected " + to_string(n)
+                                   + " more byte(s) at position " + to_string(pos));
+  }
+  auto p = reinterpret_cast<unsigned char const *>(in.data()) + pos;
+  pos += n;
+  return p;
+}
+
+template <typename T> uint8_t BinaryDeserializer<T>::nextUInt8() { return *take(1); }
+
+template <typename T> uint32_t BinaryDeserializer<T>::nextUInt32() {
+  return read_uint32(take(4), false);
+}
+
+template <typename T> uint64_t BinaryDeserializer<T>::nextUInt64() {
+  unsigned char const *p = take(8);
+  uint64_t value = 0;
+  for (int i = 0; i < 8; i++) value = (value << 8) | p[i];
+  return value;
+}
+
+template <typename T> double BinaryDeserializer<T>::nextDouble() {
+  return read_double(take(8), false);
+}
+
+template <typename T> time_point BinaryDeserializer<T>::nextTime() {
+  int64_t const us = static_cast<int64_t>(nextUInt64()) + postgres_epoch_us;
+  return time_point(chrono::duration_cast<time_point::duration>(chrono::microseconds(us)));
+}
+
+template <typename T> T BinaryDeserializer<T>::nextValue() { return readValue(in.size() - pos); }
+
+template <typename T> T BinaryDeserializer<T>::readValue(size_t) {
+  // Check specialized template functions below for supported types
+  throw DeserializationException("Unsupported type");
+}
+
+template <> bool BinaryDeserializer<bool>::readValue(size_t) {
+  uint8_t value = nextUInt8();
+  if (value > 1) {
+    throw DeserializationException("Boolean value can only be 0 or 1, got: " + to_string(value));
+  }
+  return value == 1;
+}
+
+template <> int BinaryDeserializer<int>::readValue(size_t) {
+  return static_cast<int32_t>(nextUInt32());
+}
+
+template <> float BinaryDeserializer<float>::readValue(size_t) {
+  return static_cast<float>(nextDouble());
+}
+
+template <> string BinaryDeserializer<string>::readValue(size_t size) {
+  return string(reinterpret_cast<char const *>(take(size)), size);
+}
+
+template <> GeomPoint BinaryDeserializer<GeomPoint>::readValue(size_t) {
+  uint8_t const byte_order = nextUInt8();
+  if (byte_order > 1) {
+    throw DeserializationException("Invalid WKB byte order: " + to_string(byte_order));
+  }
+  bool const little_endian = byte_order == 1;
+
+  uint32_t const type = read_uint32(take(4), little_endian);
+  if ((type & 0x0fffffff) != 1) {
+    throw DeserializationException("Only points are supported, got WKB type: "
+                                   + to_string(type & 0x0fffffff));
+  }
+  bool const has_z = type & 0x80000000;
+  int const srid = type & 0x20000000 ? read_uint32(take(4), little_endian) : 0;
+
+  unsigned char const *p = take(has_z ? 24 : 16);
+  double const x = read_double(p, little_endian);
+  double const y = read_double(p + 8, little_endian);
+  if (has_z) return GeomPoint(x, y, read_double(p + 16, little_endian), srid);
+  return GeomPoint(x, y, srid);
+}
+
+template <typename T> void BinaryDeserializer<T>::consumeDuration(TemporalDuration expected) {
+  uint8_t const duration = nextUInt8();
+  if (duration != static_cast<uint8_t>(expected)) {
+    throw DeserializationException("Expected temporal duration "
+                                   + to_string(static_cast<uint8_t>(expected))
+                                   + ", got: " + to_string(duration));
+  }
+}
+
+template <typename T> size_t BinaryDeserializer<T>::nextCount(size_t min_size) {
+  size_t const count = nextUInt32();
+  if (count > (in.size() - pos) / min_size) {
+    throw DeserializationException("Unexpected end of input: not enough bytes left for "
+                                   + to_string(count) + " item(s)");
+  }
+  return count;
+}
+
+template <typename T> T BinaryDeserializer<T>::readSizedValue() {
+  size_t const size = nextUInt32();
+  size_t const start = pos;
+  take(size);
+  pos = start;
+  T value = readValue(size);
+  if (pos - start != size) {
+    throw DeserializationException("Expected a value of " + to_string(size)
+                                   + " byte(s) at position " + to_string(start) + ", got "
+                                   + to_string(pos - start));
+  }
+  return value;
+}
+
+template <typename T>
+void BinaryDeserializer<T>::nextInstants(size_t count, vector<time_point> &timestamps,
+                                         vector<T> &values) {
+  timestamps.reserve(count);
+  values.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    timestamps.push_back(nextTime());
+    values.push_back(readSizedValue());
+  }
+}
+
+template <typename T> unique_ptr<Temporal<T>> BinaryDeserializer<T>::nextTemporal() {
+  // Look at the duration without consuming it
+  switch (static_cast<TemporalDuration>(*take(1))) {
+    case TemporalDuration::Instant:
+      pos--;
+      return nextTInstant();
+    case TemporalDuration::InstantSet:
+      pos--;
+      return nextTInstantSet();
+    case TemporalDuration::Sequence:
+      pos--;
+      return nextTSequence();
+    case TemporalDuration::SequenceSet:
+      pos--;
+      return nextTSequenceSet();
+    default:
+      throw DeserializationException("Invalid Temporal");
+  }
+}
+
+template <typename T> unique_ptr<TInstant<T>> BinaryDeserializer<T>::nextTInstant() {
+  consumeDuration(TemporalDuration::Instant);
+  time_point const t = nextTime();
+  return make_unique<TInstant<T>>(readSizedValue(), t);
+}
+
+template <typename T> unique_ptr<TInstantSet<T>> BinaryDeserializer<T>::nextTInstantSet() {
+  consumeDuration(TemporalDuration::InstantSet);
+  vector<time_point> timestamps;
+  vector<T> values;
+  nextInstants(nextCount(min_instant_size<T>()), timestamps, values);
+  return make_unique<TInstantSet<T>>(move(timestamps), move(values));
+}
+
+template <typename T> TSequence<T> BinaryDeserializer<T>::readTSequence() {
+  size_t const count = nextCount(min_instant_size<T>());
+  bool const lower_inc = nextUInt8();
+  bool const upper_inc = nextUInt8();
+  Interpolation const interpolation
+      = nextUInt8() ? Interpolation::Linear : Interpolation::Stepwise;
+
+  vector<time_point> timestamps;
+  vector<T> values;
+  nextInstants(count, timestamps, values);
+  return TSequence<T>(move(timestamps), move(values), lower_inc, upper_inc, interpolation);
+}
+
+template <typename T> unique_ptr<TSequence<T>> BinaryDeserializer<T>::nextTSequence() {
+  consumeDuration(TemporalDuration::Sequence);
+  return make_unique<TSequence<T>>(readTSequence());
+}
+
+template <typename T> unique_ptr<TSequenceSet<T>> BinaryDeserializer<T>::nextTSequenceSet() {
+  consumeDuration(TemporalDuration::SequenceSet);
+  // Each sequence takes at least its count, bounds and interpolation
+  size_t const count = nextCount(4 + 3);
+  set<TSequence<T>> sequences;
+  for (size_t i = 0; i < count; i++) sequences.insert(sequences.end(), readTSequence());
+  // The set takes the interpolation of its sequences, which must all agree
+  return make_unique<TSequenceSet<T>>(move(sequences));
+}
+
+template <typename T> Period BinaryDeserializer<T>::readPeriod() {
+  time_point const lower = nextTime();
+  time_point const upper = nextTime();
+  bool const lower_inc = nextUInt8();
+  bool const upper_inc = nextUInt8();
+  return Period(lower, upper, lower_inc, upper_inc);
+}
+
+template <typename T> unique_ptr<Period> BinaryDeserializer<T>::nextPeriod() {
+  return make_unique<Period>(readPeriod());
+}
+
+template <typename T> unique_ptr<PeriodSet> BinaryDeserializer<T>::nextPeriodSet() {
+  size_t const count = nextCount(8 + 8 + 1 + 1);
+  set<Period> periods;
+  for (size_t i = 0; i < count; i++) periods.insert(periods.end(), readPeriod());
+  return make_unique<PeriodSet>(periods);
+}
+
+template <typename T> unique_ptr<TimestampSet> BinaryDeserializer<T>::nextTimestampSet() {
+  size_t const count = nextCount(8);
+  set<time_point> timestamps;
+  for (size_t i = 0; i < count; i++) timestamps.insert(timestamps.end(), nextTime());
+  return make_unique<TimestampSet>(timestamps);
+}
+
+template <typename T> unique_ptr<TBox> BinaryDeserializer<T>::nextTBox() {
+  bool const has_x = nextUInt8();
+  bool const has_t = nextUInt8();
+
+  double xmin = 0, xmax = 0;
+  if (has_x) {
+    xmin = nextDouble();
+    xmax = nextDouble();
+  }
+  time_point tmin, tmax;
+  if (has_t) {
+    tmin = nextTime();
+    tmax = nextTime();
+  }
+
+  if (has_x && has_t) return make_unique<TBox>(xmin, tmin, xmax, tmax);
+  if (has_x) return make_unique<TBox>(xmin, xmax);
+  if (has_t) return make_unique<TBox>(tmin, tmax);
+  return make_unique<TBox>();
+}
+
+template <typename T> unique_ptr<STBox> BinaryDeserializer<T>::nextSTBox() {
+  bool const has_x = nextUInt8();
+  bool const has_z = nextUInt8();
+  bool const has_t = nextUInt8();
+  bool const geodetic = nextUInt8();
+  int const srid = static_cast<int32_t>(nextUInt32());
+
+  double xmin = 0, xmax = 0, ymin = 0, ymax = 0, zmin = 0, zmax = 0;
+  if (has_x) {
+    xmin = nextDouble();
+    xmax = nextDouble();
+    ymin = nextDouble();
+    ymax = nextDouble();
+  }
+  if (has_z) {
+    zmin = nextDouble();
+    zmax = nextDouble();
+  }
+  time_point tmin, tmax;
+  if (has_t) {
+    tmin = nextTime();
+    tmax = nextTime();
+  }
+
+  if (has_x && has_z && has_t) {
+    return make_unique<STBox>(xmin, ymin, zmin, tmin, xmax, ymax, zmax, tmax, srid, geodetic);
+  }
+  if (has_x && has_z) return make_unique<STBox>(xmin, ymin, zmin, xmax, ymax, zmax, srid, geodetic);
+  if (has_x && has_t) return make_unique<STBox>(xmin, ymin, tmin, xmax, ymax, tmax, srid);
+  if (has_x) return make_unique<STBox>(xmin, ymin, xmax, ymax, srid);
+  if (has_t) return make_unique<STBox>(tmin, tmax, srid, geodetic);
+  return make_unique<STBox>();
+}
+
+template class BinaryDeserializer<bool>;
+template class BinaryDeserializer<int>;
+template class BinaryDeserializer<float>;
+template class BinaryDeserializer<string>;
+template class BinaryDeserializer<GeomPoint>;
+
+}  // namespace meos
@@ -0,0 +1,261 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <meos/io/BinarySerializer.hpp>
+#include <meos/io/SerializationException.hpp>
+#include <string>
+
+namespace meos {
+using namespace std;
+
+namespace {
+
+// PostgreSQL timestamps count microseconds since 2000-01-01
+int64_t const postgres_epoch_us = 946684800000000L;
+
+void put_uint8(string &out, uint8_t value) { out.push_back(static_cast<char>(value)); }
+
+void put_uint32(string &out, uint32_t value) {
+  char bytes[4];
+  for (int i = 3; i >= 0; i--, value >>= 8) bytes[i] = static_cast<char>(value & 0xff);
+  out.append(bytes, 4);
+}
+
+// Overwrites the 4 bytes at pos, e.g. a length written before knowing it
+void set_uint32(string &out, size_t pos, uint32_t value) {
+  for (int i = 3; i >= 0; i--, value >>= 8) out[pos + i] = static_cast<char>(value & 0xff);
+}
+
+void put_uint64(string &out, uint64_t value) {
+  char bytes[8];
+  for (int i = 7; i >= 0; i--, value >>= 8) bytes[i] = static_cast<char>(value & 0xff);
+  out.append(bytes, 8);
+}
+
+void put_double(string &out, double value) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  put_uint64(out, bits);
+}
+
+void put_time(string &out, time_point const &t) {
+  int64_t us = chrono::duration_cast<chrono::microseconds>(t.time_since_epoch()).count();
+  put_uint64(out, static_cast<uint64_t>(us - postgres_epoch_us));
+}
+
+// Little endian, as EWKB is usually written in
+void put_wkb_uint32(string &out, uint32_t value) {
+  for (int i = 0; i < 4; i++, value >>= 8) out.push_back(static_cast<char>(value & 0xff));
+}
+
+void put_wkb_double(string &out, double value) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  for (int i = 0; i < 8; i++, bits >>= 8) out.push_back(static_cast<char>(bits & 0xff));
+}
+
+}  // namespace
+
+template <typename T> void BinarySerializer<T>::append(string &, T const &) {
+  // Check specialized template functions below for supported types
+  throw SerializationException("Unsupported type");
+}
+
+template <> void BinarySerializer<bool>::append(string &out, bool const &value) {
+  put_uint8(out, value ? 1 : 0);
+}
+
+template <> void BinarySerializer<int>::append(string &out, int const &value) {
+  put_uint32(out, static_cast<uint32_t>(value));
+}
+
+template <> void BinarySerializer<float>::append(string &out, float const &value) {
+  put_double(out, value);
+}
+
+template <> void BinarySerializer<string>::append(string &out, string const &value) {
+  out.append(value);
+}
+
+template <> void BinarySerializer<GeomPoint>::append(string &out, GeomPoint const &value) {
+  uint32_t type = 1;  // Point
+  if (value.has_z()) type |= 0x80000000;
+  if (value.srid() != 0) type |= 0x20000000;
+
+  put_uint8(out, 1);  // NDR
+  put_wkb_uint32(out, type);
+  if (value.srid() != 0) put_wkb_uint32(out, static_cast<uint32_t>(value.srid()));
+  put_wkb_double(out, value.x());
+  put_wkb_double(out, value.y());
+  if (value.has_z()) put_wkb_double(out, value.z());
+}
+
+template <typename T> void BinarySerializer<T>::append(string &out, TInstant<T> const &instant) {
+  put_time(out, instant.getTimestamp());
+  size_t const length_pos = out.size();
+  put_uint32(out, 0);
+  append(out, instant.getValue());
+  set_uint32(out, length_pos, static_cast<uint32_t>(out.size() - length_pos - 4));
+}
+
+template <typename T>
+void BinarySerializer<T>::append(string &out, TInstantSet<T> const &instant_set) {
+  size_t const n = instant_set.numInstants();
+  put_uint32(out, static_cast<uint32_t>(n));
+  for (size_t i = 0; i < n; i++) append(out, instant_set.instantN(i));
+}
+
+template <typename T> void BinarySerializer<T>::append(string &out, TSequence<T> const &sequence) {
+  size_t const n = sequence.numInstants();
+  put_uint32(out, static_cast<uint32_t>(n));
+  put_uint8(out, sequence.lower_inc());
+  put_uint8(out, sequence.upper_inc());
+  put_uint8(out, sequence.interpolation() == Interpolation::Linear);
+  for (size_t i = 0; i < n; i++) append(out, sequence.instantN(i));
+}
+
+template <typename T>
+void BinarySerializer<T>::append(string &out, TSequenceSet<T> const &sequence_set) {
+  // Each sequence repeats the interpolation
+  auto const &sequences = sequence_set.orderedSequences();
+  put_uint32(out, static_cast<uint32_t>(sequences.size()));
+  for (auto const *sequence : sequences) append(out, *sequence);
+}
+
+template <typename T> void BinarySerializer<T>::append(string &out, Period const &period) {
+  put_time(out, period.lower());
+  put_time(out, period.upper());
+  put_uint8(out, period.lower_inc());
+  put_uint8(out, period.upper_inc());
+}
+
+template <typename T> string BinarySerializer<T>::write(Temporal<T> const *temporal) {
+  switch (temporal->duration()) {
+    case TemporalDuration::Instant:
+      return write(static_cast<TInstant<T> const *>(temporal));
+    case TemporalDuration::InstantSet:
+      return write(static_cast<TInstantSet<T> const *>(temporal));
+    case TemporalDuration::Sequence:
+      return write(static_cast<TSequence<T> const *>(temporal));
+    case TemporalDuration::SequenceSet:
+      return write(static_cast<TSequenceSet<T> const *>(temporal));
+    default:
+      throw SerializationException("Unsupported type");
+  }
+}
+
+template <typename T> string BinarySerializer<T>::write(TInstant<T> const *instant) {
+  string out;
+  put_uint8(out, static_cast<uint8_t>(TemporalDuration::Instant));
+  append(out, *instant);
+  return out;
+}
+
+template <typename T> string BinarySerializer<T>::write(TInstantSet<T> const *instant_set) {
+  string out;
+  put_uint8(out, static_cast<uint8_t>(TemporalDuration::InstantSet));
+  append(out, *instant_set);
+  return out;
+}
+
+template <typename T> string BinarySerializer<T>::write(TSequence<T> const *sequence) {
+  string out;
+  put_uint8(out, static_cast<uint8_t>(TemporalDuration::Sequence));
+  append(out, *sequence);
+  return out;
+}
+
+template <typename T> string BinarySerializer<T>::write(TSequenceSet<T> const *sequence_set) {
+  string out;
+  put_uint8(out, static_cast<uint8_t>(TemporalDuration::SequenceSet));
+  append(out, *sequence_set);
+  return out;
+}
+
+template <typename T> string BinarySerializer<T>::write(Period const *period) {
+  string out;
+  append(out, *period);
+  return out;
+}
+
+template <typename T> string BinarySerializer<T>::write(PeriodSet const *period_set) {
+  string out;
+  set<Period> const periods = period_set->periods();
+  put_uint32(out, static_cast<uint32_t>(periods.size()));
+  for (auto const &period : periods) append(out, period);
+  return out;
+}
+
+template <typename T> string BinarySerializer<T>::write(TimestampSet const *timestamp_set) {
+  string out;
+  set<time_point> const timestamps = timestamp_set->timestamps();
+  put_uint32(out, static_cast<uint32_t>(timestamps.size()));
+  for (auto const &t : timestamps) put_time(out, t);
+  return out;
+}
+
+template <typename T> string BinarySerializer<T>::write(TBox const *tbox) {
+  bool const has_x = tbox->xmin() != -INFINITY;
+  bool const has_t = tbox->tmin() != time_point(time_point::duration::min());
+
+  string out;
+  put_uint8(out, has_x);
+  put_uint8(out, has_t);
+  if (has_x) {
+    put_double(out, tbox->xmin());
+    put_double(out, tbox->xmax());
+  }
+  if (has_t) {
+    put_time(out, tbox->tmin());
+    put_time(out, tbox->tmax());
+  }
+  return out;
+}
+
+template <typename T> string BinarySerializer<T>::write(STBox const *stbox) {
+  bool const has_x = stbox->xmin() != -INFINITY;
+  bool const has_z = stbox->zmin() != -INFINITY;
+  bool const has_t = stbox->tmin() != time_point(time_point::duration::min());
+
+  string out;
+  put_uint8(out, has_x);
+  put_uint8(out, has_z);
+  put_uint8(out, has_t);
+  put_uint8(out, stbox->geodetic());
+  put_uint32(out, static_cast<uint32_t>(stbox->srid()));
+  if (has_x) {
+    put_double(out, stbox->xmin());
+    put_double(out, stbox->xmax());
+    put_double(out, stbox->ymin());
+    put_double(out, stbox->ymax());
+  }
+  if (has_z) {
+    put_double(out, stbox->zmin());
+    put_double(out, stbox->zmax());
+  }
+  if (has_t) {
+    put_time(out, stbox->tmin());
+    put_time(out, stbox->tmax());
+  }
+  return out;
+}
+
+template <typename T> string BinarySerializer<T>::write(T const &value) {
+  string out;
+  append(out, value);
+  return out;
+}
+
+template <typename T> string BinarySerializer<T>::writeTime(time_point const &t) {
+  string out;
+  put_time(out, t);
+  return out;
+}
+
+template class BinarySerializer<bool>;
+template class BinarySerializer<int>;
+template class BinarySerializer<float>;
+template class BinarySerializer<string>;
+template class BinarySerializer<GeomPoint>;
+
+}  // namespace meos
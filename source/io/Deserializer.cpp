@@ -1,18 +1,60 @@
 #include <algorithm>
-#include <ctime>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
 #include <meos/io/DeserializationException.hpp>
 #include <meos/io/Deserializer.hpp>
 #include <meos/io/utils.hpp>
-#include <sstream>
 #include <string>
 
 namespace meos {
 using namespace std;
 
+namespace {
+
+/**
+ * Values read without a SRID take the one from the enclosing prefix, if any.
+ * This only means something for geometries.
+ */
+template <typename T> void apply_srid(T &, int) {}
+
+void apply_srid(GeomPoint &value, int srid) {
+  if (srid == 0) return;
+  if (value.srid() == 0) {
+    value = value.with_srid(srid);
+  } else if (value.srid() != srid) {
+    throw invalid_argument("Conflicting SRIDs provided. Given: " + to_string(srid)
+                           + ", while Geometry contains: " + to_string(value.srid()));
+  }
+}
+
+}  // namespace
+
 template <typename T> Deserializer<T>::Deserializer(string const &in_) : in(in_) {
   iter = in.begin();
 }
 
+template <typename T> int Deserializer<T>::nextSRID() {
+  // Check specialized template function below for geometries
+  return 0;
+}
+
+template <> int Deserializer<GeomPoint>::nextSRID() {
+  skipWhitespaces();
+  if (in.compare(iter - in.begin(), 4, "SRID") != 0) {
+    return 0;
+  }
+  iter += 4;
+  skipWhitespaces();
+  consumeChar('=');
+  int srid = nextInt();
+  skipWhitespaces();
+  consumeChar(';');
+  return srid;
+}
+
 template <typename T> unique_ptr<Temporal<T>> Deserializer<T>::nextTemporal() {
   skipWhitespaces();
   auto current_pos = iter - in.begin();
@@ -61,83 +103,159 @@ template <typename T> unique_ptr<Temporal<T>> Deserializer<T>::nextTemporal() {
 }
 
 template <typename T> unique_ptr<TSequenceSet<T>> Deserializer<T>::nextTSequenceSet() {
-  string::size_type current_pos = iter - in.begin();
-  string s = in.substr(current_pos, 2048);
-  stringstream ss(s);
-  TSequenceSet<T> t;
-  ss >> t;
-  iter += ss.tellg();
-  return make_unique<TSequenceSet<T>>(t);
+  int srid = nextSRID();
+  Interpolation interp = nextInterpolation();
+  skipWhitespaces();
+  consumeChar('{');
+
+  set<TSequence<T>> sequences;
+  char c;
+  do {
+    sequences.insert(readTSequence(srid));
+    c = consumeOneOf(",}");
+  } while (c == ',');
+
+  return make_unique<TSequenceSet<T>>(sequences, interp);
 }
 
 template <typename T> unique_ptr<TSequence<T>> Deserializer<T>::nextTSequence() {
-  string::size_type current_pos = iter - in.begin();
-  string s = in.substr(current_pos, 2048);
-  stringstream ss(s);
-  TSequence<T> t;
-  ss >> t;
-  iter += ss.tellg();
-  return make_unique<TSequence<T>>(t);
+  return make_unique<TSequence<T>>(readTSequence(0));
+}
+
+template <typename T> TSequence<T> Deserializer<T>::readTSequence(int outer_srid) {
+  int srid = nextSRID();
+  if (srid == 0) {
+    srid = outer_srid;
+  } else if (outer_srid != 0 && srid != outer_srid) {
+    throw invalid_argument("Conflicting SRIDs provided. Given: " + to_string(outer_srid)
+                           + ", while Sequence contains: " + to_string(srid));
+  }
+  Interpolation interp = nextInterpolation();
+
+  bool const lower_inc = consumeOneOf("[(") == '[';
+  vector<time_point> timestamps;
+  vector<T> values;
+  bool const upper_inc = nextInstants(timestamps, values, "])", srid) == ']';
+
+  return TSequence<T>(move(timestamps), move(values), lower_inc, upper_inc, interp);
 }
 
 template <typename T> unique_ptr<TInstantSet<T>> Deserializer<T>::nextTInstantSet() {
-  string::size_type current_pos = iter - in.begin();
-  string s = in.substr(current_pos, 2048);
-  stringstream ss(s);
-  TInstantSet<T> t;
-  ss >> t;
-  iter += ss.tellg();
-  return make_unique<TInstantSet<T>>(t);
+  int srid = nextSRID();
+  skipWhitespaces();
+  consumeChar('{');
+
+  vector<time_point> timestamps;
+  vector<T> values;
+  nextInstants(timestamps, values, "}", srid);
+
+  return make_unique<TInstantSet<T>>(move(timestamps), move(values));
+}
+
+template <typename T>
+char Deserializer<T>::nextInstants(vector<time_point> &timestamps, vector<T> &values,
+                                   char const *closing, int srid) {
+  string const separators = string(",") + closing;
+  char c;
+  do {
+    T value = nextValue();
+    apply_srid(value, srid);
+    skipWhitespaces();
+    consumeChar('@');
+    timestamps.push_back(nextTime());
+    values.push_back(move(value));
+    c = consumeOneOf(separators.c_str());
+  } while (c == ',');
+
+  TemporalSet<T>::sort_instants(timestamps, values);
+  return c;
 }
 
 template <typename T> unique_ptr<TInstant<T>> Deserializer<T>::nextTInstant() {
-  string::size_type current_pos = iter - in.begin();
-  string s = in.substr(current_pos, 2048);
-  stringstream ss(s);
-  TInstant<T> t;
-  ss >> t;
-  iter += ss.tellg();
-  return make_unique<TInstant<T>>(t);
+  T value = nextValue();
+  skipWhitespaces();
+  consumeChar('@');
+  time_point t = nextTime();
+  return make_unique<TInstant<T>>(value, t);
 }
 
 template <typename T> unique_ptr<Period> Deserializer<T>::nextPeriod() {
-  // TODO refactor Deserializer to simplify this futher
-  string::size_type current_pos = iter - in.begin();
-  string s = in.substr(current_pos, 256);
-  stringstream ss(s);
-  Period period;
-  ss >> period;
-  iter += ss.tellg();
-  return period.clone();
+  return make_unique<Period>(readPeriod());
+}
+
+template <typename T> Period Deserializer<T>::readPeriod() {
+  bool const lower_inc = consumeOneOf("[(") == '[';
+  time_point lower = nextTime();
+  consumeOneOf(",");
+  time_point upper = nextTime();
+  bool const upper_inc = consumeOneOf(")]") == ']';
+  return Period(lower, upper, lower_inc, upper_inc);
 }
 
 template <typename T> unique_ptr<PeriodSet> Deserializer<T>::nextPeriodSet() {
-  string::size_type current_pos = iter - in.begin();
-  string s = in.substr(current_pos, 2048);
-  stringstream ss(s);
-  PeriodSet period_set;
-  ss >> period_set;
-  iter += ss.tellg();
-  return period_set.clone();
+  skipWhitespaces();
+  consumeChar('{');
+
+  set<Period> periods;
+  char c;
+  do {
+    periods.insert(readPeriod());
+    c = consumeOneOf(",}");
+  } while (c == ',');
+
+  return make_unique<PeriodSet>(periods);
 }
 
 template <typename T> unique_ptr<TimestampSet> Deserializer<T>::nextTimestampSet() {
-  string::size_type current_pos = iter - in.begin();
-  string s = in.substr(current_pos, 2048);
-  stringstream ss(s);
-  TimestampSet timestamp_set;
-  ss >> timestamp_set;
-  iter += ss.tellg();
-  return make_unique<TimestampSet>(timestamp_set);
+  skipWhitespaces();
+  consumeChar('{');
+
+  set<time_point> timestamps;
+  char c;
+  do {
+    timestamps.insert(timestamps.end(), nextTime());
+    c = consumeOneOf(",}");
+  } while (c == ',');
+
+  return make_unique<TimestampSet>(timestamps);
 }
 
 template <typename T> time_point Deserializer<T>::nextTime() {
-  string::size_type current_pos = iter - in.begin();
-  string s = in.substr(current_pos, 256);
-  stringstream ss(s);
-  auto t = meos::nextTime(ss);
-  iter += ss.tellg();
-  return t;
+  skipWhitespaces();
+  // Parse directly from the input, without copying the time out of it
+  string::size_type end_pos = in.find_first_of(",)]}\n", iter - in.begin());
+  char const *begin = in.data() + (iter - in.begin());
+  iter = end_pos == string::npos ? in.end() : in.begin() + end_pos;
+  return parse_ISO8601(begin, in.data() + (iter - in.begin()));
+}
+
+template <typename T> Interpolation Deserializer<T>::nextInterpolation() {
+  // If not specified, we stick with the default value
+  // (Stepwise for discrete base types, Linear otherwise)
+  skipWhitespaces();
+  if (in.compare(iter - in.begin(), 6, "Interp") != 0) {
+    return default_interp_v<T>;
+  }
+  iter += 6;
+  skipWhitespaces();
+  consumeChar('=');
+
+  Interpolation interp;
+  string interp_string = nextUntilOneOf("; \n\t");
+  if (interp_string == "Stepwise") {
+    interp = Interpolation::Stepwise;
+  } else if (interp_string == "Linear") {
+    if (is_discrete_v<T>) {
+      throw invalid_argument("Cannot assign linear interpolation to a discrete base type");
+    }
+    interp = Interpolation::Linear;
+  } else {
+    throw invalid_argument("Unsupported interpolation specified: " + interp_string);
+  }
+
+  skipWhitespaces();
+  consumeChar(';');
+  return interp;
 }
 
 template <typename T> T Deserializer<T>::nextValue() {
@@ -147,98 +265,85 @@ template <typename T> T Deserializer<T>::nextValue() {
 
 template <> bool Deserializer<bool>::nextValue() {
   skipWhitespaces();
-  string s = string(iter, in.end());
-  string::size_type current_pos = iter - in.begin();
-  string::size_type end_pos = in.find_first_of(" @\n", current_pos);
-  if (end_pos == string::npos) {
-    end_pos = in.end() - in.begin();
-  }
-  size_t length = end_pos - current_pos;
-  string input = in.substr(current_pos, length);
+  string input = nextUntilOneOf(" @\n");
   transform(input.begin(), input.end(), input.begin(), ::tolower);
 
-  bool value;
   if (input == "t" || input == "true") {
-    value = true;
+    return true;
   } else if (input == "f" || input == "false") {
-    value = false;
-  } else {
-    throw DeserializationException("Boolean value can only be one of (t, f, true, false), but got: "
-                                   + input);
+    return false;
   }
-
-  iter += length;
-  return value;
+  throw DeserializationException("Boolean value can only be one of (t, f, true, false), but got: "
+                                 + input);
 }
 
-template <> int Deserializer<int>::nextValue() {
-  skipWhitespaces();
-  string s = string(iter, in.end());
-  string::size_type length;
-  int value = stoi(s, &length, 10);
-  iter += length;
-  return value;
-}
+template <> int Deserializer<int>::nextValue() { return nextInt(); }
 
 template <> float Deserializer<float>::nextValue() {
   skipWhitespaces();
-  string s = string(iter, in.end());
-  string::size_type length;
-  float value = stof(s, &length);
-  iter += length;
+  char const *begin = in.c_str() + (iter - in.begin());
+  char *end;
+  errno = 0;
+  float value = strtof(begin, &end);
+  if (end == begin) {
+    throw DeserializationException("Could not parse: invalid argument");
+  }
+  if (errno == ERANGE) {
+    throw DeserializationException("Could not parse: out of range");
+  }
+  iter += end - begin;
   return value;
 }
 
 template <> string Deserializer<string>::nextValue() {
   skipWhitespaces();
-  string::size_type current_pos = iter - in.begin();
-  string::size_type end_pos = in.find_first_of("@", current_pos);
-  if (end_pos == string::npos) {
-    end_pos = in.end() - in.begin();
+  string input = nextUntilOneOf("@");
+  size_t length = input.length();
+
+  if (length <= 0) {
+    throw DeserializationException("Could not parse text: empty, unquoted value");
   }
-  size_t length = end_pos - current_pos;
-  string input = in.substr(current_pos, length);
 
   // Skip double quotes if present
-  if (length >= 2 && input[0] == '"' && input[input.length() - 1] == '"') {
+  if (length >= 2 && input[0] == '"' && input[length - 1] == '"') {
     input = input.substr(1, length - 2);
   }
 
-  if (length <= 0) {
-    throw DeserializationException("Could not parse text: empty, unquoted value");
-  }
-
-  iter += length;
   return input;
 }
 
 template <> GeomPoint Deserializer<GeomPoint>::nextValue() {
-  string::size_type current_pos = iter - in.begin();
-  string s = in.substr(current_pos, 2048);
-  stringstream ss(s);
-  GeomPoint value;
-  ss >> value;
-  iter += ss.tellg();
-  return value;
+  skipWhitespaces();
+  return GeomPoint(nextUntilOneOf("@"));
 }
 
 template <typename T> int Deserializer<T>::nextInt() {
   skipWhitespaces();
-  try {
-    string s = string(iter, in.end());
-    string::size_type length;
-    int ivalue = stoi(s, &length, 10);
-    iter += length;
-    return ivalue;
-  } catch (invalid_argument &) {
+  auto it = iter;
+  bool negative = false;
+  if (it != in.end() && (*it == '+' || *it == '-')) {
+    negative = *it == '-';
+    it++;
+  }
+  if (it == in.end() || !isdigit(static_cast<unsigned char>(*it))) {
     throw DeserializationException("Could not parse: invalid argument");
-  } catch (out_of_range &) {
-    throw DeserializationException("Could not parse: out of range");
   }
+
+  long long const limit = static_cast<long long>(INT_MAX) + (negative ? 1 : 0);
+  long long value = 0;
+  for (; it != in.end() && isdigit(static_cast<unsigned char>(*it)); it++) {
+    value = value * 10 + (*it - '0');
+    if (value > limit) {
+      throw DeserializationException("Could not parse: out of range");
+    }
+  }
+
+  iter = it;
+  return static_cast<int>(negative ? -value : value);
 }
 
 template <typename T> char Deserializer<T>::peek(int lookahead) {
-  if ((in.end() - iter) < lookahead) {
+  if ((in.end() - iter) <= lookahead) {
     throw DeserializationException("Reached end of stream");
   };
   return *(iter + lookahead);
@@ -247,23 +352,32 @@ template <typename T> char Deserializer<T>::peek(int lookahead) {
 template <typename T> void Deserializer<T>::skipWhitespaces() { skipChars(" \t\n"); }
 
 template <typename T> void Deserializer<T>::consumeChar(char const c) {
-  string::size_type current_pos = iter - in.begin();
-  if (*iter != c) {
-    std::stringstream error;
-    error << "Expected character '" << c << "' at position " << current_pos;
-    throw DeserializationException(error.str());
+  if (!hasNext() || *iter != c) {
+    throw DeserializationException("Expected character '" + string(1, c) + "' at position "
+                                   + to_string(iter - in.begin()));
   }
   iter += 1;
 }
 
-template <typename T> void Deserializer<T>::skipChars(string const &chars) {
-  string::size_type current_pos = iter - in.begin();
-  string::size_type end_pos = in.find_first_not_of(chars, current_pos);
-  if (end_pos == string::npos) {
-    end_pos = in.end() - in.begin();
+template <typename T> char Deserializer<T>::consumeOneOf(char const *chars) {
+  skipWhitespaces();
+  if (!hasNext() || *iter == '\0' || strchr(chars, *iter) == nullptr) {
+    throw DeserializationException("Expected one of '" + string(chars) + "' at position "
+                                   + to_string(iter - in.begin()));
   }
-  size_t length = end_pos - current_pos;
-  iter += length;
+  return *iter++;
+}
+
+template <typename T> void Deserializer<T>::skipChars(string const &chars) {
+  string::size_type end_pos = in.find_first_not_of(chars, iter - in.begin());
+  iter = end_pos == string::npos ? in.end() : in.begin() + end_pos;
+}
+
+template <typename T> string Deserializer<T>::nextUntilOneOf(char const *stop_chars) {
+  string::size_type end_pos = in.find_first_of(stop_chars, iter - in.begin());
+  auto begin = iter;
+  iter = end_pos == string::npos ? in.end() : in.begin() + end_pos;
+  return string(begin, iter);
 }
 
 template <typename T> bool Deserializer<T>::hasNext() { return iter != in.end(); }
@@ -9,15 +9,14 @@ using namespace std;
 
 template <typename T> string Serializer<T>::write(Temporal<T> const *temporal) {
   stringstream ss;
-  if (TInstant<T> const *instant = reinterpret_cast<TInstant<T> const *>(temporal)) {
+  if (TInstant<T> const *instant = dynamic_cast<TInstant<T> const *>(temporal)) {
     return write(instant);
-  } else if (TInstantSet<T> const *instant_set
-             = reinterpret_cast<TInstantSet<T> const *>(temporal)) {
+  } else if (TInstantSet<T> const *instant_set = dynamic_cast<TInstantSet<T> const *>(temporal)) {
     return write(instant_set);
-  } else if (TSequence<T> const *sequence = reinterpret_cast<TSequence<T> const *>(temporal)) {
+  } else if (TSequence<T> const *sequence = dynamic_cast<TSequence<T> const *>(temporal)) {
     return write(sequence);
   } else if (TSequenceSet<T> const *sequence_set
-             = reinterpret_cast<TSequenceSet<T> const *>(temporal)) {
+             = dynamic_cast<TSequenceSet<T> const *>(temporal)) {
     return write(sequence_set);
   }
   throw SerializationException("Unsupported type");
@@ -0,0 +1,40 @@
+#include <meos/io/Deserializer.hpp>
+#include <meos/io/Serializer.hpp>
+#include <meos/io/batch.hpp>
+#include <meos/util/parallel.hpp>
+
+namespace meos {
+using namespace std;
+
+template <typename T> vector<unique_ptr<Temporal<T>>> read_temporals(
+    vector<string> const &serialized, size_t num_threads) {
+  vector<unique_ptr<Temporal<T>>> temporals(serialized.size());
+  parallel_for(
+      serialized.size(),
+      [&](size_t i) { temporals[i] = Deserializer<T>(serialized[i]).nextTemporal(); },
+      num_threads);
+  return temporals;
+}
+
+template <typename T> vector<string> write_temporals(vector<Temporal<T> const *> const &temporals,
+                                                     size_t num_threads) {
+  vector<string> serialized(temporals.size());
+  parallel_for(
+      temporals.size(),
+      [&](size_t i) { serialized[i] = Serializer<T>().write(temporals[i]); }, num_threads);
+  return serialized;
+}
+
+template vector<unique_ptr<Temporal<bool>>> read_temporals(vector<string> const &, size_t);
+template vector<unique_ptr<Temporal<int>>> read_temporals(vector<string> const &, size_t);
+template vector<unique_ptr<Temporal<float>>> read_temporals(vector<string> const &, size_t);
+template vector<unique_ptr<Temporal<string>>> read_temporals(vector<string> const &, size_t);
+template vector<unique_ptr<Temporal<GeomPoint>>> read_temporals(vector<string> const &, size_t);
+
+template vector<string> write_temporals(vector<Temporal<bool> const *> const &, size_t);
+template vector<string> write_temporals(vector<Temporal<int> const *> const &, size_t);
+template vector<string> write_temporals(vector<Temporal<float> const *> const &, size_t);
+template vector<string> write_temporals(vector<Temporal<string> const *> const &, size_t);
+template vector<string> write_temporals(vector<Temporal<GeomPoint> const *> const &, size_t);
+
+}  // namespace meos
@@ -1,15 +1,10 @@
 #include <algorithm>
 #include <meos/io/utils.hpp>
 #include <meos/types/geom/GeomPoint.hpp>
-#include <meos/util/string.hpp>
-#include <sstream>
+#include <meos/util/time.hpp>
 #include <stdexcept>
 #include <string>
 
-#ifdef _MSC_VER
-#  define timegm _mkgmtime
-#endif
-
 namespace meos {
 using namespace std;
 
@@ -69,122 +64,7 @@ template <> GeomPoint nextValue(istream &in) {
   in >> std::ws;
   string input = read_until_one_of(in, "@");
 
-  GeomPoint value(input);
-
-  if (value.geom == nullptr) {
-    throw std::invalid_argument("Could not parse geometry");
-  }
-
-  return value;
-}
-
-void validate_normalized_ISO8601(const string &s) {
-  if (s.size() != 28) {
-    throw invalid_argument(
-        "Expected in YYYY-MM-DDThh:mm:ss.uuu+ZZZZ format "
-        "(28 characters), got: "
-        + s);
-  }
-
-  if ((s[4] != '-') || (s[7] != '-')) {
-    throw invalid_argument("Expected date in YYYY-MM-DD format, got: " + s);
-  }
-
-  // TODO check 1<= month <= 12
-  // TODO check date according to year and month
-
-  if ((s[10] != ' ') && (s[10] != 'T')) {
-    throw invalid_argument("Expected either a space or a 'T' after day, got: '" + string(1, s[10])
-                           + "'");
-  }
-
-  if (s[13] != ':') {
-    throw invalid_argument("Expected time in hh:mm:ss format, got: " + s);
-  }
-
-  if (s[16] != ':') {
-    throw invalid_argument("Expected time in hh:mm:ss format, got: " + s);
-  }
-
-  if (s[19] != '.') {
-    throw invalid_argument("Expected milliseconds after time, got: " + s);
-  }
-
-  // Milliseconds should be three characters
-  if ((s[23] != '+') && (s[23] != '-')) {
-    throw invalid_argument("Expected either a '+' or a '-' after time, got: '" + string(1, s[23])
-                           + "'");
-  }
-}
-
-string normalized_ISO8601(string s) {
-  auto length = s.length();
-
-  if (length < 10 || length > 28) {
-    throw invalid_argument(
-        "Empty or unexpected length for the provided ISO 8601 "
-        "date/time string: "
-        + s);
-  }
-
-  if (length == 10) {  // 1234-12-12
-    s += " 00:00:00.000+0000";
-  } else if (length == 16) {  // 1234-12-12T12:12
-    s += ":00.000+0000";
-  } else if (length == 19) {  // 1234-12-12T12:12:12
-    s += ".000+0000";
-  } else if (length == 20) {  // 1234-12-12T12:12:12Z
-    if (s[19] != 'Z') {
-      throw invalid_argument(
-          "For a ISO8601 string of length 20, "
-          "expected 'Z' as the last character, got: '"
-          + string(1, s[19]) + "'");
-    }
-    s[19] = '.';
-    s += "000+0000";
-  } else if (s[19] == '.') {  // 1234-12-12T12:12:12.[...]
-    // Milliseconds present - one character at min, three characters at max
-    size_t tz_pos = s.find_first_of("+-Z", 21, 3);
-    if (21 <= tz_pos && tz_pos <= 23) {
-      // TZ also present
-      size_t zeros = 23 - tz_pos;
-      string zero_padded_ms = string('0', zeros);
-      string tz = s.substr(20);
-      if (tz.length() == 2) {
-        tz += "00";
-      } else if (tz.length() != 4) {
-        throw invalid_argument(
-            "Unexpected tz offset: has to be either two or "
-            "four characters long. Ex: +05, +0530, got: "
-            + s);
-      }
-      s = s.substr(0, 19) + zero_padded_ms + "+" + tz;
-    } else if (tz_pos == string::npos) {
-      // TZ not present
-      size_t zeros = 23 - s.size();
-      string zero_padded_ms = string('0', zeros);
-      s = s.substr(0, 19) + zero_padded_ms + "+0000";
-    } else {
-      // TZ also (possibly) present, but beyond three characters
-      throw invalid_argument(
-          "Unexpected pattern, milliseconds can have a min "
-          "of 1 characters and max of 3 characters, got: "
-          + s);
-    }
-  } else {
-    // Milliseconds not present
-    if (length == 22) {  // 1234-12-12T12:12:12+05
-      s = s.substr(0, 19) + ".000" + s.substr(19) + "00";
-    } else if (length == 24) {  // 1234-12-12T12:12:12+0530
-      s = s.substr(0, 19) + ".000" + s.substr(19);
-    } else {
-      throw invalid_argument("Unexpected pattern, got: " + s);
-    }
-  }
-
-  validate_normalized_ISO8601(s);
-
-  return s;
+  return GeomPoint(input);
 }
 
 /**
@@ -201,59 +81,124 @@ string normalized_ISO8601(string s) {
  * 1234-12-12T12:12:12.000
  * 1234-12-12 12:12:12.000Z
  * 1234-12-12 12:12:12.000+05
- * 1234-12-12 12:12:12.000+05
- * 1234-12-12 12:12:12.000-0530  // normalized pattern
+ * 1234-12-12 12:12:12.000+05:30
+ * 1234-12-12 12:12:12.000-0530
  */
 time_point nextTime(istream &in) {
+  in >> std::ws;
+  return parse_ISO8601(read_until_one_of(in, ",)]}\n"));
+}
+
+time_point parse_ISO8601(string const &s) { return parse_ISO8601(s.data(), s.data() + s.size()); }
+
+namespace {
+
+bool is_space(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+bool is_digit(char c) { return '0' <= c && c <= '9'; }
+
+// Reads exactly n digits, throwing if there are not enough of them
+int read_digits(char const *&p, char const *end, int n, char const *begin) {
+  int value = 0;
+  for (int i = 0; i < n; i++, p++) {
+    if (p == end || !is_digit(*p)) {
+      throw invalid_argument("Expected a digit in ISO8601 date/time string at position "
+                             + to_string(p - begin) + ", got: " + string(begin, end));
+    }
+    value = value * 10 + (*p - '0');
+  }
+  return value;
+}
+
+void expect(char const *&p, char const *end, char c, char const *begin) {
+  if (p == end || *p != c) {
+    throw invalid_argument("Expected '" + string(1, c) + "' in ISO8601 date/time string, got: "
+                           + string(begin, end));
+  }
+  p++;
+}
+
+}  // namespace
+
+time_point parse_ISO8601(char const *begin, char const *end) {
   // TODO allow strings like 2012-1-1 instead of just 2012-01-01
 
-  in >> std::ws;
-  string s = read_until_one_of(in, ",)]}\n");
-  s = trim(s);
-  size_t length = s.length();
-
-  if (length != 28) {
-    // We assume normalized patterns going forward (length 24)
-    // If not already normalized, we normalize first and then parse
-    s = normalized_ISO8601(s);
+  while (begin != end && is_space(*begin)) begin++;
+  while (begin != end && is_space(*(end - 1))) end--;
+
+  char const *p = begin;
+  int const year = read_digits(p, end, 4, begin);
+  expect(p, end, '-', begin);
+  unsigned const month = read_digits(p, end, 2, begin);
+  expect(p, end, '-', begin);
+  unsigned const day = read_digits(p, end, 2, begin);
+
+  if (month < 1 || month > 12) {
+    throw invalid_argument("Month has to be between 1 and 12, got: " + string(begin, end));
+  }
+  if (day < 1 || day > days_in_month(year, month)) {
+    throw invalid_argument("Day is out of range for the month, got: " + string(begin, end));
   }
 
-  validate_normalized_ISO8601(s);
-  stringstream ss(s);
-
-  tm time = {};
-  ss >> time.tm_year;
-  consume_one_of(ss, "-");
-  ss >> time.tm_mon;
-  consume_one_of(ss, "-");
-  ss >> time.tm_mday;
-
-  time.tm_year -= 1900;
-  time.tm_mon -= 1;
-
-  ss.get();  // skip the character
-  ss >> time.tm_hour;
-  consume_one_of(ss, ":");
-  ss >> time.tm_min;
-  consume_one_of(ss, ":");
-  ss >> time.tm_sec;
-
-  time.tm_isdst = 0;
-  int millis = 0;
-  if (ss.peek() == '.') {
-    consume(ss, '.');
-    ss >> millis;
+  int hour = 0, minute = 0, second = 0, millis = 0, tz_offset_secs = 0;
+
+  if (p != end) {
+    if (*p != ' ' && *p != 'T') {
+      throw invalid_argument("Expected either a space or a 'T' after day, got: '"
+                             + string(1, *p) + "'");
+    }
+    p++;
+    hour = read_digits(p, end, 2, begin);
+    expect(p, end, ':', begin);
+    minute = read_digits(p, end, 2, begin);
+
+    if (p != end && *p == ':') {
+      p++;
+      second = read_digits(p, end, 2, begin);
+
+      if (p != end && *p == '.') {
+        p++;
+        // Fractions beyond milliseconds are accepted, but truncated
+        char const *fraction = p;
+        for (int scale = 100; p != end && is_digit(*p); p++, scale /= 10) {
+          millis += (*p - '0') * scale;
+        }
+        if (p == fraction || p - fraction > 9) {
+          throw invalid_argument(
+              "Unexpected pattern, fractional seconds can have a min of 1 characters and max of "
+              "9 characters, got: "
+              + string(begin, end));
+        }
+      }
+    }
+
+    if (hour > 23 || minute > 59 || second > 60) {
+      throw invalid_argument("Time is out of range, got: " + string(begin, end));
+    }
+
+    if (p != end) {
+      if (*p == 'Z') {
+        p++;
+      } else if (*p == '+' || *p == '-') {
+        int const sign = *p++ == '+' ? 1 : -1;
+        int const h_offset = read_digits(p, end, 2, begin);
+        int m_offset = 0;
+        if (p != end) {
+          if (*p == ':') p++;
+          m_offset = read_digits(p, end, 2, begin);
+        }
+        tz_offset_secs = sign * (h_offset * 60 + m_offset) * 60;
+      }
+    }
   }
 
-  int sign = (consume_one_of(ss, "+-") == '+') ? 1 : -1;
-  int offset;
-  ss >> offset;
-  int h_offset = offset / 100;
-  int m_offset = offset % 100;
-  int tz_offset_secs = sign * (h_offset * 60 + m_offset) * 60;
+  if (p != end) {
+    throw invalid_argument("Unexpected pattern, got: " + string(begin, end));
+  }
 
-  duration_ms duration((timegm(&time) - tz_offset_secs) * 1000L + millis);
-  return time_point(duration);
+  int64_t const secs = days_from_civil(year, month, day) * 86400 + hour * 3600 + minute * 60
+                       + second - tz_offset_secs;
+  return time_point(duration_ms(secs * 1000 + millis));
 }
 
 void consume(istream &in, char expectedCharacter, bool skip_ws) {
@@ -1,6 +1,8 @@
+#include <algorithm>
 #include <cmath>
 #include <meos/io/utils.hpp>
 #include <meos/types/box/STBox.hpp>
+#include <meos/util/hash.hpp>
 #include <meos/util/serializing.hpp>
 #include <sstream>
 #include <string>
@@ -172,6 +174,80 @@ bool STBox::has_y() const { return this->m_ymin != -INFINITY; }
 bool STBox::has_z() const { return this->m_zmin != -INFINITY; }
 bool STBox::has_t() const { return this->m_tmin != time_point(time_point::duration::min()); }
 
+void STBox::ensure_same_srid(STBox const &other) const {
+  if (this->has_x() && other.has_x() && this->srid() != other.srid()) {
+    throw invalid_argument("Operation on boxes with different SRIDs: " + to_string(this->srid())
+                           + " and " + to_string(other.srid()));
+  }
+}
+
+bool STBox::overlaps(STBox const &other) const {
+  this->ensure_same_srid(other);
+  return this->m_xmin <= other.m_xmax && other.m_xmin <= this->m_xmax
+         && this->m_ymin <= other.m_ymax && other.m_ymin <= this->m_ymax
+         && this->m_zmin <= other.m_zmax && other.m_zmin <= this->m_zmax
+         && this->m_tmin <= other.m_tmax && other.m_tmin <= this->m_tmax;
+}
+
+bool STBox::contains(STBox const &other) const {
+  this->ensure_same_srid(other);
+  return this->m_xmin <= other.m_xmin && other.m_xmax <= this->m_xmax
+         && this->m_ymin <= other.m_ymin && other.m_ymax <= this->m_ymax
+         && this->m_zmin <= other.m_zmin && other.m_zmax <= this->m_zmax
+         && this->m_tmin <= other.m_tmin && other.m_tmax <= this->m_tmax;
+}
+
+bool STBox::adjacent(STBox const &other) const {
+  if (!this->overlaps(other)) return false;
+  // Missing dimensions are unbounded, so their intersection is never flat
+  return max(this->m_xmin, other.m_xmin) == min(this->m_xmax, other.m_xmax)
+         || max(this->m_ymin, other.m_ymin) == min(this->m_ymax, other.m_ymax)
+         || max(this->m_zmin, other.m_zmin) == min(this->m_zmax, other.m_zmax)
+         || max(this->m_tmin, other.m_tmin) == min(this->m_tmax, other.m_tmax);
+}
+
+STBox STBox::expand(double const distance) const {
+  STBox box = *this;
+  if (this->has_x()) {
+    box.m_xmin -= distance;
+    box.m_ymin -= distance;
+    box.m_xmax += distance;
+    box.m_ymax += distance;
+  }
+  if (this->has_z()) {
+    box.m_zmin -= distance;
+    box.m_zmax += distance;
+  }
+  box.validate();
+  return box;
+}
+
+STBox STBox::expand(duration_ms const interval) const {
+  STBox box = *this;
+  if (this->has_t()) {
+    box.m_tmin -= interval;
+    box.m_tmax += interval;
+  }
+  box.validate();
+  return box;
+}
+
+STBox STBox::union_(STBox const &other) const {
+  this->ensure_same_srid(other);
+  STBox box = *this;
+  box.m_xmin = min(this->m_xmin, other.m_xmin);
+  box.m_ymin = min(this->m_ymin, other.m_ymin);
+  box.m_zmin = min(this->m_zmin, other.m_zmin);
+  box.m_tmin = min(this->m_tmin, other.m_tmin);
+  box.m_xmax = max(this->m_xmax, other.m_xmax);
+  box.m_ymax = max(this->m_ymax, other.m_ymax);
+  box.m_zmax = max(this->m_zmax, other.m_zmax);
+  box.m_tmax = max(this->m_tmax, other.m_tmax);
+  if (!box.has_x()) box.m_srid = SRID_DEFAULT;
+  box.m_geodetic = this->m_geodetic && other.m_geodetic;
+  return box;
+}
+
 int STBox::compare(STBox const &other) const {
   if (srid() < other.srid())
     return -1;
@@ -216,6 +292,11 @@ int STBox::compare(STBox const &other) const {
   return 0;
 }
 
+size_t STBox::hash() const {
+  return hash_fields(srid(), tmin(), xmin(), ymin(), zmin(), tmax(), xmax(), ymax(), zmax(),
+                     geodetic());
+}
+
 bool operator==(STBox const &lhs, STBox const &rhs) { return lhs.compare(rhs) == 0; }
 
 bool operator!=(STBox const &lhs, STBox const &rhs) { return lhs.compare(rhs) != 0; }
@@ -1,5 +1,6 @@
 #include <meos/io/utils.hpp>
 #include <meos/types/box/TBox.hpp>
+#include <meos/util/hash.hpp>
 #include <meos/util/serializing.hpp>
 #include <sstream>
 #include <string>
@@ -87,6 +88,8 @@ int TBox::compare(TBox const &other) const {
   return 0;
 }
 
+size_t TBox::hash() const { return hash_fields(xmin(), tmin(), xmax(), tmax()); }
+
 bool operator==(TBox const &lhs, TBox const &rhs) { return lhs.compare(rhs) == 0; }
 
 bool operator!=(TBox const &lhs, TBox const &rhs) { return lhs.compare(rhs) != 0; }
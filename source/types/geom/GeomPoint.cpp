@@ -1,66 +1,160 @@
 #include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
+#include <iterator>
 #include <meos/io/utils.hpp>
 #include <meos/types/geom/GeomPoint.hpp>
+#include <meos/util/hash.hpp>
 #include <meos/util/string.hpp>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace meos {
 
-GeomPoint::GeomPoint() { point(0, 0); }
+namespace {
+
+// (E)WKB geometry type flags, as used by PostGIS
+uint32_t const WKB_POINT = 1;
+uint32_t const WKB_Z_FLAG = 0x80000000;
+uint32_t const WKB_SRID_FLAG = 0x20000000;
+
+void skip_ws(char const *&p) {
+  while (std::isspace(static_cast<unsigned char>(*p))) p++;
+}
+
+bool parse_double(char const *&p, double &value) {
+  skip_ws(p);
+  char *end;
+  value = std::strtod(p, &end);
+  if (end == p) return false;
+  p = end;
+  return true;
+}
+
+/**
+ * Parses "POINT [Z] (x y [z])", case insensitive and with optional whitespaces.
+ * Returns false if the string is not a valid, non-empty point.
+ */
+bool parse_wkt_point(char const *p, double &x, double &y, double &z, bool &has_z) {
+  skip_ws(p);
+  for (char const *c = "POINT"; *c != '\0'; c++, p++) {
+    if (std::toupper(static_cast<unsigned char>(*p)) != *c) return false;
+  }
+  skip_ws(p);
+  has_z = false;
+  if (*p == 'Z' || *p == 'z') {
+    has_z = true;
+    p++;
+    skip_ws(p);
+  }
+  if (*p++ != '(') return false;
+  if (!parse_double(p, x) || !parse_double(p, y)) return false;
+  skip_ws(p);
+  if (*p != ')') {
+    if (!parse_double(p, z)) return false;
+    has_z = true;
+    skip_ws(p);
+  } else if (has_z) {
+    return false;
+  }
+  if (*p++ != ')') return false;
+  skip_ws(p);
+  return *p == '\0';
+}
+
+uint32_t read_uint32(unsigned char const *buf, bool little_endian) {
+  uint32_t v = 0;
+  for (int i = 0; i < 4; i++) {
+    v |= static_cast<uint32_t>(buf[little_endian ? i : 3 - i]) << (8 * i);
+  }
+  return v;
+}
+
+double read_double(unsigned char const *buf, bool little_endian) {
+  uint64_t v = 0;
+  for (int i = 0; i < 8; i++) {
+    v |= static_cast<uint64_t>(buf[little_endian ? i : 7 - i]) << (8 * i);
+  }
+  double d;
+  std::memcpy(&d, &v, sizeof(d));
+  return d;
+}
+
+void write_uint32(std::string &out, uint32_t v) {
+  for (int i = 0; i < 4; i++) out += static_cast<char>((v >> (8 * i)) & 0xFF);
+}
+
+void write_double(std::string &out, double d) {
+  uint64_t v;
+  std::memcpy(&v, &d, sizeof(d));
+  for (int i = 0; i < 8; i++) out += static_cast<char>((v >> (8 * i)) & 0xFF);
+}
+
+/**
+ * Serializes the point as (E)WKB, always in little endian (NDR) byte order.
+ */
+std::string to_wkb(GeomPoint const &g, bool extended) {
+  bool const with_srid = extended && g.srid() != 0;
+  uint32_t type = WKB_POINT;
+  if (g.has_z()) type |= WKB_Z_FLAG;
+  if (with_srid) type |= WKB_SRID_FLAG;
+
+  std::string out;
+  out += static_cast<char>(1);
+  write_uint32(out, type);
+  if (with_srid) write_uint32(out, static_cast<uint32_t>(g.srid()));
+  write_double(out, g.x());
+  write_double(out, g.y());
+  if (g.has_z()) write_double(out, g.z());
+  return out;
+}
+
+}  // namespace
+
+GeomPoint::GeomPoint() {}
 
 GeomPoint::GeomPoint(std::string serialized) {
   std::stringstream ss(serialized);
-  GeomPoint g;
-  ss >> g;
-  this->geom = GEOSGeom_clone_r(geos_context, g.geom);
+  ss >> *this;
 }
 
-GeomPoint::GeomPoint(double x, double y) { point(x, y); }
+GeomPoint::GeomPoint(double x, double y) : m_x(x), m_y(y) {}
 
 GeomPoint::GeomPoint(std::string serialized, int srid) {
   std::stringstream ss(serialized);
-  GeomPoint g;
-  ss >> g;
+  ss >> *this;
 
   // If two different, non-zero SRIDs are provided, we throw an error
-  if (g.srid() != srid && g.srid() * srid != 0) {
+  if (this->m_srid != srid && this->m_srid * srid != 0) {
     throw std::invalid_argument("Conflicting SRIDs provided. Given: " + std::to_string(srid)
-                                + ", while Geometry contains: " + std::to_string(g.srid()));
+                                + ", while Geometry contains: " + std::to_string(this->m_srid));
   }
 
   if (srid != 0) {
-    GEOSSetSRID_r(geos_context, g.geom, srid);
+    this->m_srid = srid;
   }
-
-  this->geom = GEOSGeom_clone_r(geos_context, g.geom);
-}
-
-GeomPoint::GeomPoint(double x, double y, int srid) {
-  point(x, y);
-  GEOSSetSRID_r(geos_context, this->geom, srid);
-}
-
-GeomPoint::GeomPoint(GeomPoint const &g) {
-  free();
-  this->geom = GEOSGeom_clone_r(geos_context, g.geom);
 }
 
-void GeomPoint::operator=(GeomPoint const &g) {
-  free();
-  this->geom = GEOSGeom_clone_r(geos_context, g.geom);
-}
+GeomPoint::GeomPoint(double x, double y, int srid) : m_x(x), m_y(y), m_srid(srid) {}
 
-GeomPoint::~GeomPoint() { free(); }
+GeomPoint::GeomPoint(double x, double y, double z, int srid)
+    : m_x(x), m_y(y), m_z(z), m_has_z(true), m_srid(srid) {}
 
-void GeomPoint::point(double x, double y) {
-  free();
-  auto seq = GEOSCoordSeq_create_r(geos_context, 1, 2);
-  GEOSCoordSeq_setX_r(geos_context, seq, 0, x);
-  GEOSCoordSeq_setY_r(geos_context, seq, 0, y);
-  geom = GEOSGeom_createPoint_r(geos_context, seq);
+GEOSGeometryPtr GeomPoint::geom() const {
+  auto seq = GEOSCoordSeq_create_r(geos_context(), 1, this->m_has_z ? 3 : 2);
+  GEOSCoordSeq_setX_r(geos_context(), seq, 0, this->m_x);
+  GEOSCoordSeq_setY_r(geos_context(), seq, 0, this->m_y);
+  if (this->m_has_z) {
+    GEOSCoordSeq_setZ_r(geos_context(), seq, 0, this->m_z);
+  }
+  GEOSGeometryPtr g(GEOSGeom_createPoint_r(geos_context(), seq));
+  GEOSSetSRID_r(geos_context(), g.get(), this->m_srid);
+  return g;
 }
 
 void GeomPoint::fromEWKB(std::istream &is) { this->fromWKB(is); }
@@ -71,166 +165,178 @@ void GeomPoint::fromEWKT(std::string wkt) { this->fromWKT(wkt); }
 
 std::string GeomPoint::toEWKT() const { return this->toWKT(true); }
 
-void GeomPoint::fromWKB(std::istream &is) {
-  free();
-  const size_t BUFFER_SIZE = 2048;
-  unsigned char *buf = new unsigned char[BUFFER_SIZE];
+void GeomPoint::read_wkb(unsigned char const *buf, size_t length) {
+  if (length < 5 || buf[0] > 1) {
+    throw std::invalid_argument("Could not parse WKB (binary)");
+  }
+  bool const little_endian = buf[0] == 1;
+  uint32_t const type = read_uint32(buf + 1, little_endian);
+  size_t pos = 5;
 
-  is.read(reinterpret_cast<char *>(buf), BUFFER_SIZE);
-  auto length = is.gcount();
-  buf[length] = '\0';
-  geom = GEOSGeomFromWKB_buf_r(geos_context, buf, length);
+  int srid = 0;
+  if (type & WKB_SRID_FLAG) {
+    if (length < pos + 4) throw std::invalid_argument("Could not parse WKB (binary)");
+    srid = static_cast<int>(read_uint32(buf + pos, little_endian));
+    pos += 4;
+  }
 
-  delete[] buf;
-  if (geom == nullptr) {
+  bool const has_z = (type & WKB_Z_FLAG) != 0;
+  size_t const coords = has_z ? 3 : 2;
+  if ((type & 0xFFFF) != WKB_POINT) {
+    throw std::invalid_argument("Only POINT geometry supported as of now");
+  }
+  if (length < pos + 8 * coords) {
     throw std::invalid_argument("Could not parse WKB (binary)");
   }
+
+  this->m_x = read_double(buf + pos, little_endian);
+  this->m_y = read_double(buf + pos + 8, little_endian);
+  this->m_z = has_z ? read_double(buf + pos + 16, little_endian) : 0;
+  this->m_has_z = has_z;
+  this->m_srid = srid;
+}
+
+void GeomPoint::fromWKB(std::istream &is) {
+  std::vector<unsigned char> buf((std::istreambuf_iterator<char>(is)),
+                                 std::istreambuf_iterator<char>());
+  this->read_wkb(buf.data(), buf.size());
 }
 
 void GeomPoint::toWKB(std::ostream &os, bool extended) const {
-  if (geom != nullptr) {
-    GEOSWKBWriter *wkbw_ = GEOSWKBWriter_create_r(geos_context);
-    if (extended) {
-      GEOSWKBWriter_setIncludeSRID_r(geos_context, wkbw_, true);
-    }
-    size_t size;
-    unsigned char *wkb_c = GEOSWKBWriter_write_r(geos_context, wkbw_, geom, &size);
-    os.write(reinterpret_cast<char *>(wkb_c), size);
-    std::free(wkb_c);
-    GEOSWKBWriter_destroy_r(geos_context, wkbw_);
-  } else {
-    throw "Geometry not initiated.";
-  }
+  std::string wkb = to_wkb(*this, extended);
+  os.write(wkb.data(), wkb.size());
 }
 
 void GeomPoint::fromWKT(std::string wkt) {
-  free();
-  geom = GEOSGeomFromWKT_r(geos_context, wkt.c_str());
-  if (geom == nullptr) {
+  double x, y, z = 0;
+  bool has_z;
+  if (!parse_wkt_point(wkt.c_str(), x, y, z, has_z)) {
     throw std::invalid_argument("Could not parse WKT");
   }
+  this->m_x = x;
+  this->m_y = y;
+  this->m_z = z;
+  this->m_has_z = has_z;
+  this->m_srid = 0;
 }
 
 std::string GeomPoint::toWKT(bool extended) const {
-  if (geom != nullptr) {
-    GEOSWKTWriter *wktw_ = GEOSWKTWriter_create_r(geos_context);
-    GEOSWKTWriter_setTrim_r(geos_context, wktw_, 1);
-    GEOSWKTWriter_setRoundingPrecision_r(geos_context, wktw_, 8);
-    char *wkt_c = GEOSWKTWriter_write_r(geos_context, wktw_, geom);
-    std::string s;
-    if (extended && this->srid() != 0) {
-      s += "SRID=" + std::to_string(this->srid()) + ";";
-    }
-    s += wkt_c;
-    std::free(wkt_c);
-    GEOSWKTWriter_destroy_r(geos_context, wktw_);
-    return s;
+  // Formatting is left to GEOS, so that the output stays consistent with it
+  GEOSGeometryPtr g = this->geom();
+  GEOSWKTWriter *wktw_ = GEOSWKTWriter_create_r(geos_context());
+  GEOSWKTWriter_setTrim_r(geos_context(), wktw_, 1);
+  GEOSWKTWriter_setRoundingPrecision_r(geos_context(), wktw_, 8);
+  if (this->m_has_z) {
+    GEOSWKTWriter_setOutputDimension_r(geos_context(), wktw_, 3);
   }
-  throw "Geometry not initiated.";
+  char *wkt_c = GEOSWKTWriter_write_r(geos_context(), wktw_, g.get());
+  std::string s;
+  if (extended && this->srid() != 0) {
+    s += "SRID=" + std::to_string(this->srid()) + ";";
+  }
+  s += wkt_c;
+  GEOSFree_r(geos_context(), wkt_c);
+  GEOSWKTWriter_destroy_r(geos_context(), wktw_);
+  return s;
 }
 
 void GeomPoint::fromHEX(std::istream &is) {
-  free();
-  const size_t BUFFER_SIZE = 2048;
-  unsigned char *buf = new unsigned char[BUFFER_SIZE];
+  std::string hex((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+  hex = trim(hex);
+  if (hex.size() % 2 != 0) {
+    throw std::invalid_argument("Could not parse WKB (hex)");
+  }
 
-  is.read(reinterpret_cast<char *>(buf), BUFFER_SIZE);
-  auto length = is.gcount();
-  buf[length] = '\0';
-  geom = GEOSGeomFromHEX_buf_r(geos_context, buf, length);
+  std::vector<unsigned char> buf(hex.size() / 2);
+  for (size_t i = 0; i < buf.size(); i++) {
+    int hi = std::isxdigit(static_cast<unsigned char>(hex[2 * i])) ? hex[2 * i] : -1;
+    int lo = std::isxdigit(static_cast<unsigned char>(hex[2 * i + 1])) ? hex[2 * i + 1] : -1;
+    if (hi < 0 || lo < 0) {
+      throw std::invalid_argument("Could not parse WKB (hex)");
+    }
+    hi = std::isdigit(hi) ? hi - '0' : std::toupper(hi) - 'A' + 10;
+    lo = std::isdigit(lo) ? lo - '0' : std::toupper(lo) - 'A' + 10;
+    buf[i] = static_cast<unsigned char>((hi << 4) | lo);
+  }
 
-  delete[] buf;
-  if (geom == nullptr) {
+  try {
+    this->read_wkb(buf.data(), buf.size());
+  } catch (std::invalid_argument const &) {
     throw std::invalid_argument("Could not parse WKB (hex)");
   }
 }
 
 void GeomPoint::toHEX(std::ostream &os, bool extended) const {
-  if (geom != nullptr) {
-    GEOSWKBWriter *wkbw_ = GEOSWKBWriter_create_r(geos_context);
-    if (extended) {
-      GEOSWKBWriter_setIncludeSRID_r(geos_context, wkbw_, true);
-    }
-    size_t size;
-    unsigned char *wkb_c = GEOSWKBWriter_writeHEX_r(geos_context, wkbw_, geom, &size);
-    os.write(reinterpret_cast<char *>(wkb_c), size);
-    std::free(wkb_c);
-    GEOSWKBWriter_destroy_r(geos_context, wkbw_);
-  } else {
-    throw "Geometry not initiated.";
+  static char const digits[] = "0123456789ABCDEF";
+  std::string wkb = to_wkb(*this, extended);
+  std::string hex;
+  hex.reserve(2 * wkb.size());
+  for (unsigned char c : wkb) {
+    hex += digits[c >> 4];
+    hex += digits[c & 0xF];
   }
+  os << hex;
 }
 
-void GeomPoint::free() {
-  if (geom != nullptr) {
-    GEOSGeom_destroy_r(geos_context, geom);
-    geom = nullptr;
-  }
-}
+double GeomPoint::x() const { return this->m_x; }
 
-double GeomPoint::x() const {
-  double x;
-  GEOSGeomGetX_r(geos_context, this->geom, &x);
-  return x;
-}
+double GeomPoint::y() const { return this->m_y; }
 
-double GeomPoint::y() const {
-  double y;
-  GEOSGeomGetY_r(geos_context, this->geom, &y);
-  return y;
-}
+double GeomPoint::z() const { return this->m_z; }
 
-int GeomPoint::srid() const { return GEOSGetSRID_r(geos_context, this->geom); }
+bool GeomPoint::has_z() const { return this->m_has_z; }
 
-GeomPoint GeomPoint::operator+(GeomPoint const &other) const {
-  double x, y;
-  GEOSGeomGetX_r(geos_context, this->geom, &x);
-  GEOSGeomGetY_r(geos_context, this->geom, &y);
+int GeomPoint::srid() const { return this->m_srid; }
 
-  double ox, oy;
-  GEOSGeomGetX_r(geos_context, other.geom, &ox);
-  GEOSGeomGetY_r(geos_context, other.geom, &oy);
+GeomPoint GeomPoint::with_srid(int srid) const {
+  GeomPoint g = *this;
+  g.m_srid = srid;
+  return g;
+}
 
-  return GeomPoint(x + ox, y + oy);
+GeomPoint GeomPoint::operator+(GeomPoint const &other) const {
+  if (this->m_has_z && other.m_has_z) {
+    return GeomPoint(this->m_x + other.m_x, this->m_y + other.m_y, this->m_z + other.m_z, 0);
+  }
+  return GeomPoint(this->m_x + other.m_x, this->m_y + other.m_y);
 }
 
 GeomPoint GeomPoint::operator-(GeomPoint const &other) const {
-  double x, y;
-  GEOSGeomGetX_r(geos_context, this->geom, &x);
-  GEOSGeomGetY_r(geos_context, this->geom, &y);
-
-  double ox, oy;
-  GEOSGeomGetX_r(geos_context, other.geom, &ox);
-  GEOSGeomGetY_r(geos_context, other.geom, &oy);
-
-  return GeomPoint(x - ox, y - oy);
+  if (this->m_has_z && other.m_has_z) {
+    return GeomPoint(this->m_x - other.m_x, this->m_y - other.m_y, this->m_z - other.m_z, 0);
+  }
+  return GeomPoint(this->m_x - other.m_x, this->m_y - other.m_y);
 }
 
 int GeomPoint::compare(GeomPoint const &other) const {
-  double x, y;
-  GEOSGeomGetX_r(geos_context, this->geom, &x);
-  GEOSGeomGetY_r(geos_context, this->geom, &y);
-
-  double ox, oy;
-  GEOSGeomGetX_r(geos_context, other.geom, &ox);
-  GEOSGeomGetY_r(geos_context, other.geom, &oy);
-
-  if (x < ox)
+  if (this->m_x < other.m_x)
     return -1;
-  else if (x > ox)
+  else if (this->m_x > other.m_x)
     return 1;
-  else if (y < oy)
+  else if (this->m_y < other.m_y)
     return -1;
-  else if (y > oy)
+  else if (this->m_y > other.m_y)
     return 1;
-  else if (srid() < other.srid())
+  else if (this->m_has_z < other.m_has_z)
     return -1;
-  else if (srid() > other.srid())
+  else if (this->m_has_z > other.m_has_z)
+    return 1;
+  else if (this->m_z < other.m_z)
+    return -1;
+  else if (this->m_z > other.m_z)
+    return 1;
+  else if (this->m_srid < other.m_srid)
+    return -1;
+  else if (this->m_srid > other.m_srid)
     return 1;
 
   return 0;
 }
 
+size_t GeomPoint::hash() const {
+  return hash_fields(this->m_x, this->m_y, this->m_has_z, this->m_z, this->m_srid);
+}
+
 bool operator==(GeomPoint const &lhs, GeomPoint const &rhs) { return lhs.compare(rhs) == 0; }
 
 bool operator!=(GeomPoint const &lhs, GeomPoint const &rhs) { return lhs.compare(rhs) != 0; }
@@ -257,46 +363,42 @@ std::istream &operator>>(std::istream &in, GeomPoint &g) {
     in >> srid;
     consume(in, ';');
   } else {
+    in.clear();
     in.seekg(pos);
   }
 
   // Geometries could be in either WKT or WKB (Hex) formats
   // So first we detect which one of them is the case
   in >> std::ws;
-  auto start_pos = in.tellg();
   auto buffer = read_until_one_of(in, "(@");
-  auto final_pos = in.tellg();
-  auto length = final_pos - start_pos;
   bool is_wkt = in.peek() == '(';
 
   if (is_wkt) {
     // WKT follows the pattern GEOMTYPENAME(...), with possible nested braces
     // This piece of code reads until all braces are closed
 
-    std::transform(buffer.begin(), buffer.end(), buffer.begin(), toupper);
-    if (trim(buffer) != "POINT") {
+    std::string type = buffer;
+    std::transform(type.begin(), type.end(), type.begin(), toupper);
+    type = trim(type);
+    if (type != "POINT" && type != "POINT Z" && type != "POINTZ") {
       throw std::invalid_argument("Only POINT geometry supported as of now");
     }
 
     consume(in, '(');
+    buffer += '(';
     int brace_nesting = 1;
     while (brace_nesting != 0) {
-      read_until_one_of(in, "()");
-      brace_nesting += (in.get() == '(' ? 1 : -1);
+      buffer += read_until_one_of(in, "()");
+      int c = in.get();
+      if (c == EOF) {
+        throw std::invalid_argument("Could not parse WKT: unbalanced braces");
+      }
+      buffer += static_cast<char>(c);
+      brace_nesting += (c == '(' ? 1 : -1);
     }
-    final_pos = in.tellg();
-    length = final_pos - start_pos;
-    in.seekg(start_pos);
-
-    char *buf = new char[length + 1];
-    in.read(buf, length);
-    buf[length] = '\0';
-
-    g.geom = GEOSGeomFromWKT_r(geos_context, buf);
-
-    delete[] buf;
 
-    GEOSSetSRID_r(geos_context, g.geom, srid);
+    g.fromWKT(buffer);
+    g.m_srid = srid;
   } else {
     std::stringstream ss(buffer);
     g.fromHEX(ss);
@@ -1,5 +1,6 @@
 #include <meos/io/utils.hpp>
 #include <meos/types/range/Range.hpp>
+#include <meos/util/hash.hpp>
 #include <sstream>
 #include <string>
 
@@ -65,6 +66,10 @@ template <typename T> int Range<T>::compare(Range<T> const &other) const {
   return 0;
 }
 
+template <typename T> size_t Range<T>::hash() const {
+  return hash_fields(lower(), upper(), lower_inc(), upper_inc());
+}
+
 template <typename T> T Range<T>::lower() const { return this->m_lower; }
 template <typename T> T Range<T>::upper() const { return this->m_upper; }
 
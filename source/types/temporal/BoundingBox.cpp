@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <meos/types/temporal/BoundingBox.hpp>
+#include <string>
+
+namespace meos {
+using namespace std;
+
+namespace {
+
+/**
+ * Do the two time intervals share at least one timestamp?
+ */
+bool overlaps(time_point const lower1, time_point const upper1, bool const lower1_inc,
+              bool const upper1_inc, Period const &period) {
+  bool const starts_before_end
+      = period.lower() < upper1 || (period.lower() == upper1 && period.lower_inc() && upper1_inc);
+  bool const ends_after_start
+      = lower1 < period.upper() || (lower1 == period.upper() && lower1_inc && period.upper_inc());
+  return starts_before_end && ends_after_start;
+}
+
+template <typename BaseType>
+TBox make_tbox(SharedVector<time_point> const &timestamps, SharedVector<BaseType> const &values) {
+  auto const bounds = minmax_element(values.begin(), values.end());
+  return TBox(static_cast<double>(*bounds.first), timestamps.front(),
+              static_cast<double>(*bounds.second), timestamps.back());
+}
+
+}  // namespace
+
+template <typename BaseType>
+bbox_t<BaseType> make_bbox(SharedVector<time_point> const &timestamps,
+                           SharedVector<BaseType> const &, bool lower_inc, bool upper_inc) {
+  bool const instantaneous = timestamps.front() == timestamps.back();
+  return Period(timestamps.front(), timestamps.back(), lower_inc || instantaneous,
+                upper_inc || instantaneous);
+}
+
+template <> TBox make_bbox(SharedVector<time_point> const &timestamps,
+                          SharedVector<int> const &values, bool, bool) {
+  return make_tbox(timestamps, values);
+}
+
+template <> TBox make_bbox(SharedVector<time_point> const &timestamps,
+                          SharedVector<float> const &values, bool, bool) {
+  return make_tbox(timestamps, values);
+}
+
+template <> STBox make_bbox(SharedVector<time_point> const &timestamps,
+                           SharedVector<GeomPoint> const &values, bool, bool) {
+  GeomPoint const &first = values.front();
+  double xmin = first.x(), ymin = first.y(), xmax = first.x(), ymax = first.y();
+  double zmin = first.has_z() ? first.z() : 0, zmax = zmin;
+  for (GeomPoint const &value : values) {
+    xmin = min(xmin, value.x());
+    ymin = min(ymin, value.y());
+    xmax = max(xmax, value.x());
+    ymax = max(ymax, value.y());
+    if (first.has_z()) {
+      zmin = min(zmin, value.z());
+      zmax = max(zmax, value.z());
+    }
+  }
+  if (first.has_z()) {
+    return STBox(xmin, ymin, zmin, timestamps.front(), xmax, ymax, zmax, timestamps.back(),
+                 first.srid());
+  }
+  return STBox(xmin, ymin, timestamps.front(), xmax, ymax, timestamps.back(), first.srid());
+}
+
+template Period make_bbox(SharedVector<time_point> const &timestamps,
+                          SharedVector<bool> const &values, bool lower_inc, bool upper_inc);
+template Period make_bbox(SharedVector<time_point> const &timestamps,
+                          SharedVector<string> const &values, bool lower_inc, bool upper_inc);
+
+template <typename BaseType> bbox_t<BaseType> make_bbox(time_point t, BaseType const &) {
+  return Period(t, t, true, true);
+}
+
+template <> TBox make_bbox(time_point t, int const &value) { return TBox(value, t, value, t); }
+
+template <> TBox make_bbox(time_point t, float const &value) { return TBox(value, t, value, t); }
+
+template <> STBox make_bbox(time_point t, GeomPoint const &value) {
+  if (value.has_z()) {
+    return STBox(value.x(), value.y(), value.z(), t, value.x(), value.y(), value.z(), t,
+                 value.srid());
+  }
+  return STBox(value.x(), value.y(), t, value.x(), value.y(), t, value.srid());
+}
+
+template Period make_bbox(time_point t, bool const &value);
+template Period make_bbox(time_point t, string const &value);
+
+TBox bbox_union(TBox const &lhs, TBox const &rhs) {
+  return TBox(min(lhs.xmin(), rhs.xmin()), min(lhs.tmin(), rhs.tmin()),
+              max(lhs.xmax(), rhs.xmax()), max(lhs.tmax(), rhs.tmax()));
+}
+
+STBox bbox_union(STBox const &lhs, STBox const &rhs) { return lhs.union_(rhs); }
+
+Period bbox_union(Period const &lhs, Period const &rhs) {
+  time_point lower = min(lhs.lower(), rhs.lower());
+  time_point upper = max(lhs.upper(), rhs.upper());
+  bool const lower_inc = (lhs.lower() == lower && lhs.lower_inc())
+                         || (rhs.lower() == lower && rhs.lower_inc());
+  bool const upper_inc = (lhs.upper() == upper && lhs.upper_inc())
+                         || (rhs.upper() == upper && rhs.upper_inc());
+  return Period(lower, upper, lower_inc, upper_inc);
+}
+
+bool bbox_overlaps_period(TBox const &box, Period const &period) {
+  return overlaps(box.tmin(), box.tmax(), true, true, period);
+}
+
+bool bbox_overlaps_period(STBox const &box, Period const &period) {
+  return overlaps(box.tmin(), box.tmax(), true, true, period);
+}
+
+bool bbox_overlaps_period(Period const &box, Period const &period) {
+  return overlaps(box.lower(), box.upper(), box.lower_inc(), box.upper_inc(), period);
+}
+
+}  // namespace meos
@@ -1,5 +1,7 @@
+#include <algorithm>
 #include <iomanip>
 #include <meos/types/temporal/TInstant.hpp>
+#include <meos/util/hash.hpp>
 #include <sstream>
 #include <string>
 
@@ -15,7 +17,7 @@ template <> void TInstant<GeomPoint>::validate() {
   // geometries, use it both places
   if (this->value.srid() * this->m_srid == 0) {
     if (this->m_srid != 0) {
-      this->value = GeomPoint(this->value.x(), this->value.y(), this->m_srid);
+      this->value = this->value.with_srid(this->m_srid);
     } else {
       this->m_srid = this->value.srid();
     }
@@ -58,9 +60,7 @@ template <typename BaseType> TInstant<BaseType>::TInstant(pair<string const, str
 
 template <typename BaseType> TInstant<BaseType>::TInstant(string const &serialized) {
   stringstream ss(serialized);
-  TInstant<BaseType> instant;
-  ss >> instant;
-  *this = instant;
+  ss >> *this;
   validate();
 }
 
@@ -102,9 +102,7 @@ TInstant<BaseType>::TInstant(pair<string const, string const> p, int srid) {
 template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
 TInstant<BaseType>::TInstant(string const &serialized, int srid) {
   stringstream ss(serialized);
-  TInstant<BaseType> instant;
-  ss >> instant;
-  *this = instant;
+  ss >> *this;
   this->m_srid = srid;
   validate();
 }
@@ -119,7 +117,7 @@ template <typename BaseType> template <typename B, typename is_geometry<B>::type
 TInstant<BaseType> TInstant<BaseType>::with_srid(int srid) const {
   if (this->m_srid == srid) return *this;
   TInstant<BaseType> instant = *this;
-  instant.value = GeomPoint(this->value.x(), this->value.y(), srid);
+  instant.value = this->value.with_srid(srid);
   instant.m_srid = srid;
   return instant;
 }
@@ -168,6 +166,14 @@ template <> int TInstant<GeomPoint>::compare(Temporal<GeomPoint> const &other) c
   return 0;
 }
 
+template <typename BaseType> size_t TInstant<BaseType>::hash() const {
+  return hash_fields(this->t, this->value);
+}
+
+template <> size_t TInstant<GeomPoint>::hash() const {
+  return hash_fields(this->t, this->value, this->srid());
+}
+
 template <typename BaseType> BaseType TInstant<BaseType>::getValue() const { return this->value; }
 
 template <typename BaseType> time_point TInstant<BaseType>::getTimestamp() const { return this->t; }
@@ -184,10 +190,31 @@ template <typename BaseType> set<Range<BaseType>> TInstant<BaseType>::getValues(
   return {Range<BaseType>(this->getValue(), this->getValue(), true, true)};
 }
 
+template <typename BaseType> bbox_t<BaseType> TInstant<BaseType>::boundingBox() const {
+  return make_bbox(this->t, this->value);
+}
+
 template <typename BaseType> set<time_point> TInstant<BaseType>::timestamps() const {
   return {getTimestamp()};
 }
 
+template <typename BaseType> size_t TInstant<BaseType>::numTimestamps() const { return 1; }
+
+template <typename BaseType> time_point TInstant<BaseType>::startTimestamp() const {
+  return this->t;
+}
+
+template <typename BaseType> time_point TInstant<BaseType>::endTimestamp() const {
+  return this->t;
+}
+
+template <typename BaseType> time_point TInstant<BaseType>::timestampN(size_t n) const {
+  if (n >= 1) {
+    throw "At least " + to_string(n) + " timestamp(s) expected";
+  }
+  return this->t;
+}
+
 template <typename BaseType> PeriodSet TInstant<BaseType>::getTime() const {
   set<Period> s = {this->period()};
   return PeriodSet(s);
@@ -216,10 +243,40 @@ bool TInstant<BaseType>::intersectsTimestamp(time_point const datetime) const {
   return datetime == this->t;
 }
 
+template <typename BaseType>
+BaseType TInstant<BaseType>::valueAtTimestamp(time_point const datetime) const {
+  if (datetime != this->t) {
+    throw invalid_argument("The temporal value is not defined at "
+                           + write_ISO8601_time(datetime));
+  }
+  return this->value;
+}
+
+template <typename BaseType> void TInstant<BaseType>::values_at_timestamps_impl(
+    vector<time_point> const &timestamps, vector<pair<BaseType, time_point>> &values) const {
+  auto it = lower_bound(timestamps.begin(), timestamps.end(), this->t);
+  for (; it != timestamps.end() && *it == this->t; it++) values.emplace_back(this->value, this->t);
+}
+
+template <typename BaseType>
+TInstant<BaseType> *TInstant<BaseType>::at_periods_impl(vector<Period> const &periods) const {
+  // The only period that can contain the instant is the first one not ending before it
+  auto it
+      = lower_bound(periods.begin(), periods.end(), this->t,
+                    [](Period const &period, time_point const t) { return period.upper() < t; });
+  if (it == periods.end() || !it->contains_timestamp(this->t)) return nullptr;
+  return this->clone_impl();
+}
+
 template <typename BaseType> bool TInstant<BaseType>::intersectsPeriod(Period const period) const {
   return period.contains_timestamp(this->t);
 }
 
+template <typename BaseType>
+bool TInstant<BaseType>::intersects_timestamp_set_impl(TimestampSet const &timestampset) const {
+  return timestampset.contains_timestamp(this->t);
+}
+
 template <typename BaseType> istream &TInstant<BaseType>::read(istream &in) {
   this->value = nextValue<BaseType>(in);
   consume(in, '@');
@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <iomanip>
 #include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/util/hash.hpp>
 #include <sstream>
 #include <string>
 
@@ -10,6 +11,7 @@ using namespace std;
 template <typename BaseType> void TInstantSet<BaseType>::validate() {
   validate_common();
   // Check template specialization on Geometry for more validation
+  this->m_bbox = make_bbox(this->m_timestamps, this->m_values);
 }
 
 template <> void TInstantSet<GeomPoint>::validate() {
@@ -22,24 +24,25 @@ template <> void TInstantSet<GeomPoint>::validate() {
   GeomPoint g = this->startValue();
   if (g.srid() * this->m_srid == 0) {
     if (this->m_srid != 0) {
-      set<TInstant<GeomPoint>> _instants;
-      for (TInstant<GeomPoint> const &instant : this->m_instants) {
-        _instants.insert(
-            TInstant<GeomPoint>(instant.getValue(), instant.getTimestamp(), this->m_srid));
+      vector<GeomPoint> values = this->m_values.copy();
+      for (GeomPoint &value : values) {
+        if (value.srid() == 0) value = value.with_srid(this->m_srid);
       };
-      this->m_instants = _instants;
+      this->m_values = move(values);
     } else {
       this->m_srid = g.srid();
     }
   }
 
   // All SRIDs must be equal
-  for (TInstant<GeomPoint> const &instant : this->m_instants) {
-    if (this->m_srid != instant.getValue().srid()) {
+  for (GeomPoint const &value : this->m_values) {
+    if (this->m_srid != value.srid()) {
       throw std::invalid_argument("Conflicting SRIDs provided. Given: " + to_string(this->m_srid)
                                   + ", while Geometry contains: " + to_string(g.srid()));
     }
   }
+
+  this->m_bbox = make_bbox(this->m_timestamps, this->m_values);
 }
 
 template <typename BaseType> TInstantSet<BaseType>::TInstantSet() {}
@@ -50,16 +53,20 @@ TInstantSet<BaseType>::TInstantSet(set<TInstant<BaseType>> const &instants)
   validate();
 }
 
+template <typename BaseType>
+TInstantSet<BaseType>::TInstantSet(vector<time_point> timestamps, vector<BaseType> values)
+    : TemporalSet<BaseType>(move(timestamps), move(values)) {
+  validate();
+}
+
 template <typename BaseType> TInstantSet<BaseType>::TInstantSet(set<string> const &instants) {
-  for (auto const &e : instants) this->m_instants.insert(TInstant<BaseType>(e));
+  this->parse_instants(instants);
   validate();
 }
 
 template <typename BaseType> TInstantSet<BaseType>::TInstantSet(string const &serialized) {
   stringstream ss(serialized);
-  TInstantSet<BaseType> instant_set;
-  ss >> instant_set;
-  *this = instant_set;
+  ss >> *this;
   validate();
 }
 
@@ -75,7 +82,7 @@ TInstantSet<BaseType>::TInstantSet(set<TInstant<BaseType>> const &instants, int
 
 template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
 TInstantSet<BaseType>::TInstantSet(set<string> const &instants, int srid) {
-  for (auto const &e : instants) this->m_instants.insert(TInstant<BaseType>(e));
+  this->parse_instants(instants);
   this->m_srid = srid;
   validate();
 }
@@ -83,9 +90,7 @@ TInstantSet<BaseType>::TInstantSet(set<string> const &instants, int srid) {
 template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
 TInstantSet<BaseType>::TInstantSet(string const &serialized, int srid) {
   stringstream ss(serialized);
-  TInstantSet<BaseType> instant_set;
-  ss >> instant_set;
-  *this = instant_set;
+  ss >> *this;
 
   // When both string and int have non zero SRIDs, it gets a bit tricky
   if (srid * this->m_srid != 0) {
@@ -110,7 +115,7 @@ template TInstantSet<GeomPoint>::TInstantSet(set<string> const &instants, int sr
 template TInstantSet<GeomPoint>::TInstantSet(string const &serialized, int srid);
 
 template <typename BaseType> void TInstantSet<BaseType>::validate_common() {
-  size_t sz = this->m_instants.size();
+  size_t sz = this->m_timestamps.size();
   if (sz < 1) {
     throw invalid_argument("A sequence should have at least one instant");
   }
@@ -124,19 +129,16 @@ int TInstantSet<BaseType>::compare_internal(Temporal<BaseType> const &other) con
 
   TInstantSet<BaseType> const *that = dynamic_cast<TInstantSet<BaseType> const *>(&other);
   // Compare number of instants
-  if (this->m_instants.size() < that->m_instants.size()) return -1;
-  if (this->m_instants.size() > that->m_instants.size()) return 1;
-
-  // Compare instant by instant
-  auto lhs_instants = this->instants();
-  auto rhs_instants = that->instants();
-  auto lhs = lhs_instants.begin();
-  auto rhs = rhs_instants.begin();
-  while (lhs != lhs_instants.end()) {
-    if (*lhs < *rhs) return -1;
-    if (*lhs > *rhs) return 1;
-    lhs++;
-    rhs++;
+  size_t const n = this->m_timestamps.size();
+  if (n < that->m_timestamps.size()) return -1;
+  if (n > that->m_timestamps.size()) return 1;
+
+  // Compare instant by instant, i.e, timestamp and then value
+  for (size_t i = 0; i < n; i++) {
+    if (this->m_timestamps[i] < that->m_timestamps[i]) return -1;
+    if (this->m_timestamps[i] > that->m_timestamps[i]) return 1;
+    if (this->m_values[i] < that->m_values[i]) return -1;
+    if (this->m_values[i] > that->m_values[i]) return 1;
   }
 
   // The two are equal
@@ -165,22 +167,30 @@ template <> int TInstantSet<GeomPoint>::compare(Temporal<GeomPoint> const &other
   return 0;
 }
 
+template <typename BaseType> size_t TInstantSet<BaseType>::hash() const {
+  return this->hash_instants();
+}
+
+template <> size_t TInstantSet<GeomPoint>::hash() const {
+  return hash_fields(this->hash_instants(), this->srid());
+}
+
 template <typename BaseType> duration_ms TInstantSet<BaseType>::timespan() const {
   return duration_ms(0);
 }
 
 template <typename BaseType> set<Range<BaseType>> TInstantSet<BaseType>::getValues() const {
   set<Range<BaseType>> s;
-  for (auto const &e : this->m_instants) {
-    s.insert(Range<BaseType>(e.getValue(), e.getValue(), true, true));
+  for (auto const &value : this->m_values) {
+    s.insert(Range<BaseType>(value, value, true, true));
   }
   return s;
 }
 
 template <typename BaseType> PeriodSet TInstantSet<BaseType>::getTime() const {
   set<Period> s;
-  for (auto const &e : this->instants()) {
-    s.insert(e.period());
+  for (auto const &t : this->m_timestamps) {
+    s.insert(s.end(), Period(t, t, true, true));
   }
   return PeriodSet(s);
 }
@@ -196,56 +206,132 @@ unique_ptr<TInstantSet<BaseType>> TInstantSet<BaseType>::shift(duration_ms const
 
 template <typename BaseType>
 TInstantSet<BaseType> *TInstantSet<BaseType>::shift_impl(duration_ms const timedelta) const {
-  set<TInstant<BaseType>> s;
-  for (auto const &e : this->m_instants) {
-    s.insert(TInstant<BaseType>(e.getValue(), e.getTimestamp() + timedelta));
+  vector<time_point> timestamps;
+  timestamps.reserve(this->m_timestamps.size());
+  for (auto const &t : this->m_timestamps) {
+    timestamps.push_back(t + timedelta);
   }
-  return new TInstantSet<BaseType>(s);
+  return new TInstantSet<BaseType>(move(timestamps), this->m_values.copy());
 }
 
 template <typename BaseType>
 bool TInstantSet<BaseType>::intersectsTimestamp(time_point const datetime) const {
-  for (auto const &t : this->timestamps()) {
-    if (t == datetime) {
-      return true;
-    }
+  return binary_search(this->m_timestamps.begin(), this->m_timestamps.end(), datetime);
+}
+
+template <typename BaseType>
+BaseType TInstantSet<BaseType>::valueAtTimestamp(time_point const datetime) const {
+  auto it = lower_bound(this->m_timestamps.begin(), this->m_timestamps.end(), datetime);
+  if (it == this->m_timestamps.end() || *it != datetime) {
+    throw invalid_argument("The temporal value is not defined at "
+                           + write_ISO8601_time(datetime));
+  }
+  return this->m_values[it - this->m_timestamps.begin()];
+}
+
+template <typename BaseType> void TInstantSet<BaseType>::values_at_timestamps_impl(
+    vector<time_point> const &timestamps, vector<pair<BaseType, time_point>> &values) const {
+  // Merge the two sorted sequences of timestamps
+  size_t const n = this->m_timestamps.size();
+  size_t i = 0;
+  for (time_point const &t : timestamps) {
+    while (i < n && this->m_timestamps[i] < t) i++;
+    if (i == n) break;
+    if (this->m_timestamps[i] == t) values.emplace_back(this->m_values[i], t);
   }
-  return false;
 }
 
 template <typename BaseType>
 bool TInstantSet<BaseType>::intersectsPeriod(Period const period) const {
-  for (auto const &t : this->timestamps()) {
-    if (period.contains_timestamp(t)) {
-      return true;
-    }
+  // Only the first instant after the lower bound can be the one within the period
+  auto const begin = this->m_timestamps.begin();
+  auto const end = this->m_timestamps.end();
+  auto it = period.lower_inc() ? lower_bound(begin, end, period.lower())
+                               : upper_bound(begin, end, period.lower());
+  return it != end && period.contains_timestamp(*it);
+}
+
+template <typename BaseType>
+TInstantSet<BaseType> *TInstantSet<BaseType>::at_periods_impl(vector<Period> const &periods) const {
+  auto const begin = this->m_timestamps.begin();
+  auto const end = this->m_timestamps.end();
+  vector<time_point> timestamps;
+  vector<BaseType> values;
+  for (Period const &period : periods) {
+    auto first = period.lower_inc() ? lower_bound(begin, end, period.lower())
+                                    : upper_bound(begin, end, period.lower());
+    auto last = period.upper_inc() ? upper_bound(first, end, period.upper())
+                                   : lower_bound(first, end, period.upper());
+    timestamps.insert(timestamps.end(), first, last);
+    values.insert(values.end(), this->m_values.begin() + (first - begin),
+                  this->m_values.begin() + (last - begin));
+  }
+  if (timestamps.empty()) return nullptr;
+  return new TInstantSet<BaseType>(move(timestamps), move(values));
+}
+
+template <typename BaseType> bool TInstantSet<BaseType>::intersects_timestamp_set_impl(
+    TimestampSet const &timestampset) const {
+  return timestampset.contains_any(this->m_timestamps.data(), this->m_timestamps.size());
+}
+
+template <typename BaseType> template <typename B, typename is_number<B>::type *>
+double TInstantSet<BaseType>::integral() const {
+  return 0;
+}
+
+template double TInstantSet<int>::integral() const;
+template double TInstantSet<float>::integral() const;
+
+template <typename BaseType> template <typename B, typename is_number<B>::type *>
+double TInstantSet<BaseType>::twAvg() const {
+  double sum = 0;
+  for (BaseType const &value : this->m_values) sum += value;
+  return sum / this->m_values.size();
+}
+
+template double TInstantSet<int>::twAvg() const;
+template double TInstantSet<float>::twAvg() const;
+
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+GeomPoint TInstantSet<BaseType>::twCentroid() const {
+  SharedVector<GeomPoint> const &points = this->m_values;
+  double x = 0, y = 0, z = 0;
+  for (GeomPoint const &point : points) {
+    x += point.x();
+    y += point.y();
+    z += point.z();
   }
-  return false;
+  size_t const n = points.size();
+  if (!points.front().has_z()) return GeomPoint(x / n, y / n, this->srid());
+  return GeomPoint(x / n, y / n, z / n, this->srid());
 }
 
+template GeomPoint TInstantSet<GeomPoint>::twCentroid() const;
+
 template <typename BaseType> istream &TInstantSet<BaseType>::read_internal(istream &in) {
   char c;
 
   consume(in, '{');
 
-  set<TInstant<BaseType>> s = {};
+  vector<time_point> timestamps;
+  vector<BaseType> values;
 
   TInstant<BaseType> instant;
-  in >> instant;
-  s.insert(instant);
-
   while (true) {
+    in >> instant;
+    timestamps.push_back(instant.getTimestamp());
+    values.push_back(instant.getValue());
     in >> c;
     if (c != ',') break;
-    in >> instant;
-    s.insert(instant);
   }
 
   if (c != '}') {
     throw invalid_argument("Expected '}'");
   }
 
-  this->m_instants = s;
+  TemporalSet<BaseType>::sort_instants(timestamps, values);
+  this->assign_instants(move(timestamps), move(values));
 
   return in;
 }
@@ -279,13 +365,13 @@ template <> istream &TInstantSet<GeomPoint>::read(istream &in) {
 template <typename BaseType> ostream &TInstantSet<BaseType>::write_internal(ostream &os) const {
   bool first = true;
   os << "{";
-  for (auto instant : this->m_instants) {
+  for (size_t i = 0; i < this->m_timestamps.size(); i++) {
     if (first)
       first = false;
     else
       os << ", ";
     // We do not output SRID coming from instant
-    instant.write(os, false);
+    this->instant_at(i).write(os, false);
   }
   os << "}";
   return os;
@@ -1,14 +1,190 @@
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/util/hash.hpp>
 #include <sstream>
 #include <string>
 
 namespace meos {
 using namespace std;
 
+namespace {
+
+/**
+ * Linear interpolation kernels, giving the value at the given fraction of the
+ * way between two values. Discrete base types can't have linear interpolation
+ * (this is validated), so for them the start value is kept, as in stepwise.
+ */
+template <typename T> T interpolate(T const &from, T const &, double) { return from; }
+
+float interpolate(float const &from, float const &to, double ratio) {
+  return static_cast<float>(from + (static_cast<double>(to) - from) * ratio);
+}
+
+GeomPoint interpolate(GeomPoint const &from, GeomPoint const &to, double ratio) {
+  double const x = from.x() + (to.x() - from.x()) * ratio;
+  double const y = from.y() + (to.y() - from.y()) * ratio;
+  if (!from.has_z()) return GeomPoint(x, y, from.srid());
+  return GeomPoint(x, y, from.z() + (to.z() - from.z()) * ratio, from.srid());
+}
+
+/**
+ * Smallest and largest of the values. Numbers read them from their bounding box.
+ */
+template <typename BaseType, typename Box>
+pair<BaseType, BaseType> value_bounds(Box const &, SharedVector<BaseType> const &values) {
+  auto const bounds = minmax_element(values.begin(), values.end());
+  return {*bounds.first, *bounds.second};
+}
+
+template <typename BaseType>
+pair<BaseType, BaseType> value_bounds(TBox const &box, SharedVector<BaseType> const &) {
+  return {static_cast<BaseType>(box.xmin()), static_cast<BaseType>(box.xmax())};
+}
+
+double seconds(time_point const from, time_point const to) {
+  return chrono::duration<double>(to - from).count();
+}
+
+/**
+ * Douglas-Peucker over n points. error(first, last) gives the largest error of
+ * the points strictly between first and last when replaced by a single segment,
+ * along with the position to split at. Returns the sorted positions kept.
+ */
+template <typename Error>
+vector<size_t> douglas_peucker(size_t const n, double const epsilon, Error const &error) {
+  if (epsilon < 0) {
+    throw invalid_argument("The tolerance should not be negative");
+  }
+  vector<bool> keep(n, false);
+  keep.front() = keep.back() = true;
+
+  // Pending segments are kept on the heap rather than recursed into, so that
+  // long sequences can't overflow the stack
+  vector<pair<size_t, size_t>> pending{{0, n - 1}};
+  while (!pending.empty()) {
+    size_t const first = pending.back().first;
+    size_t const last = pending.back().second;
+    pending.pop_back();
+    if (last - first < 2) continue;
+    pair<double, size_t> const worst = error(first, last);
+    if (worst.first <= epsilon) continue;
+    keep[worst.second] = true;
+    pending.emplace_back(first, worst.second);
+    pending.emplace_back(worst.second, last);
+  }
+
+  vector<size_t> positions;
+  for (size_t i = 0; i < n; i++) {
+    if (keep[i]) positions.push_back(i);
+  }
+  return positions;
+}
+
+/**
+ * Largest distance between the values strictly between first and last and the
+ * ones at the same timestamps on the segment replacing them.
+ */
+template <typename BaseType>
+pair<double, size_t> synchronized_error(SharedVector<time_point> const &timestamps,
+                                        SharedVector<BaseType> const &values, bool const linear,
+                                        size_t const first, size_t const last) {
+  double const span = seconds(timestamps[first], timestamps[last]);
+  pair<double, size_t> worst{-1, first + 1};
+  for (size_t k = first + 1; k < last; k++) {
+    double const ratio = span > 0 ? seconds(timestamps[first], timestamps[k]) / span : 0;
+    BaseType const expected
+        = linear ? interpolate(values[first], values[last], ratio) : values[first];
+    double const error = value_distance(values[k], expected);
+    if (error > worst.first) worst = {error, k};
+  }
+  return worst;
+}
+
+/**
+ * Largest distance between the points strictly between first and last and the
+ * segment replacing them, irrespective of time.
+ */
+pair<double, size_t> spatial_error(SharedVector<GeomPoint> const &points, size_t const first,
+                                   size_t const last) {
+  GeomPoint const &from = points[first];
+  GeomPoint const &to = points[last];
+  bool const has_z = from.has_z() && to.has_z();
+  double const dx = to.x() - from.x();
+  double const dy = to.y() - from.y();
+  double const dz = has_z ? to.z() - from.z() : 0;
+  double const length2 = dx * dx + dy * dy + dz * dz;
+  pair<double, size_t> worst{-1, first + 1};
+  for (size_t k = first + 1; k < last; k++) {
+    GeomPoint const &point = points[k];
+    // Closest point of the segment, i.e, the projection clamped to its ends
+    double ratio = 0;
+    if (length2 > 0) {
+      double const pz = has_z ? point.z() - from.z() : 0;
+      ratio = ((point.x() - from.x()) * dx + (point.y() - from.y()) * dy + pz * dz) / length2;
+      ratio = min(max(ratio, 0.0), 1.0);
+    }
+    double const error = point.distance(interpolate(from, to, ratio));
+    if (error > worst.first) worst = {error, k};
+  }
+  return worst;
+}
+
+/**
+ * Largest difference between the speeds of the segments between first and
+ * last and the speed of the segment replacing them.
+ */
+pair<double, size_t> speed_error(SharedVector<time_point> const &timestamps,
+                                 SharedVector<float> const &values, size_t const first,
+                                 size_t const last) {
+  double const speed = (static_cast<double>(values[last]) - values[first])
+                       / seconds(timestamps[first], timestamps[last]);
+  pair<double, size_t> worst{-1, first + 1};
+  for (size_t k = first; k < last; k++) {
+    double const segment_speed = (static_cast<double>(values[k + 1]) - values[k])
+                                 / seconds(timestamps[k], timestamps[k + 1]);
+    double const error = abs(segment_speed - speed);
+    // Either end of the segment can be kept, as long as it is strictly inside
+    if (error > worst.first) worst = {error, k == first ? k + 1 : k};
+  }
+  return worst;
+}
+
+/**
+ * Heading from one point to the other, in radians clockwise from the north, as
+ * PostGIS' ST_Azimuth.
+ */
+inline double segment_azimuth(GeomPoint const &from, GeomPoint const &to) {
+  constexpr double pi = 3.14159265358979323846;
+  double const azimuth = atan2(to.x() - from.x(), to.y() - from.y());
+  return azimuth < 0 ? azimuth + 2 * pi : azimuth;
+}
+
+/**
+ * Calls add(i, weight) for each instant, with the time in seconds its value
+ * stands for in an integral over the sequence. By the trapezoid rule, linear
+ * values stand for half of the segments on either side. Stepwise values hold
+ * over the segment they start.
+ */
+template <typename Add>
+inline void time_weights(SharedVector<time_point> const &timestamps, bool linear, Add add) {
+  size_t const n = timestamps.size();
+  double before = 0;
+  for (size_t i = 0; i < n; i++) {
+    double const after = i + 1 < n ? seconds(timestamps[i], timestamps[i + 1]) : 0;
+    add(i, linear ? (before + after) / 2 : after);
+    before = after;
+  }
+}
+
+}  // namespace
+
 template <typename BaseType> void TSequence<BaseType>::validate() {
   validate_common();
   // Check template specialization on Geometry for more validation
+  this->m_bbox = make_bbox(this->m_timestamps, this->m_values, m_lower_inc, m_upper_inc);
 }
 
 template <> void TSequence<GeomPoint>::validate() {
@@ -21,30 +197,32 @@ template <> void TSequence<GeomPoint>::validate() {
   TInstant<GeomPoint> instant = this->startInstant();
   if (instant.srid() * this->m_srid == 0) {
     if (this->m_srid != 0) {
-      set<TInstant<GeomPoint>> _instants;
-      for (TInstant<GeomPoint> const &instant : this->m_instants) {
-        _instants.insert(instant.with_srid(this->m_srid));
+      vector<GeomPoint> values = this->m_values.copy();
+      for (GeomPoint &value : values) {
+        if (value.srid() != this->m_srid) value = value.with_srid(this->m_srid);
       };
-      this->m_instants = _instants;
+      this->m_values = move(values);
     } else {
       this->m_srid = instant.srid();
     }
   }
 
   // All SRIDs must be equal
-  for (TInstant<GeomPoint> const &instant : this->m_instants) {
-    if (this->m_srid != instant.getValue().srid()) {
+  for (GeomPoint const &value : this->m_values) {
+    if (this->m_srid != value.srid()) {
       throw std::invalid_argument("Conflicting SRIDs provided. Given: " + to_string(this->m_srid)
-                                  + ", while Instant contains: " + to_string(instant.srid()));
+                                  + ", while Instant contains: " + to_string(value.srid()));
     }
   }
+
+  this->m_bbox = make_bbox(this->m_timestamps, this->m_values, m_lower_inc, m_upper_inc);
 }
 
 template <typename BaseType> TSequence<BaseType>::TSequence() {}
 
 template <typename BaseType>
-TSequence<BaseType>::TSequence(set<TInstant<BaseType>> &instants, bool lower_inc, bool upper_inc,
-                               Interpolation interpolation)
+TSequence<BaseType>::TSequence(set<TInstant<BaseType>> const &instants, bool lower_inc,
+                               bool upper_inc, Interpolation interpolation)
     : TemporalSet<BaseType>(instants),
       m_lower_inc(lower_inc),
       m_upper_inc(upper_inc),
@@ -52,29 +230,36 @@ TSequence<BaseType>::TSequence(set<TInstant<BaseType>> &instants, bool lower_inc
   validate();
 }
 
+template <typename BaseType>
+TSequence<BaseType>::TSequence(vector<time_point> timestamps, vector<BaseType> values,
+                               bool lower_inc, bool upper_inc, Interpolation interpolation)
+    : TemporalSet<BaseType>(move(timestamps), move(values)),
+      m_lower_inc(lower_inc),
+      m_upper_inc(upper_inc),
+      m_interpolation(interpolation) {
+  validate();
+}
+
 template <typename BaseType>
 TSequence<BaseType>::TSequence(set<string> const &instants, bool lower_inc, bool upper_inc,
                                Interpolation interpolation)
     : m_lower_inc(lower_inc), m_upper_inc(upper_inc), m_interpolation(interpolation) {
-  TSequence<BaseType> instant_set;
-  for (auto const &e : instants) this->m_instants.insert(TInstant<BaseType>(e));
+  this->parse_instants(instants);
   validate();
 }
 
 template <typename BaseType> TSequence<BaseType>::TSequence(string const &serialized) {
+  // Reading validates
   stringstream ss(serialized);
-  TSequence<BaseType> seq;
-  ss >> seq;
-  *this = seq;
-  validate();
+  ss >> *this;
 }
 
 // Extra constructors for Geometry base type
 // Note: Don't forget to instantiate the templates!
 
 template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
-TSequence<BaseType>::TSequence(set<TInstant<BaseType>> &instants, bool lower_inc, bool upper_inc,
-                               int srid, Interpolation interpolation)
+TSequence<BaseType>::TSequence(set<TInstant<BaseType>> const &instants, bool lower_inc,
+                               bool upper_inc, int srid, Interpolation interpolation)
     : TemporalSet<BaseType>(instants),
       m_lower_inc(lower_inc),
       m_upper_inc(upper_inc),
@@ -87,8 +272,7 @@ template <typename BaseType> template <typename B, typename is_geometry<B>::type
 TSequence<BaseType>::TSequence(set<string> const &instants, bool lower_inc, bool upper_inc,
                                int srid, Interpolation interpolation)
     : m_lower_inc(lower_inc), m_upper_inc(upper_inc), m_interpolation(interpolation) {
-  TSequence<BaseType> instant_set;
-  for (auto const &e : instants) this->m_instants.insert(TInstant<BaseType>(e));
+  this->parse_instants(instants);
   this->m_srid = srid;
   validate();
 }
@@ -96,9 +280,7 @@ TSequence<BaseType>::TSequence(set<string> const &instants, bool lower_inc, bool
 template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
 TSequence<BaseType>::TSequence(string const &serialized, int srid) {
   stringstream ss(serialized);
-  TSequence<BaseType> seq;
-  ss >> seq;
-  *this = seq;
+  ss >> *this;
 
   // When both string and int have non zero SRIDs, it gets a bit tricky
   if (srid * this->m_srid != 0) {
@@ -118,8 +300,9 @@ TSequence<BaseType>::TSequence(string const &serialized, int srid) {
   validate();
 }
 
-template TSequence<GeomPoint>::TSequence(set<TInstant<GeomPoint>> &instants, bool lower_inc,
-                                         bool upper_inc, int srid, Interpolation interpolation);
+template TSequence<GeomPoint>::TSequence(set<TInstant<GeomPoint>> const &instants,
+                                         bool lower_inc, bool upper_inc, int srid,
+                                         Interpolation interpolation);
 template TSequence<GeomPoint>::TSequence(set<string> const &instants, bool lower_inc,
                                          bool upper_inc, int srid, Interpolation interpolation);
 template TSequence<GeomPoint>::TSequence(string const &serialized, int srid);
@@ -128,10 +311,13 @@ template <typename BaseType> template <typename B, typename is_geometry<B>::type
 TSequence<BaseType> TSequence<BaseType>::with_srid(int srid) const {
   if (this->m_srid == srid) return *this;
   TSequence<BaseType> sequence = *this;
-  set<TInstant<BaseType>> s;
-  for (auto const &e : this->m_instants) s.insert(e.with_srid(srid));
-  sequence.m_instants = s;
+  vector<GeomPoint> values = sequence.m_values.copy();
+  for (GeomPoint &value : values) {
+    if (value.srid() != srid) value = value.with_srid(srid);
+  }
+  sequence.m_values = move(values);
   sequence.m_srid = srid;
+  sequence.m_bbox = make_bbox(sequence.m_timestamps, sequence.m_values);
   return sequence;
 }
 
@@ -145,8 +331,216 @@ TSequence<BaseType> TSequence<BaseType>::with_interp(Interpolation interpolation
   return sequence;
 }
 
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+TSequence<BaseType> TSequence<BaseType>::simplify(double epsilon, bool synchronized) const {
+  SharedVector<time_point> const &timestamps = this->m_timestamps;
+  SharedVector<GeomPoint> const &points = this->m_values;
+  bool const linear = this->m_interpolation == Interpolation::Linear;
+  return with_instants(
+      douglas_peucker(timestamps.size(), epsilon, [&](size_t first, size_t last) {
+        if (synchronized || !linear) {
+          return synchronized_error(timestamps, points, linear, first, last);
+        }
+        return spatial_error(points, first, last);
+      }));
+}
+
+template TSequence<GeomPoint> TSequence<GeomPoint>::simplify(double epsilon,
+                                                             bool synchronized) const;
+
+template <typename BaseType>
+template <typename B, typename std::enable_if<std::is_same<B, float>::value>::type *>
+TSequence<BaseType> TSequence<BaseType>::simplify(double epsilon) const {
+  SharedVector<time_point> const &timestamps = this->m_timestamps;
+  SharedVector<float> const &values = this->m_values;
+  bool const linear = this->m_interpolation == Interpolation::Linear;
+  return with_instants(
+      douglas_peucker(timestamps.size(), epsilon, [&](size_t first, size_t last) {
+        return synchronized_error(timestamps, values, linear, first, last);
+      }));
+}
+
+template TSequence<float> TSequence<float>::simplify(double epsilon) const;
+
+template <typename BaseType>
+template <typename B, typename std::enable_if<std::is_same<B, float>::value>::type *>
+TSequence<BaseType> TSequence<BaseType>::simplifyMaxSpeed(double epsilon) const {
+  if (this->m_interpolation != Interpolation::Linear) {
+    throw invalid_argument("Only sequences with linear interpolation have a speed");
+  }
+  SharedVector<time_point> const &timestamps = this->m_timestamps;
+  SharedVector<float> const &values = this->m_values;
+  return with_instants(
+      douglas_peucker(timestamps.size(), epsilon, [&](size_t first, size_t last) {
+        return speed_error(timestamps, values, first, last);
+      }));
+}
+
+template TSequence<float> TSequence<float>::simplifyMaxSpeed(double epsilon) const;
+
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+double TSequence<BaseType>::length() const {
+  if (this->m_interpolation != Interpolation::Linear) return 0;
+  SharedVector<GeomPoint> const &points = this->m_values;
+  double length = 0;
+  for (size_t i = 1; i < points.size(); i++) {
+    length += points[i - 1].distance(points[i]);
+  }
+  return length;
+}
+
+template double TSequence<GeomPoint>::length() const;
+
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+TSequence<float> TSequence<BaseType>::cumulativeLength() const {
+  return cumulative_length(0);
+}
+
+template TSequence<float> TSequence<GeomPoint>::cumulativeLength() const;
+
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+TSequence<float> TSequence<BaseType>::cumulative_length(double start) const {
+  SharedVector<GeomPoint> const &points = this->m_values;
+  bool const linear = this->m_interpolation == Interpolation::Linear;
+  vector<float> lengths;
+  lengths.reserve(points.size());
+  double length = start;
+  lengths.push_back(static_cast<float>(length));
+  for (size_t i = 1; i < points.size(); i++) {
+    if (linear) length += points[i - 1].distance(points[i]);
+    lengths.push_back(static_cast<float>(length));
+  }
+  return TSequence<float>(this->m_timestamps.copy(), move(lengths), this->m_lower_inc,
+                          this->m_upper_inc, this->m_interpolation);
+}
+
+template TSequence<float> TSequence<GeomPoint>::cumulative_length(double start) const;
+
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+unique_ptr<TSequence<float>> TSequence<BaseType>::speed() const {
+  SharedVector<time_point> const &timestamps = this->m_timestamps;
+  SharedVector<GeomPoint> const &points = this->m_values;
+  size_t const n = timestamps.size();
+  if (n < 2) return nullptr;
+  bool const linear = this->m_interpolation == Interpolation::Linear;
+  vector<float> speeds;
+  speeds.reserve(n);
+  for (size_t i = 1; i < n; i++) {
+    double const length = linear ? points[i - 1].distance(points[i]) : 0;
+    speeds.push_back(static_cast<float>(length / seconds(timestamps[i - 1], timestamps[i])));
+  }
+  // The last instant only closes the last segment
+  speeds.push_back(speeds.back());
+  return make_unique<TSequence<float>>(timestamps.copy(), move(speeds), this->m_lower_inc,
+                                       this->m_upper_inc, Interpolation::Stepwise);
+}
+
+template unique_ptr<TSequence<float>> TSequence<GeomPoint>::speed() const;
+
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+unique_ptr<TSequenceSet<float>> TSequence<BaseType>::azimuth() const {
+  if (this->m_interpolation != Interpolation::Linear) return nullptr;
+  SharedVector<time_point> const &timestamps = this->m_timestamps;
+  SharedVector<GeomPoint> const &points = this->m_values;
+  size_t const n = timestamps.size();
+
+  // Each run of consecutive segments along which the point moves gives a sequence
+  set<TSequence<float>> sequences;
+  vector<time_point> run_timestamps;
+  vector<float> azimuths;
+  size_t run_start = 0;
+  for (size_t i = 1; i < n; i++) {
+    bool const moves = points[i - 1].x() != points[i].x() || points[i - 1].y() != points[i].y();
+    if (moves) {
+      if (azimuths.empty()) run_start = i - 1;
+      run_timestamps.push_back(timestamps[i - 1]);
+      azimuths.push_back(static_cast<float>(segment_azimuth(points[i - 1], points[i])));
+    }
+    if (azimuths.empty() || (moves && i < n - 1)) continue;
+
+    // The run ends with the instant closing its last segment
+    size_t const run_end = moves ? i : i - 1;
+    run_timestamps.push_back(timestamps[run_end]);
+    azimuths.push_back(azimuths.back());
+    bool const lower_inc = run_start == 0 ? this->m_lower_inc : true;
+    bool const upper_inc = run_end == n - 1 ? this->m_upper_inc : false;
+    sequences.insert(TSequence<float>(move(run_timestamps), move(azimuths), lower_inc, upper_inc,
+                                      Interpolation::Stepwise));
+    run_timestamps.clear();
+    azimuths.clear();
+  }
+  if (sequences.empty()) return nullptr;
+  return make_unique<TSequenceSet<float>>(move(sequences), Interpolation::Stepwise);
+}
+
+template unique_ptr<TSequenceSet<float>> TSequence<GeomPoint>::azimuth() const;
+
+template <typename BaseType> template <typename B, typename is_number<B>::type *>
+double TSequence<BaseType>::integral() const {
+  SharedVector<BaseType> const &values = this->m_values;
+  double integral = 0;
+  time_weights(this->m_timestamps, this->m_interpolation == Interpolation::Linear,
+               [&](size_t i, double weight) { integral += values[i] * weight; });
+  return integral;
+}
+
+template double TSequence<int>::integral() const;
+template double TSequence<float>::integral() const;
+
+template <typename BaseType> template <typename B, typename is_number<B>::type *>
+double TSequence<BaseType>::twAvg() const {
+  double const duration = seconds(this->m_timestamps.front(), this->m_timestamps.back());
+  if (duration == 0) return this->m_values.front();
+  return integral() / duration;
+}
+
+template double TSequence<int>::twAvg() const;
+template double TSequence<float>::twAvg() const;
+
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+GeomPoint TSequence<BaseType>::twCentroid() const {
+  SharedVector<GeomPoint> const &points = this->m_values;
+  double const duration = seconds(this->m_timestamps.front(), this->m_timestamps.back());
+  double x = 0, y = 0, z = 0;
+  if (duration == 0) {
+    x = points.front().x();
+    y = points.front().y();
+    z = points.front().z();
+  } else {
+    time_weights(this->m_timestamps, this->m_interpolation == Interpolation::Linear,
+                 [&](size_t i, double weight) {
+                   x += points[i].x() * weight;
+                   y += points[i].y() * weight;
+                   z += points[i].z() * weight;
+                 });
+    x /= duration;
+    y /= duration;
+    z /= duration;
+  }
+  if (!points.front().has_z()) return GeomPoint(x, y, this->srid());
+  return GeomPoint(x, y, z, this->srid());
+}
+
+template GeomPoint TSequence<GeomPoint>::twCentroid() const;
+
+template <typename BaseType>
+TSequence<BaseType> TSequence<BaseType>::with_instants(vector<size_t> const &positions) const {
+  if (positions.size() == this->m_timestamps.size()) return *this;
+  vector<time_point> timestamps;
+  vector<BaseType> values;
+  timestamps.reserve(positions.size());
+  values.reserve(positions.size());
+  for (size_t i : positions) {
+    timestamps.push_back(this->m_timestamps[i]);
+    values.push_back(this->m_values[i]);
+  }
+  // Points carry the SRID, which the new sequence picks up from them
+  return TSequence<BaseType>(move(timestamps), move(values), this->m_lower_inc,
+                             this->m_upper_inc, this->m_interpolation);
+}
+
 template <typename BaseType> void TSequence<BaseType>::validate_common() {
-  size_t sz = this->m_instants.size();
+  size_t sz = this->m_timestamps.size();
   if (sz < 1) {
     throw invalid_argument("A sequence should have at least one instant");
   }
@@ -183,27 +577,21 @@ int TSequence<BaseType>::compare_internal(Temporal<BaseType> const &other) const
 
   TSequence<BaseType> const *that = dynamic_cast<TSequence<BaseType> const *>(&other);
   // Compare number of instants
-  if (this->m_instants.size() < that->m_instants.size()) return -1;
-  if (this->m_instants.size() > that->m_instants.size()) return 1;
+  size_t const n = this->m_timestamps.size();
+  if (n < that->m_timestamps.size()) return -1;
+  if (n > that->m_timestamps.size()) return 1;
 
   // Compare bounds
   // [ < (, ) < ]
-  if ((this->m_lower_inc && !that->m_lower_inc) || (!this->m_upper_inc && that->m_upper_inc))
-    return -1;
-  // ( > [, ] > )
-  if ((that->m_lower_inc && !this->m_lower_inc) || (!that->m_upper_inc && this->m_upper_inc))
-    return 1;
-
-  // Compare instant by instant
-  auto lhs_instants = this->instants();
-  auto rhs_instants = that->instants();
-  auto lhs = lhs_instants.begin();
-  auto rhs = rhs_instants.begin();
-  while (lhs != lhs_instants.end()) {
-    if (*lhs < *rhs) return -1;
-    if (*lhs > *rhs) return 1;
-    lhs++;
-    rhs++;
+  if (this->m_lower_inc != that->m_lower_inc) return this->m_lower_inc ? -1 : 1;
+  if (this->m_upper_inc != that->m_upper_inc) return this->m_upper_inc ? 1 : -1;
+
+  // Compare instant by instant, i.e, timestamp and then value
+  for (size_t i = 0; i < n; i++) {
+    if (this->m_timestamps[i] < that->m_timestamps[i]) return -1;
+    if (this->m_timestamps[i] > that->m_timestamps[i]) return 1;
+    if (this->m_values[i] < that->m_values[i]) return -1;
+    if (this->m_values[i] > that->m_values[i]) return 1;
   }
 
   // Compare Interpolation
@@ -236,6 +624,16 @@ template <> int TSequence<GeomPoint>::compare(Temporal<GeomPoint> const &other)
   return 0;
 }
 
+template <typename BaseType> size_t TSequence<BaseType>::hash() const {
+  return hash_fields(this->hash_instants(), this->m_lower_inc, this->m_upper_inc,
+                     static_cast<int>(this->m_interpolation));
+}
+
+template <> size_t TSequence<GeomPoint>::hash() const {
+  return hash_fields(this->hash_instants(), this->m_lower_inc, this->m_upper_inc,
+                     static_cast<int>(this->m_interpolation), this->srid());
+}
+
 template <typename BaseType> bool TSequence<BaseType>::lower_inc() const {
   return this->m_lower_inc;
 }
@@ -252,18 +650,9 @@ template <typename BaseType> duration_ms TSequence<BaseType>::timespan() const {
 }
 
 template <typename BaseType> set<Range<BaseType>> TSequence<BaseType>::getValues() const {
-  if (this->m_instants.size() == 0) return {};
-  BaseType min = this->m_instants.begin()->getValue();
-  BaseType max = this->m_instants.begin()->getValue();
-  for (auto const &e : this->m_instants) {
-    if (e.getValue() < min) {
-      min = e.getValue();
-    }
-    if (e.getValue() > max) {
-      max = e.getValue();
-    }
-  }
-  return {Range<BaseType>(min, max, this->m_lower_inc, this->m_upper_inc)};
+  if (this->m_values.size() == 0) return {};
+  auto const bounds = value_bounds(this->m_bbox, this->m_values);
+  return {Range<BaseType>(bounds.first, bounds.second, this->m_lower_inc, this->m_upper_inc)};
 }
 
 template <typename BaseType> PeriodSet TSequence<BaseType>::getTime() const {
@@ -282,22 +671,142 @@ unique_ptr<TSequence<BaseType>> TSequence<BaseType>::shift(duration_ms const tim
 
 template <typename BaseType>
 TSequence<BaseType> *TSequence<BaseType>::shift_impl(duration_ms const timedelta) const {
-  set<TInstant<BaseType>> s;
-  for (auto const &e : this->m_instants) {
-    s.insert(TInstant<BaseType>(e.getValue(), e.getTimestamp() + timedelta));
+  vector<time_point> timestamps;
+  timestamps.reserve(this->m_timestamps.size());
+  for (auto const &t : this->m_timestamps) {
+    timestamps.push_back(t + timedelta);
   }
-  return new TSequence<BaseType>(s, m_lower_inc, m_upper_inc);
+  return new TSequence<BaseType>(move(timestamps), this->m_values.copy(), m_lower_inc, m_upper_inc);
 }
 
 template <typename BaseType>
 bool TSequence<BaseType>::intersectsTimestamp(time_point const datetime) const {
-  return this->period().contains_timestamp(datetime);
+  time_point const start = this->m_timestamps.front();
+  time_point const end = this->m_timestamps.back();
+  return (start < datetime || (start == datetime && this->m_lower_inc))
+         && (datetime < end || (datetime == end && this->m_upper_inc));
+}
+
+template <typename BaseType>
+BaseType TSequence<BaseType>::value_at(time_point const t, size_t &segment) const {
+  SharedVector<time_point> const &timestamps = this->m_timestamps;
+  size_t const n = timestamps.size();
+  while (segment + 1 < n && timestamps[segment + 1] <= t) segment++;
+
+  if (timestamps[segment] == t || segment + 1 == n
+      || this->m_interpolation == Interpolation::Stepwise) {
+    return this->m_values[segment];
+  }
+
+  time_point const from = timestamps[segment];
+  double const ratio = static_cast<double>((t - from).count())
+                       / static_cast<double>((timestamps[segment + 1] - from).count());
+  return interpolate(this->m_values[segment], this->m_values[segment + 1], ratio);
+}
+
+template <typename BaseType>
+BaseType TSequence<BaseType>::valueAtTimestamp(time_point const datetime) const {
+  if (!this->intersectsTimestamp(datetime)) {
+    throw invalid_argument("The temporal value is not defined at "
+                           + write_ISO8601_time(datetime));
+  }
+  auto it = upper_bound(this->m_timestamps.begin(), this->m_timestamps.end(), datetime);
+  size_t segment = it - this->m_timestamps.begin() - 1;
+  return this->value_at(datetime, segment);
+}
+
+template <typename BaseType> void TSequence<BaseType>::values_at_timestamps_impl(
+    vector<time_point> const &timestamps, vector<pair<BaseType, time_point>> &values) const {
+  size_t segment = 0;
+  for (time_point const &t : timestamps) {
+    if (this->intersectsTimestamp(t)) {
+      values.emplace_back(this->value_at(t, segment), t);
+    }
+  }
+}
+
+template <typename BaseType>
+TSequence<BaseType> *TSequence<BaseType>::at_period(Period const &period) const {
+  SharedVector<time_point> const &timestamps = this->m_timestamps;
+  time_point const start = timestamps.front();
+  time_point const end = timestamps.back();
+
+  // Bounds of the intersection
+  time_point lower = start;
+  bool lower_inc = this->m_lower_inc;
+  if (period.lower() > start) {
+    lower = period.lower();
+    lower_inc = period.lower_inc();
+  } else if (period.lower() == start) {
+    lower_inc = lower_inc && period.lower_inc();
+  }
+
+  time_point upper = end;
+  bool upper_inc = this->m_upper_inc;
+  if (period.upper() < end) {
+    upper = period.upper();
+    upper_inc = period.upper_inc();
+  } else if (period.upper() == end) {
+    upper_inc = upper_inc && period.upper_inc();
+  }
+
+  if (lower > upper || (lower == upper && !(lower_inc && upper_inc))) return nullptr;
+
+  // Instants strictly between the bounds
+  auto const first = upper_bound(timestamps.begin(), timestamps.end(), lower);
+  auto const last = lower_bound(first, timestamps.end(), upper);
+  size_t const i = first - timestamps.begin();
+  size_t const j = last - timestamps.begin();
+
+  vector<time_point> result_timestamps;
+  vector<BaseType> result_values;
+  result_timestamps.reserve(j - i + 2);
+  result_values.reserve(j - i + 2);
+
+  size_t segment = i - 1;
+  result_timestamps.push_back(lower);
+  result_values.push_back(this->value_at(lower, segment));
+  result_timestamps.insert(result_timestamps.end(), first, last);
+  result_values.insert(result_values.end(), this->m_values.begin() + i, this->m_values.begin() + j);
+
+  if (lower < upper) {
+    // With stepwise interpolation, the value held until an exclusive cut is the previous one
+    segment = j - 1;
+    bool const held = this->m_interpolation == Interpolation::Stepwise && !upper_inc && upper < end;
+    result_timestamps.push_back(upper);
+    result_values.push_back(held ? this->m_values[segment] : this->value_at(upper, segment));
+  }
+
+  return new TSequence<BaseType>(move(result_timestamps), move(result_values), lower_inc,
+                                 upper_inc, this->m_interpolation);
+}
+
+template <typename BaseType>
+Temporal<BaseType> *TSequence<BaseType>::at_periods_impl(vector<Period> const &periods) const {
+  // Only a contiguous run of the periods can intersect the sequence
+  auto it
+      = lower_bound(periods.begin(), periods.end(), this->startTimestamp(),
+                    [](Period const &period, time_point const t) { return period.upper() < t; });
+  set<TSequence<BaseType>> pieces;
+  for (; it != periods.end() && it->lower() <= this->endTimestamp(); it++) {
+    unique_ptr<TSequence<BaseType>> piece(this->at_period(*it));
+    if (piece) pieces.insert(move(*piece));
+  }
+
+  if (pieces.empty()) return nullptr;
+  if (pieces.size() == 1) return new TSequence<BaseType>(*pieces.begin());
+  return new TSequenceSet<BaseType>(pieces, this->m_interpolation);
 }
 
 template <typename BaseType> bool TSequence<BaseType>::intersectsPeriod(Period const period) const {
   return this->period().overlap(period);
 }
 
+template <typename BaseType>
+bool TSequence<BaseType>::intersects_timestamp_set_impl(TimestampSet const &timestampset) const {
+  return timestampset.overlap(this->period());
+}
+
 template <typename BaseType>
 istream &TSequence<BaseType>::read_internal(istream &in, bool with_interp) {
   char c;
@@ -334,17 +843,16 @@ istream &TSequence<BaseType>::read_internal(istream &in, bool with_interp) {
   c = consume_one_of(in, "[(");
   bool const lower_inc = c == '[';
 
-  set<TInstant<BaseType>> s = {};
+  vector<time_point> timestamps;
+  vector<BaseType> values;
 
   TInstant<BaseType> instant;
-  in >> instant;
-  s.insert(instant);
-
   while (true) {
+    in >> instant;
+    timestamps.push_back(instant.getTimestamp());
+    values.push_back(instant.getValue());
     in >> c;
     if (c != ',') break;
-    in >> instant;
-    s.insert(instant);
   }
 
   if (c != ']' && c != ')') {
@@ -352,7 +860,8 @@ istream &TSequence<BaseType>::read_internal(istream &in, bool with_interp) {
   }
   bool const upper_inc = c == ']';
 
-  this->m_instants = s;
+  TemporalSet<BaseType>::sort_instants(timestamps, values);
+  this->assign_instants(move(timestamps), move(values));
   this->m_lower_inc = lower_inc;
   this->m_upper_inc = upper_inc;
   this->m_interpolation = interp;
@@ -399,13 +908,13 @@ ostream &TSequence<BaseType>::write_internal(ostream &os, bool with_interp) cons
 
   bool first = true;
   os << (this->m_lower_inc ? "[" : "(");
-  for (auto const &instant : this->instants()) {
+  for (size_t i = 0; i < this->m_timestamps.size(); i++) {
     if (first)
       first = false;
     else
       os << ", ";
     // We do not output SRID coming from instant
-    instant.write(os, false);
+    this->instant_at(i).write(os, false);
   }
   os << (this->m_upper_inc ? "]" : ")");
   return os;
@@ -0,0 +1,135 @@
+#include <meos/types/temporal/TSequenceBuilder.hpp>
+#include <meos/util/serializing.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace meos {
+using namespace std;
+
+namespace {
+
+template <typename BaseType> void match_srid(BaseType &, int &, bool) {}
+
+void match_srid(GeomPoint &value, int &srid, bool first) {
+  if (first && srid == SRID_DEFAULT) {
+    srid = value.srid();
+  } else if (value.srid() == SRID_DEFAULT) {
+    value = value.with_srid(srid);
+  } else if (value.srid() != srid) {
+    throw invalid_argument("Conflicting SRIDs provided. Given: " + to_string(value.srid())
+                           + ", while the sequence has: " + to_string(srid));
+  }
+}
+
+template <typename BaseType> void assign_srid(TSequence<BaseType> &, int) {}
+
+void assign_srid(TSequence<GeomPoint> &sequence, int srid) { sequence.m_srid = srid; }
+
+}  // namespace
+
+template <typename BaseType>
+TSequenceBuilder<BaseType>::TSequenceBuilder(Interpolation interpolation)
+    : m_interpolation(interpolation),
+      m_timestamps(make_shared<vector<time_point>>()),
+      m_values(make_shared<vector<BaseType>>()) {
+  if (interpolation == Interpolation::Linear && is_discrete_v<BaseType>) {
+    throw invalid_argument("Cannot assign linear interpolation to a discrete base type");
+  }
+}
+
+template <typename BaseType> void TSequenceBuilder<BaseType>::reserve(size_t capacity) {
+  if (capacity > this->m_timestamps->capacity()) grow(capacity);
+}
+
+template <typename BaseType> size_t TSequenceBuilder<BaseType>::size() const {
+  return this->m_timestamps->size();
+}
+
+template <typename BaseType> bool TSequenceBuilder<BaseType>::empty() const {
+  return this->m_timestamps->empty();
+}
+
+template <typename BaseType> void TSequenceBuilder<BaseType>::append(BaseType value, time_point t) {
+  vector<time_point> const &timestamps = *this->m_timestamps;
+  if (!timestamps.empty() && t <= timestamps.back()) {
+    throw invalid_argument("Instants should be appended in increasing order of time, got "
+                           + write_ISO8601_time(t) + " after "
+                           + write_ISO8601_time(timestamps.back()));
+  }
+  match_srid(value, this->m_srid, timestamps.empty());
+
+  bbox_t<BaseType> const bbox = make_bbox(t, value);
+  this->m_bbox = timestamps.empty() ? bbox : bbox_union(this->m_bbox, bbox);
+  if (timestamps.size() == timestamps.capacity()) grow(max<size_t>(2 * timestamps.size(), 1));
+  this->m_timestamps->push_back(t);
+  this->m_values->push_back(move(value));
+}
+
+template <typename BaseType> void TSequenceBuilder<BaseType>::grow(size_t const capacity) {
+  if (this->m_timestamps.use_count() == 1 && this->m_values.use_count() == 1) {
+    this->m_timestamps->reserve(capacity);
+    this->m_values->reserve(capacity);
+    return;
+  }
+  // Snapshots keep the old buffers
+  auto timestamps = make_shared<vector<time_point>>();
+  timestamps->reserve(capacity);
+  timestamps->assign(this->m_timestamps->begin(), this->m_timestamps->end());
+  auto values = make_shared<vector<BaseType>>();
+  values->reserve(capacity);
+  values->assign(this->m_values->begin(), this->m_values->end());
+  this->m_timestamps = move(timestamps);
+  this->m_values = move(values);
+}
+
+template <typename BaseType>
+void TSequenceBuilder<BaseType>::append(TInstant<BaseType> const &instant) {
+  append(instant.getValue(), instant.getTimestamp());
+}
+
+template <typename BaseType> TInstant<BaseType> TSequenceBuilder<BaseType>::endInstant() const {
+  if (this->m_timestamps->empty()) {
+    throw invalid_argument("At least one instant expected");
+  }
+  return TInstant<BaseType>(this->m_values->back(), this->m_timestamps->back());
+}
+
+template <typename BaseType> TSequence<BaseType> TSequenceBuilder<BaseType>::snapshot() const {
+  size_t const n = this->m_timestamps->size();
+  return make_sequence(SharedVector<time_point>(this->m_timestamps, n),
+                       SharedVector<BaseType>(this->m_values, n));
+}
+
+template <typename BaseType> TSequence<BaseType> TSequenceBuilder<BaseType>::build() {
+  TSequence<BaseType> sequence = snapshot();
+  this->m_timestamps = make_shared<vector<time_point>>();
+  this->m_values = make_shared<vector<BaseType>>();
+  return sequence;
+}
+
+template <typename BaseType> TSequence<BaseType> TSequenceBuilder<BaseType>::make_sequence(
+    SharedVector<time_point> timestamps, SharedVector<BaseType> values) const {
+  if (timestamps.empty()) {
+    throw invalid_argument("A sequence should have at least one instant");
+  }
+
+  // Everything was checked while appending
+  TSequence<BaseType> sequence;
+  sequence.m_num_timestamps = timestamps.size();
+  sequence.m_timestamps = move(timestamps);
+  sequence.m_values = move(values);
+  sequence.m_bbox = this->m_bbox;
+  sequence.m_lower_inc = true;
+  sequence.m_upper_inc = true;
+  sequence.m_interpolation = this->m_interpolation;
+  assign_srid(sequence, this->m_srid);
+  return sequence;
+}
+
+template class TSequenceBuilder<bool>;
+template class TSequenceBuilder<int>;
+template class TSequenceBuilder<float>;
+template class TSequenceBuilder<string>;
+template class TSequenceBuilder<GeomPoint>;
+
+}  // namespace meos
@@ -1,6 +1,8 @@
+#include <algorithm>
 #include <iomanip>
 #include <meos/types/temporal/Interpolation.hpp>
 #include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/util/hash.hpp>
 #include <sstream>
 #include <string>
 
@@ -10,6 +12,8 @@ using namespace std;
 template <typename BaseType> void TSequenceSet<BaseType>::validate() {
   validate_common();
   // Check template specialization on Geometry for more validation
+  update_bbox();
+  update_index();
 }
 
 template <> void TSequenceSet<GeomPoint>::validate() {
@@ -22,11 +26,12 @@ template <> void TSequenceSet<GeomPoint>::validate() {
   TSequence<GeomPoint> sequence = this->startSequence();
   if (sequence.srid() * this->m_srid == 0) {
     if (this->m_srid != 0) {
+      // Same order as before, so each sequence goes at the end
       set<TSequence<GeomPoint>> _sequences;
       for (TSequence<GeomPoint> const &sequence : this->m_sequences) {
-        _sequences.insert(sequence.with_srid(this->m_srid));
+        _sequences.insert(_sequences.end(), sequence.with_srid(this->m_srid));
       };
-      this->m_sequences = _sequences;
+      this->m_sequences = move(_sequences);
     } else {
       this->m_srid = sequence.srid();
     }
@@ -39,10 +44,75 @@ template <> void TSequenceSet<GeomPoint>::validate() {
                                   + ", while Sequence contains: " + to_string(sequence.srid()));
     }
   }
+
+  update_bbox();
+  update_index();
+}
+
+template <typename BaseType> void TSequenceSet<BaseType>::update_bbox() {
+  auto it = this->m_sequences.begin();
+  this->m_bbox = it->boundingBox();
+  for (it++; it != this->m_sequences.end(); it++) {
+    this->m_bbox = bbox_union(this->m_bbox, it->boundingBox());
+  }
+}
+
+template <typename BaseType> void TSequenceSet<BaseType>::update_index() {
+  this->m_ordered.clear();
+  this->m_ordered.reserve(this->m_sequences.size());
+  for (auto const &e : this->m_sequences) this->m_ordered.push_back(&e);
+  sort(this->m_ordered.begin(), this->m_ordered.end(),
+       [](TSequence<BaseType> const *lhs, TSequence<BaseType> const *rhs) {
+         return lhs->startTimestamp() < rhs->startTimestamp()
+                || (lhs->startTimestamp() == rhs->startTimestamp() && lhs->lower_inc()
+                    && !rhs->lower_inc());
+       });
+
+  this->m_disjoint = true;
+  this->m_instants_before.assign(1, 0);
+  this->m_timestamps_before.assign(1, 0);
+  for (size_t i = 0; i < this->m_ordered.size(); i++) {
+    TSequence<BaseType> const &sequence = *this->m_ordered[i];
+    size_t shared_instant = 0, shared_timestamp = 0;
+    if (i > 0) {
+      // Only timestamps count, as a value may drop where two sequences touch
+      TSequence<BaseType> const &previous = *this->m_ordered[i - 1];
+      if (previous.m_timestamps.back() > sequence.m_timestamps.front()) {
+        this->m_disjoint = false;
+      } else if (previous.m_timestamps.back() == sequence.m_timestamps.front()) {
+        shared_timestamp = 1;
+        shared_instant = previous.m_values.back() == sequence.m_values.front() ? 1 : 0;
+      }
+    }
+    this->m_instants_before.push_back(this->m_instants_before.back()
+                                      + sequence.m_timestamps.size() - shared_instant);
+    this->m_timestamps_before.push_back(this->m_timestamps_before.back()
+                                        + sequence.m_timestamps.size() - shared_timestamp);
+  }
 }
 
 template <typename BaseType> TSequenceSet<BaseType>::TSequenceSet() {}
 
+template <typename BaseType> TSequenceSet<BaseType>::TSequenceSet(TSequenceSet const &other)
+    : Temporal<BaseType>(other),
+      TemporalComparators<TSequenceSet<BaseType>>(other),
+      TInstantFunctions<TSequenceSet<BaseType>, TInstant<BaseType>, BaseType>(other),
+      m_sequences(other.m_sequences),
+      m_interpolation(other.m_interpolation),
+      m_bbox(other.m_bbox) {
+  update_index();
+}
+
+template <typename BaseType>
+TSequenceSet<BaseType> &TSequenceSet<BaseType>::operator=(TSequenceSet const &other) {
+  Temporal<BaseType>::operator=(other);
+  this->m_sequences = other.m_sequences;
+  this->m_interpolation = other.m_interpolation;
+  this->m_bbox = other.m_bbox;
+  update_index();
+  return *this;
+}
+
 template <typename BaseType>
 TSequenceSet<BaseType>::TSequenceSet(set<TSequence<BaseType>> const &sequences,
                                      Interpolation interpolation)
@@ -50,6 +120,13 @@ TSequenceSet<BaseType>::TSequenceSet(set<TSequence<BaseType>> const &sequences,
   validate();
 }
 
+template <typename BaseType>
+TSequenceSet<BaseType>::TSequenceSet(set<TSequence<BaseType>> &&sequences,
+                                     Interpolation interpolation)
+    : m_sequences(move(sequences)), m_interpolation(interpolation) {
+  validate();
+}
+
 template <typename BaseType>
 TSequenceSet<BaseType>::TSequenceSet(set<string> const &ss, Interpolation interpolation)
     : m_interpolation(interpolation) {
@@ -58,11 +135,9 @@ TSequenceSet<BaseType>::TSequenceSet(set<string> const &ss, Interpolation interp
 }
 
 template <typename BaseType> TSequenceSet<BaseType>::TSequenceSet(string const &serialized) {
+  // Reading validates
   stringstream ss(serialized);
-  TSequenceSet<BaseType> sequence_set;
-  ss >> sequence_set;
-  *this = sequence_set;
-  validate();
+  ss >> *this;
 }
 
 // Extra constructors for Geometry base type
@@ -76,6 +151,14 @@ TSequenceSet<BaseType>::TSequenceSet(set<TSequence<BaseType>> const &sequences,
   validate();
 }
 
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+TSequenceSet<BaseType>::TSequenceSet(set<TSequence<BaseType>> &&sequences, int srid,
+                                     Interpolation interpolation)
+    : m_sequences(move(sequences)), m_interpolation(interpolation) {
+  this->m_srid = srid;
+  validate();
+}
+
 template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
 TSequenceSet<BaseType>::TSequenceSet(set<string> const &ss, int srid, Interpolation interpolation)
     : m_interpolation(interpolation) {
@@ -87,9 +170,7 @@ TSequenceSet<BaseType>::TSequenceSet(set<string> const &ss, int srid, Interpolat
 template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
 TSequenceSet<BaseType>::TSequenceSet(string const &serialized, int srid) {
   stringstream ss(serialized);
-  TSequenceSet<BaseType> sequence_set;
-  ss >> sequence_set;
-  *this = sequence_set;
+  ss >> *this;
 
   // When both string and int have non zero SRIDs, it gets a bit tricky
   if (srid * this->m_srid != 0) {
@@ -111,6 +192,7 @@ TSequenceSet<BaseType>::TSequenceSet(string const &serialized, int srid) {
 
 // clang-format off
 template TSequenceSet<GeomPoint>::TSequenceSet(set<TSequence<GeomPoint>> const &sequences, int srid, Interpolation interpolation);
+template TSequenceSet<GeomPoint>::TSequenceSet(set<TSequence<GeomPoint>> &&sequences, int srid, Interpolation interpolation);
 template TSequenceSet<GeomPoint>::TSequenceSet(set<string> const &sequences, int srid, Interpolation interpolation);
 template TSequenceSet<GeomPoint>::TSequenceSet(string const &serialized, int srid);
 // clang-format on
@@ -136,9 +218,9 @@ template <typename BaseType> void TSequenceSet<BaseType>::validate_common() {
     if (non_defult_interp_on_seq_set) {
       set<TSequence<BaseType>> _sequences;
       for (TSequence<BaseType> const &sequence : this->m_sequences) {
-        _sequences.insert(sequence.with_interp(this->m_interpolation));
+        _sequences.insert(_sequences.end(), sequence.with_interp(this->m_interpolation));
       };
-      this->m_sequences = _sequences;
+      this->m_sequences = move(_sequences);
     } else {
       this->m_interpolation = s.interpolation();
     }
@@ -166,11 +248,9 @@ int TSequenceSet<BaseType>::compare_internal(Temporal<BaseType> const &other) co
   if (this->m_sequences.size() > that->m_sequences.size()) return 1;
 
   // Compare sequence by sequence
-  auto lhs_sequences = this->sequences();
-  auto rhs_sequences = that->sequences();
-  auto lhs = lhs_sequences.begin();
-  auto rhs = rhs_sequences.begin();
-  while (lhs != lhs_sequences.end()) {
+  auto lhs = this->m_sequences.begin();
+  auto rhs = that->m_sequences.begin();
+  while (lhs != this->m_sequences.end()) {
     if (*lhs < *rhs) return -1;
     if (*lhs > *rhs) return 1;
     lhs++;
@@ -207,6 +287,16 @@ template <> int TSequenceSet<GeomPoint>::compare(Temporal<GeomPoint> const &othe
   return 0;
 }
 
+template <typename BaseType> size_t TSequenceSet<BaseType>::hash() const {
+  return hash_fields(hash_range(this->m_sequences.begin(), this->m_sequences.end()),
+                     static_cast<int>(this->m_interpolation));
+}
+
+template <> size_t TSequenceSet<GeomPoint>::hash() const {
+  return hash_fields(hash_range(this->m_sequences.begin(), this->m_sequences.end()),
+                     static_cast<int>(this->m_interpolation), this->srid());
+}
+
 template <typename BaseType> Interpolation TSequenceSet<BaseType>::interpolation() const {
   return this->m_interpolation;
 }
@@ -226,7 +316,7 @@ template <typename BaseType> size_t TSequenceSet<BaseType>::numSequences() const
  * Start sequence.
  */
 template <typename BaseType> TSequence<BaseType> TSequenceSet<BaseType>::startSequence() const {
-  auto s = this->m_sequences;
+  auto const &s = this->m_sequences;
   if (s.size() <= 0) {
     throw "At least one sequence expected";
   }
@@ -237,7 +327,7 @@ template <typename BaseType> TSequence<BaseType> TSequenceSet<BaseType>::startSe
  * End sequence.
  */
 template <typename BaseType> TSequence<BaseType> TSequenceSet<BaseType>::endSequence() const {
-  auto s = this->m_sequences;
+  auto const &s = this->m_sequences;
   if (s.size() <= 0) {
     throw "At least one sequence expected";
   }
@@ -248,7 +338,7 @@ template <typename BaseType> TSequence<BaseType> TSequenceSet<BaseType>::endSequ
  * N-th distinct sequence.
  */
 template <typename BaseType> TSequence<BaseType> TSequenceSet<BaseType>::sequenceN(size_t n) const {
-  auto s = this->m_sequences;
+  auto const &s = this->m_sequences;
   if (s.size() <= n) {
     throw "At least " + std::to_string(n) + " sequence(s) expected";
   }
@@ -265,6 +355,140 @@ template <typename BaseType> set<TInstant<BaseType>> TSequenceSet<BaseType>::ins
   return s;
 }
 
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+double TSequenceSet<BaseType>::length() const {
+  double length = 0;
+  for (auto const &e : this->m_sequences) length += e.length();
+  return length;
+}
+
+template double TSequenceSet<GeomPoint>::length() const;
+
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+TSequenceSet<float> TSequenceSet<BaseType>::cumulativeLength() const {
+  // Each sequence starts from the length travelled along the earlier ones
+  set<TSequence<float>> s;
+  double length = 0;
+  for (auto const *e : this->m_ordered) {
+    s.insert(e->cumulative_length(length));
+    length += e->length();
+  }
+  return TSequenceSet<float>(move(s), this->m_interpolation);
+}
+
+template TSequenceSet<float> TSequenceSet<GeomPoint>::cumulativeLength() const;
+
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+unique_ptr<TSequenceSet<float>> TSequenceSet<BaseType>::speed() const {
+  set<TSequence<float>> s;
+  for (auto const &e : this->m_sequences) {
+    unique_ptr<TSequence<float>> speed = e.speed();
+    if (speed) s.insert(move(*speed));
+  }
+  if (s.empty()) return nullptr;
+  return make_unique<TSequenceSet<float>>(move(s), Interpolation::Stepwise);
+}
+
+template unique_ptr<TSequenceSet<float>> TSequenceSet<GeomPoint>::speed() const;
+
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+unique_ptr<TSequenceSet<float>> TSequenceSet<BaseType>::azimuth() const {
+  set<TSequence<float>> s;
+  for (auto const &e : this->m_sequences) {
+    unique_ptr<TSequenceSet<float>> azimuth = e.azimuth();
+    if (azimuth) {
+      s.insert(azimuth->storedSequences().begin(), azimuth->storedSequences().end());
+    }
+  }
+  if (s.empty()) return nullptr;
+  return make_unique<TSequenceSet<float>>(move(s), Interpolation::Stepwise);
+}
+
+template unique_ptr<TSequenceSet<float>> TSequenceSet<GeomPoint>::azimuth() const;
+
+template <typename BaseType> template <typename B, typename is_number<B>::type *>
+double TSequenceSet<BaseType>::integral() const {
+  double integral = 0;
+  for (auto const &e : this->m_sequences) integral += e.integral();
+  return integral;
+}
+
+template double TSequenceSet<int>::integral() const;
+template double TSequenceSet<float>::integral() const;
+
+template <typename BaseType> template <typename B, typename is_number<B>::type *>
+double TSequenceSet<BaseType>::twAvg() const {
+  double integral = 0, duration = 0, sum = 0;
+  for (auto const &e : this->m_sequences) {
+    integral += e.integral();
+    duration += chrono::duration<double>(e.m_timestamps.back() - e.m_timestamps.front()).count();
+    sum += e.m_values.front();
+  }
+  // Only instantaneous sequences, each of them has a single value
+  if (duration == 0) return sum / this->m_sequences.size();
+  return integral / duration;
+}
+
+template double TSequenceSet<int>::twAvg() const;
+template double TSequenceSet<float>::twAvg() const;
+
+template <typename BaseType> template <typename B, typename is_geometry<B>::type *>
+GeomPoint TSequenceSet<BaseType>::twCentroid() const {
+  // The centroid of each sequence weighs as much as its duration
+  double x = 0, y = 0, z = 0, duration = 0;
+  for (auto const &e : this->m_sequences) {
+    double const weight
+        = chrono::duration<double>(e.m_timestamps.back() - e.m_timestamps.front()).count();
+    GeomPoint const centroid = e.twCentroid();
+    x += centroid.x() * weight;
+    y += centroid.y() * weight;
+    z += centroid.z() * weight;
+    duration += weight;
+  }
+  if (duration == 0) {
+    for (auto const &e : this->m_sequences) {
+      x += e.m_values.front().x();
+      y += e.m_values.front().y();
+      z += e.m_values.front().z();
+    }
+    duration = this->m_sequences.size();
+  }
+  if (!this->m_sequences.begin()->m_values.front().has_z()) {
+    return GeomPoint(x / duration, y / duration, this->srid());
+  }
+  return GeomPoint(x / duration, y / duration, z / duration, this->srid());
+}
+
+template GeomPoint TSequenceSet<GeomPoint>::twCentroid() const;
+
+template <typename BaseType> size_t TSequenceSet<BaseType>::instants_size() const {
+  if (!this->m_disjoint) return this->instants().size();
+  return this->m_instants_before.back();
+}
+
+template <typename BaseType>
+TInstant<BaseType> TSequenceSet<BaseType>::instant_at(size_t n) const {
+  if (!this->m_disjoint) return *next(this->instants().begin(), n);
+  if (n >= this->m_instants_before.back()) {
+    throw "At least " + to_string(n) + " instant(s) expected";
+  }
+
+  auto const &before = this->m_instants_before;
+  size_t const i = upper_bound(before.begin(), before.end(), n) - before.begin() - 1;
+  TSequence<BaseType> const &sequence = *this->m_ordered[i];
+  size_t const skip = sequence.numInstants() - (before[i + 1] - before[i]);
+  size_t const k = n - before[i] + skip;
+  TInstant<BaseType> instant = sequence.instantN(k);
+
+  // Instants of consecutive sequences at the same timestamp come in order of
+  // value, as in instants()
+  if (k == 0 && i > 0) instant = max(instant, this->m_ordered[i - 1]->endInstant());
+  if (k + 1 == sequence.numInstants() && i + 1 < this->m_ordered.size()) {
+    instant = min(instant, this->m_ordered[i + 1]->startInstant());
+  }
+  return instant;
+}
+
 template <typename BaseType> duration_ms TSequenceSet<BaseType>::timespan() const {
   duration_ms tspan(0);
   for (auto const &e : this->m_sequences) tspan += e.timespan();
@@ -281,6 +505,10 @@ template <typename BaseType> set<Range<BaseType>> TSequenceSet<BaseType>::getVal
   return s;
 }
 
+template <typename BaseType> bbox_t<BaseType> TSequenceSet<BaseType>::boundingBox() const {
+  return this->m_bbox;
+}
+
 template <typename BaseType> set<time_point> TSequenceSet<BaseType>::timestamps() const {
   set<time_point> s;
   for (auto const &e : this->m_sequences) {
@@ -291,6 +519,41 @@ template <typename BaseType> set<time_point> TSequenceSet<BaseType>::timestamps(
   return s;
 }
 
+template <typename BaseType> size_t TSequenceSet<BaseType>::numTimestamps() const {
+  if (!this->m_disjoint) return this->timestamps().size();
+  return this->m_timestamps_before.back();
+}
+
+template <typename BaseType> time_point TSequenceSet<BaseType>::startTimestamp() const {
+  if (this->m_ordered.empty()) {
+    throw "At least one timestamp expected";
+  }
+  return this->m_ordered.front()->startTimestamp();
+}
+
+template <typename BaseType> time_point TSequenceSet<BaseType>::endTimestamp() const {
+  if (this->m_ordered.empty()) {
+    throw "At least one timestamp expected";
+  }
+  if (this->m_disjoint) return this->m_ordered.back()->endTimestamp();
+  time_point t = this->m_ordered.front()->endTimestamp();
+  for (auto const *e : this->m_ordered) t = max(t, e->endTimestamp());
+  return t;
+}
+
+template <typename BaseType> time_point TSequenceSet<BaseType>::timestampN(size_t n) const {
+  if (!this->m_disjoint) return Temporal<BaseType>::timestampN(n);
+  if (n >= this->m_timestamps_before.back()) {
+    throw "At least " + to_string(n) + " timestamp(s) expected";
+  }
+
+  auto const &before = this->m_timestamps_before;
+  size_t const i = upper_bound(before.begin(), before.end(), n) - before.begin() - 1;
+  TSequence<BaseType> const &sequence = *this->m_ordered[i];
+  size_t const skip = sequence.numTimestamps() - (before[i + 1] - before[i]);
+  return sequence.m_timestamps[n - before[i] + skip];
+}
+
 template <typename BaseType> PeriodSet TSequenceSet<BaseType>::getTime() const {
   set<Period> s;
   for (auto const &e : sequences()) {
@@ -319,24 +582,99 @@ TSequenceSet<BaseType> *TSequenceSet<BaseType>::shift_impl(duration_ms const tim
 
 template <typename BaseType>
 bool TSequenceSet<BaseType>::intersectsTimestamp(time_point const datetime) const {
-  for (auto const &t : this->timestamps()) {
-    if (t == datetime) {
-      return true;
+  return this->intersectsPeriod(Period(datetime, datetime, true, true));
+}
+
+template <typename BaseType>
+BaseType TSequenceSet<BaseType>::valueAtTimestamp(time_point const datetime) const {
+  for (auto const &sequence : this->m_sequences) {
+    if (!sequence.intersectsTimestamp(datetime)) continue;
+    auto it = upper_bound(sequence.m_timestamps.begin(), sequence.m_timestamps.end(), datetime);
+    size_t segment = it - sequence.m_timestamps.begin() - 1;
+    return sequence.value_at(datetime, segment);
+  }
+  throw invalid_argument("The temporal value is not defined at " + write_ISO8601_time(datetime));
+}
+
+template <typename BaseType> void TSequenceSet<BaseType>::values_at_timestamps_impl(
+    vector<time_point> const &timestamps, vector<pair<BaseType, time_point>> &values) const {
+  if (!this->m_disjoint) {
+    // Overlapping sequences, looked up one by one
+    for (time_point const &t : timestamps) {
+      for (auto const &sequence : this->m_sequences) {
+        if (!sequence.intersectsTimestamp(t)) continue;
+        size_t segment = 0;
+        values.emplace_back(sequence.value_at(t, segment), t);
+        break;
+      }
+    }
+    return;
+  }
+
+  // Walk the timestamps and the sequences (and their instants) together
+  auto const &seqs = this->m_ordered;
+  size_t i = 0, segment = 0;
+  for (time_point const &t : timestamps) {
+    while (i < seqs.size()
+           && (seqs[i]->endTimestamp() < t
+               || (seqs[i]->endTimestamp() == t && !seqs[i]->upper_inc()))) {
+      i++;
+      segment = 0;
+    }
+    if (i == seqs.size()) break;
+    if (seqs[i]->intersectsTimestamp(t)) {
+      values.emplace_back(seqs[i]->value_at(t, segment), t);
     }
   }
-  return false;
 }
 
 template <typename BaseType>
 bool TSequenceSet<BaseType>::intersectsPeriod(Period const period) const {
-  for (auto const &t : this->timestamps()) {
-    if (period.contains_timestamp(t)) {
-      return true;
-    }
+  // The cached boxes rule out most periods without looking at the instants
+  if (!bbox_overlaps_period(this->m_bbox, period)) return false;
+  for (auto const &sequence : this->m_sequences) {
+    if (!bbox_overlaps_period(sequence.m_bbox, period)) continue;
+    auto const begin = sequence.m_timestamps.begin();
+    auto const end = sequence.m_timestamps.end();
+    auto it = period.lower_inc() ? lower_bound(begin, end, period.lower())
+                                 : upper_bound(begin, end, period.lower());
+    if (it != end && period.contains_timestamp(*it)) return true;
   }
   return false;
 }
 
+template <typename BaseType> bool TSequenceSet<BaseType>::intersects_timestamp_set_impl(
+    TimestampSet const &timestampset) const {
+  // Same as intersectsTimestamp(), i.e, only the timestamps of the instants count
+  if (timestampset.numTimestamps() == 0) return false;
+  Period const span = timestampset.period();
+  if (!bbox_overlaps_period(this->m_bbox, span)) return false;
+  for (auto const &sequence : this->m_sequences) {
+    if (!bbox_overlaps_period(sequence.m_bbox, span)) continue;
+    auto const &timestamps = sequence.m_timestamps;
+    if (timestampset.contains_any(timestamps.data(), timestamps.size())) return true;
+  }
+  return false;
+}
+
+template <typename BaseType>
+TSequenceSet<BaseType> *TSequenceSet<BaseType>::at_periods_impl(
+    vector<Period> const &periods) const {
+  set<TSequence<BaseType>> pieces;
+  for (auto const &sequence : this->m_sequences) {
+    auto it = lower_bound(
+        periods.begin(), periods.end(), sequence.startTimestamp(),
+        [](Period const &period, time_point const t) { return period.upper() < t; });
+    for (; it != periods.end() && it->lower() <= sequence.endTimestamp(); it++) {
+      unique_ptr<TSequence<BaseType>> piece(sequence.at_period(*it));
+      if (piece) pieces.insert(move(*piece));
+    }
+  }
+
+  if (pieces.empty()) return nullptr;
+  return new TSequenceSet<BaseType>(pieces, this->m_interpolation);
+}
+
 template <typename BaseType> istream &TSequenceSet<BaseType>::read_internal(istream &in) {
   char c;
 
@@ -370,23 +708,19 @@ template <typename BaseType> istream &TSequenceSet<BaseType>::read_internal(istr
 
   set<TSequence<BaseType>> s = {};
 
-  TSequence<BaseType> seq;
-  in >> seq;
-  s.insert(seq);
-
   while (true) {
+    TSequence<BaseType> seq;
+    in >> seq;
+    s.insert(s.end(), move(seq));
     in >> c;
     if (c != ',') break;
-    in >> seq;
-    seq.validate();
-    s.insert(seq);
   }
 
   if (c != '}') {
     throw invalid_argument("Expected '}'");
   }
 
-  this->m_sequences = s;
+  this->m_sequences = move(s);
   this->m_interpolation = interp;
 
   return in;
@@ -0,0 +1,75 @@
+#include <cmath>
+#include <meos/types/temporal/TSequenceSetBuilder.hpp>
+#include <meos/util/serializing.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace meos {
+using namespace std;
+
+template <typename BaseType>
+TSequenceSetBuilder<BaseType>::TSequenceSetBuilder(duration_ms max_time_gap,
+                                                   double max_distance_gap,
+                                                   Interpolation interpolation)
+    : m_max_time_gap(max_time_gap),
+      m_max_distance_gap(max_distance_gap),
+      m_interpolation(interpolation),
+      m_current(interpolation) {}
+
+template <typename BaseType>
+void TSequenceSetBuilder<BaseType>::append(BaseType value, time_point t) {
+  if (!this->m_current.empty()) {
+    // Checked before splitting, as the new sequence would take the instant anyway
+    time_point const last = this->m_current.endInstant().getTimestamp();
+    if (t <= last) {
+      throw invalid_argument("Instants should be appended in increasing order of time, got "
+                             + write_ISO8601_time(t) + " after " + write_ISO8601_time(last));
+    }
+    if (is_gap(value, t)) this->m_sequences.insert(this->m_current.build());
+  }
+  this->m_current.append(move(value), t);
+  this->m_num_instants++;
+}
+
+template <typename BaseType>
+void TSequenceSetBuilder<BaseType>::append(TInstant<BaseType> const &instant) {
+  append(instant.getValue(), instant.getTimestamp());
+}
+
+template <typename BaseType> size_t TSequenceSetBuilder<BaseType>::numInstants() const {
+  return this->m_num_instants;
+}
+
+template <typename BaseType> size_t TSequenceSetBuilder<BaseType>::numSequences() const {
+  return this->m_sequences.size() + (this->m_current.empty() ? 0 : 1);
+}
+
+template <typename BaseType>
+TSequenceSet<BaseType> TSequenceSetBuilder<BaseType>::snapshot() const {
+  set<TSequence<BaseType>> sequences = this->m_sequences;
+  if (!this->m_current.empty()) sequences.insert(this->m_current.snapshot());
+  return TSequenceSet<BaseType>(move(sequences), this->m_interpolation);
+}
+
+template <typename BaseType> TSequenceSet<BaseType> TSequenceSetBuilder<BaseType>::build() {
+  set<TSequence<BaseType>> sequences = move(this->m_sequences);
+  this->m_sequences.clear();
+  if (!this->m_current.empty()) sequences.insert(this->m_current.build());
+  this->m_num_instants = 0;
+  return TSequenceSet<BaseType>(move(sequences), this->m_interpolation);
+}
+
+template <typename BaseType>
+bool TSequenceSetBuilder<BaseType>::is_gap(BaseType const &value, time_point t) const {
+  TInstant<BaseType> const last = this->m_current.endInstant();
+  return chrono::duration_cast<duration_ms>(t - last.getTimestamp()) > this->m_max_time_gap
+         || value_distance(last.getValue(), value) > this->m_max_distance_gap;
+}
+
+template class TSequenceSetBuilder<bool>;
+template class TSequenceSetBuilder<int>;
+template class TSequenceSetBuilder<float>;
+template class TSequenceSetBuilder<string>;
+template class TSequenceSetBuilder<GeomPoint>;
+
+}  // namespace meos
@@ -1,9 +1,37 @@
+#include <algorithm>
 #include <iomanip>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TInstantSet.hpp>
 #include <meos/types/temporal/Temporal.hpp>
+#include <stdexcept>
 
 namespace meos {
 using namespace std;
 
+namespace {
+
+/**
+ * Complement of normalized periods over the whole time line.
+ */
+vector<Period> complement(vector<Period> const &periods) {
+  vector<Period> complemented;
+  time_point lower = time_point::min();
+  bool lower_inc = true;
+  for (Period const &period : periods) {
+    if (lower < period.lower() || (lower_inc && !period.lower_inc())) {
+      complemented.emplace_back(lower, period.lower(), lower_inc, !period.lower_inc());
+    }
+    lower = period.upper();
+    lower_inc = !period.upper_inc();
+  }
+  if (lower < time_point::max() || lower_inc) {
+    complemented.emplace_back(lower, time_point::max(), lower_inc, true);
+  }
+  return complemented;
+}
+
+}  // namespace
+
 template <typename BaseType> Temporal<BaseType>::Temporal() {}
 
 template <typename BaseType> Temporal<BaseType>::~Temporal() {}
@@ -24,6 +52,24 @@ template <typename BaseType> BaseType Temporal<BaseType>::maxValue() const {
   return s.rbegin()->upper();
 }
 
+// Numbers read their bounds from the bounding box
+
+template <> int Temporal<int>::minValue() const {
+  return static_cast<int>(this->boundingBox().xmin());
+}
+
+template <> int Temporal<int>::maxValue() const {
+  return static_cast<int>(this->boundingBox().xmax());
+}
+
+template <> float Temporal<float>::minValue() const {
+  return static_cast<float>(this->boundingBox().xmin());
+}
+
+template <> float Temporal<float>::maxValue() const {
+  return static_cast<float>(this->boundingBox().xmax());
+}
+
 template <typename BaseType> size_t Temporal<BaseType>::numTimestamps() const {
   return timestamps().size();
 }
@@ -57,19 +103,90 @@ unique_ptr<Temporal<BaseType>> Temporal<BaseType>::shift(duration_ms const timed
   return unique_ptr<Temporal<BaseType>>(this->shift_impl(timedelta));
 }
 
+template <typename BaseType> vector<pair<BaseType, time_point>>
+Temporal<BaseType>::valuesAtTimestamps(vector<time_point> const &timestamps) const {
+  if (!is_sorted(timestamps.begin(), timestamps.end())) {
+    throw invalid_argument("The timestamps must be sorted");
+  }
+  vector<pair<BaseType, time_point>> values;
+  values.reserve(timestamps.size());
+  this->values_at_timestamps_impl(timestamps, values);
+  return values;
+}
+
 template <typename BaseType>
-bool Temporal<BaseType>::intersectsTimestampSet(TimestampSet const timestampset) const {
-  for (auto const &t : timestampset.timestamps()) {
-    if (intersectsTimestamp(t)) {
-      return true;
-    }
+unique_ptr<Temporal<BaseType>> Temporal<BaseType>::atTimestamp(time_point const datetime) const {
+  auto values = this->valuesAtTimestamps({datetime});
+  if (values.empty()) return nullptr;
+  return make_unique<TInstant<BaseType>>(values.front());
+}
+
+template <typename BaseType> unique_ptr<Temporal<BaseType>> Temporal<BaseType>::atTimestampSet(
+    TimestampSet const &timestampset) const {
+  vector<time_point> timestamps;
+  timestamps.reserve(timestampset.numTimestamps());
+  for (size_t i = 0; i < timestampset.numTimestamps(); i++) {
+    timestamps.push_back(timestampset.timestampN(i));
   }
-  return false;
+  vector<pair<BaseType, time_point>> values;
+  this->values_at_timestamps_impl(timestamps, values);
+  if (values.empty()) return nullptr;
+  if (this->duration() == TemporalDuration::Instant) {
+    return make_unique<TInstant<BaseType>>(values.front());
+  }
+
+  timestamps.clear();
+  vector<BaseType> instant_values;
+  instant_values.reserve(values.size());
+  for (auto const &value : values) {
+    instant_values.push_back(value.first);
+    timestamps.push_back(value.second);
+  }
+  return make_unique<TInstantSet<BaseType>>(move(timestamps), move(instant_values));
+}
+
+template <typename BaseType>
+unique_ptr<Temporal<BaseType>> Temporal<BaseType>::atPeriod(Period const &period) const {
+  return unique_ptr<Temporal<BaseType>>(this->at_periods_impl({period}));
+}
+
+template <typename BaseType>
+unique_ptr<Temporal<BaseType>> Temporal<BaseType>::atPeriodSet(PeriodSet const &periodset) const {
+  vector<Period> const periods(periodset.begin(), periodset.end());
+  return unique_ptr<Temporal<BaseType>>(this->at_periods_impl(periods));
+}
+
+template <typename BaseType>
+unique_ptr<Temporal<BaseType>> Temporal<BaseType>::minusTimestamp(time_point const datetime) const {
+  return this->minusPeriod(Period(datetime, datetime, true, true));
+}
+
+template <typename BaseType> unique_ptr<Temporal<BaseType>> Temporal<BaseType>::minusTimestampSet(
+    TimestampSet const &timestampset) const {
+  PeriodSet const periodset = PeriodSet().union_(timestampset);
+  vector<Period> const periods(periodset.begin(), periodset.end());
+  return unique_ptr<Temporal<BaseType>>(this->at_periods_impl(complement(periods)));
+}
+
+template <typename BaseType>
+unique_ptr<Temporal<BaseType>> Temporal<BaseType>::minusPeriod(Period const &period) const {
+  return unique_ptr<Temporal<BaseType>>(this->at_periods_impl(complement({period})));
+}
+
+template <typename BaseType> unique_ptr<Temporal<BaseType>> Temporal<BaseType>::minusPeriodSet(
+    PeriodSet const &periodset) const {
+  vector<Period> const periods(periodset.begin(), periodset.end());
+  return unique_ptr<Temporal<BaseType>>(this->at_periods_impl(complement(periods)));
+}
+
+template <typename BaseType>
+bool Temporal<BaseType>::intersectsTimestampSet(TimestampSet const timestampset) const {
+  return this->intersects_timestamp_set_impl(timestampset);
 }
 
 template <typename BaseType>
 bool Temporal<BaseType>::intersectsPeriodSet(PeriodSet const periodset) const {
-  for (auto const &p : periodset.periods()) {
+  for (auto const &p : periodset) {
     if (intersectsPeriod(p)) {
       return true;
     }
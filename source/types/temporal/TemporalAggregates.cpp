@@ -0,0 +1,617 @@
+#include <algorithm>
+#include <cmath>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/types/temporal/TemporalAggregates.hpp>
+#include <meos/util/parallel.hpp>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace meos {
+using namespace std;
+
+namespace {
+
+/**
+ * A sequence of a partial aggregate, as the range [from, to) of its arrays.
+ */
+struct Span {
+  size_t from;
+  size_t to;
+  bool lower_inc;
+  bool upper_inc;
+};
+
+/**
+ * An aggregate of some of the values: sequences sorted by time and disjoint,
+ * stored one after the other in flat arrays. Instants are sequences of one.
+ */
+template <typename T> struct Partial {
+  vector<time_point> timestamps;
+  vector<T> values;
+  vector<Span> spans;
+};
+
+/**
+ * Running sum and count, from which tavg divides at the end.
+ */
+struct Average {
+  double sum;
+  double count;
+};
+
+bool operator==(Average const &lhs, Average const &rhs) {
+  return lhs.sum == rhs.sum && lhs.count == rhs.count;
+}
+
+bool operator!=(Average const &lhs, Average const &rhs) { return !(lhs == rhs); }
+
+Average operator+(Average const &lhs, Average const &rhs) {
+  return {lhs.sum + rhs.sum, lhs.count + rhs.count};
+}
+
+struct Sum {
+  static constexpr bool crosses = false;
+  template <typename T> T operator()(T const &lhs, T const &rhs) const { return lhs + rhs; }
+};
+
+struct Min {
+  static constexpr bool crosses = true;
+  template <typename T> T operator()(T const &lhs, T const &rhs) const {
+    return rhs < lhs ? rhs : lhs;
+  }
+};
+
+struct Max {
+  static constexpr bool crosses = true;
+  template <typename T> T operator()(T const &lhs, T const &rhs) const {
+    return lhs < rhs ? rhs : lhs;
+  }
+};
+
+template <typename T> T interpolate(T const &from, T const &, double) { return from; }
+
+float interpolate(float const from, float const to, double const ratio) {
+  return static_cast<float>(from + (static_cast<double>(to) - from) * ratio);
+}
+
+Average interpolate(Average const &from, Average const &to, double const ratio) {
+  return {from.sum + (to.sum - from.sum) * ratio, from.count + (to.count - from.count) * ratio};
+}
+
+/**
+ * Where two linear segments going from lhs_from to lhs_to and from rhs_from to
+ * rhs_to cross, as a ratio of their duration, or -1 when they don't.
+ */
+template <typename T> double crossing(T const &, T const &, T const &, T const &) { return -1; }
+
+double crossing(float const lhs_from, float const rhs_from, float const lhs_to,
+                float const rhs_to) {
+  double const from = static_cast<double>(lhs_from) - rhs_from;
+  double const to = static_cast<double>(lhs_to) - rhs_to;
+  if (!(from * to < 0)) return -1;
+  return from / (from - to);
+}
+
+double ratio(time_point const from, time_point const to, time_point const t) {
+  return static_cast<double>((t - from).count()) / static_cast<double>((to - from).count());
+}
+
+/**
+ * Builds a partial aggregate from its values in order of time: at each
+ * instant, a value or a cut, and between two instants, the values at both
+ * ends of the interval, or a cut. A new sequence starts wherever the values
+ * can't be interpolated over, i.e, after a cut, or where a linear value
+ * jumps, or where a stepwise value differs at an instant alone.
+ */
+template <typename T> class PartialWriter {
+public:
+  explicit PartialWriter(bool const linear) : m_linear(linear) {}
+
+  void point(time_point const t, T const &value) {
+    if (!this->m_open) {
+      this->start(t, value, true);
+    } else if (this->m_linear) {
+      if (value == this->m_last) {
+        this->push(t, value);
+      } else {
+        this->push(t, this->m_last);
+        this->close(false);
+        this->start(t, value, true);
+      }
+    } else if (value != this->m_partial.values.back()) {
+      this->push(t, value);
+    }
+    this->m_end = t;
+    this->m_last = value;
+    this->m_pending = false;
+  }
+
+  void interval(time_point const from, time_point const to, T const &from_value,
+                T const &to_value) {
+    if (!this->m_open) {
+      this->start(from, from_value, false);
+    } else if (from_value != this->m_last) {
+      if (this->m_partial.timestamps.back() != from) this->push(from, this->m_last);
+      this->close(true);
+      this->start(from, from_value, false);
+    }
+    this->m_end = to;
+    this->m_last = to_value;
+    this->m_pending = true;
+  }
+
+  void cut() {
+    if (!this->m_open) return;
+    if (this->m_partial.timestamps.back() != this->m_end) this->push(this->m_end, this->m_last);
+    this->close(!this->m_pending);
+  }
+
+  Partial<T> result() {
+    this->cut();
+    return move(this->m_partial);
+  }
+
+private:
+  Partial<T> m_partial;
+  bool m_linear;
+  bool m_open = false;
+  size_t m_from = 0;
+  bool m_lower_inc = true;
+
+  // End of the current sequence, and its value there. When pending, the end
+  // is that of an interval, which the next instant may or may not include.
+  time_point m_end;
+  T m_last{};
+  bool m_pending = false;
+
+  void push(time_point const t, T const &value) {
+    this->m_partial.timestamps.push_back(t);
+    this->m_partial.values.push_back(value);
+  }
+
+  void start(time_point const t, T const &value, bool const lower_inc) {
+    this->m_from = this->m_partial.timestamps.size();
+    this->m_lower_inc = lower_inc;
+    this->push(t, value);
+    this->m_open = true;
+    this->m_end = t;
+    this->m_last = value;
+  }
+
+  void close(bool const upper_inc) {
+    this->m_partial.spans.push_back(
+        {this->m_from, this->m_partial.timestamps.size(), this->m_lower_inc, upper_inc});
+    this->m_open = false;
+  }
+};
+
+/**
+ * Walks a partial aggregate forward in time, giving its values at instants
+ * and over intervals between them.
+ */
+template <typename T> class PartialCursor {
+public:
+  PartialCursor(Partial<T> const &partial, bool const linear)
+      : m_partial(partial), m_linear(linear) {}
+
+  bool valueAt(time_point const t, T &value) {
+    while (this->m_span < this->m_partial.spans.size()
+           && (this->end() < t || (this->end() == t && !this->span().upper_inc))) {
+      this->next_span();
+    }
+    if (this->m_span == this->m_partial.spans.size()) return false;
+    if (this->start() > t || (this->start() == t && !this->span().lower_inc)) return false;
+    this->seek(t);
+    value = this->value(t);
+    return true;
+  }
+
+  /**
+   * Values at both ends of the interval (from, to), during which the partial
+   * is either defined or not, as both are consecutive instants of a merge.
+   */
+  bool valuesOver(time_point const from, time_point const to, T &from_value, T &to_value) {
+    while (this->m_span < this->m_partial.spans.size() && this->end() <= from) this->next_span();
+    if (this->m_span == this->m_partial.spans.size() || this->start() > from) return false;
+    this->seek(from);
+    from_value = this->value(from);
+    if (!this->m_linear) {
+      to_value = from_value;
+      return true;
+    }
+    vector<time_point> const &timestamps = this->m_partial.timestamps;
+    vector<T> const &values = this->m_partial.values;
+    size_t const i = this->m_index;
+    to_value = timestamps[i + 1] == to ? values[i + 1]
+                                       : interpolate(values[i], values[i + 1],
+                                                     ratio(timestamps[i], timestamps[i + 1], to));
+    return true;
+  }
+
+private:
+  Partial<T> const &m_partial;
+  bool m_linear;
+  size_t m_span = 0;
+  size_t m_index = 0;
+
+  Span const &span() const { return this->m_partial.spans[this->m_span]; }
+  time_point start() const { return this->m_partial.timestamps[this->span().from]; }
+  time_point end() const { return this->m_partial.timestamps[this->span().to - 1]; }
+
+  void next_span() {
+    this->m_span++;
+    if (this->m_span < this->m_partial.spans.size()) this->m_index = this->span().from;
+  }
+
+  void seek(time_point const t) {
+    size_t const to = this->span().to;
+    while (this->m_index + 1 < to && this->m_partial.timestamps[this->m_index + 1] <= t) {
+      this->m_index++;
+    }
+  }
+
+  T value(time_point const t) const {
+    vector<time_point> const &timestamps = this->m_partial.timestamps;
+    vector<T> const &values = this->m_partial.values;
+    size_t const i = this->m_index;
+    if (timestamps[i] == t || !this->m_linear || i + 1 == this->span().to) return values[i];
+    return interpolate(values[i], values[i + 1], ratio(timestamps[i], timestamps[i + 1], t));
+  }
+};
+
+/**
+ * Merges two partial aggregates in a single sweep over the union of their
+ * timestamps. Where only one is defined, its values are kept.
+ */
+template <typename T, typename Operator>
+Partial<T> merge(Partial<T> const &lhs, Partial<T> const &rhs, bool const linear) {
+  Operator const op{};
+  PartialCursor<T> lhs_cursor(lhs, linear);
+  PartialCursor<T> rhs_cursor(rhs, linear);
+  PartialWriter<T> writer(linear);
+
+  vector<time_point> const &lhs_timestamps = lhs.timestamps;
+  vector<time_point> const &rhs_timestamps = rhs.timestamps;
+  size_t i = 0;
+  size_t j = 0;
+  // Next timestamp of either, skipping the ones shared by adjacent sequences
+  auto const next = [&](time_point &boundary) {
+    if (i == lhs_timestamps.size() && j == rhs_timestamps.size()) return false;
+    if (i == lhs_timestamps.size()) {
+      boundary = rhs_timestamps[j];
+    } else if (j == rhs_timestamps.size()) {
+      boundary = lhs_timestamps[i];
+    } else {
+      boundary = min(lhs_timestamps[i], rhs_timestamps[j]);
+    }
+    while (i < lhs_timestamps.size() && lhs_timestamps[i] == boundary) i++;
+    while (j < rhs_timestamps.size() && rhs_timestamps[j] == boundary) j++;
+    return true;
+  };
+
+  time_point t;
+  time_point next_t;
+  bool more = next(t);
+  while (more) {
+    T lhs_value{};
+    T rhs_value{};
+    bool const lhs_at = lhs_cursor.valueAt(t, lhs_value);
+    bool const rhs_at = rhs_cursor.valueAt(t, rhs_value);
+    if (lhs_at && rhs_at) {
+      writer.point(t, op(lhs_value, rhs_value));
+    } else if (lhs_at || rhs_at) {
+      writer.point(t, lhs_at ? lhs_value : rhs_value);
+    } else {
+      writer.cut();
+    }
+
+    more = next(next_t);
+    if (!more) break;
+
+    T lhs_from{};
+    T lhs_to{};
+    T rhs_from{};
+    T rhs_to{};
+    bool const lhs_over = lhs_cursor.valuesOver(t, next_t, lhs_from, lhs_to);
+    bool const rhs_over = rhs_cursor.valuesOver(t, next_t, rhs_from, rhs_to);
+    if (lhs_over && rhs_over) {
+      // The least or greatest switches sides where linear values cross
+      time_point cross = t;
+      double const at = Operator::crosses && linear
+                            ? crossing(lhs_from, rhs_from, lhs_to, rhs_to)
+                            : -1;
+      if (at > 0 && at < 1) {
+        cross += time_point::duration(
+            static_cast<time_point::rep>(llround((next_t - t).count() * at)));
+      }
+      if (cross > t && cross < next_t) {
+        T const value = interpolate(lhs_from, lhs_to, ratio(t, next_t, cross));
+        writer.interval(t, cross, op(lhs_from, rhs_from), value);
+        writer.point(cross, value);
+        writer.interval(cross, next_t, value, op(lhs_to, rhs_to));
+      } else {
+        writer.interval(t, next_t, op(lhs_from, rhs_from), op(lhs_to, rhs_to));
+      }
+    } else if (lhs_over) {
+      writer.interval(t, next_t, lhs_from, lhs_to);
+    } else if (rhs_over) {
+      writer.interval(t, next_t, rhs_from, rhs_to);
+    } else {
+      writer.cut();
+    }
+    t = next_t;
+  }
+  return writer.result();
+}
+
+/**
+ * Appends a sequence to a partial aggregate, applying f to its values. A
+ * stepwise sequence merged into a linear aggregate is cut into constant
+ * pieces, one per segment and one for its last instant if it is included.
+ */
+template <typename T, typename BaseType, typename Function>
+void append(Partial<T> &partial, TSequence<BaseType> const &sequence,
+            Interpolation const interpolation, bool const linear, Function const &f) {
+  SharedVector<time_point> const &timestamps = sequence.storedTimestamps();
+  SharedVector<BaseType> const &values = sequence.storedValues();
+  size_t const n = timestamps.size();
+  if (linear && interpolation == Interpolation::Stepwise && n > 1) {
+    for (size_t k = 0; k + 1 < n; k++) {
+      size_t const from = partial.timestamps.size();
+      T const value = f(values[k]);
+      partial.timestamps.insert(partial.timestamps.end(), {timestamps[k], timestamps[k + 1]});
+      partial.values.insert(partial.values.end(), {value, value});
+      partial.spans.push_back({from, from + 2, k == 0 ? sequence.lower_inc() : true, false});
+    }
+    if (sequence.upper_inc()) {
+      size_t const last = partial.timestamps.size();
+      partial.timestamps.push_back(timestamps[n - 1]);
+      partial.values.push_back(f(values[n - 1]));
+      partial.spans.push_back({last, last + 1, true, true});
+    }
+    return;
+  }
+
+  size_t const from = partial.timestamps.size();
+  partial.timestamps.insert(partial.timestamps.end(), timestamps.begin(), timestamps.end());
+  for (BaseType const &value : values) partial.values.push_back(f(value));
+  partial.spans.push_back({from, partial.timestamps.size(), sequence.lower_inc(),
+                           sequence.upper_inc()});
+}
+
+/**
+ * Partial aggregate of a single temporal value, applying f to its values.
+ */
+template <typename T, typename BaseType, typename Function>
+Partial<T> leaf(Temporal<BaseType> const &temporal, bool const linear, Function const &f) {
+  Partial<T> partial;
+  switch (temporal.duration()) {
+    case TemporalDuration::Instant: {
+      auto const &instant = static_cast<TInstant<BaseType> const &>(temporal);
+      partial.timestamps.push_back(instant.getTimestamp());
+      partial.values.push_back(f(instant.getValue()));
+      partial.spans.push_back({0, 1, true, true});
+      break;
+    }
+    case TemporalDuration::InstantSet: {
+      auto const &instant_set = static_cast<TInstantSet<BaseType> const &>(temporal);
+      partial.timestamps = instant_set.storedTimestamps().copy();
+      partial.values.reserve(partial.timestamps.size());
+      for (BaseType const &value : instant_set.storedValues()) partial.values.push_back(f(value));
+      partial.spans.reserve(partial.timestamps.size());
+      for (size_t k = 0; k < partial.timestamps.size(); k++) {
+        partial.spans.push_back({k, k + 1, true, true});
+      }
+      break;
+    }
+    case TemporalDuration::Sequence: {
+      auto const &sequence = static_cast<TSequence<BaseType> const &>(temporal);
+      append(partial, sequence, sequence.interpolation(), linear, f);
+      break;
+    }
+    default: {
+      auto const &sequence_set = static_cast<TSequenceSet<BaseType> const &>(temporal);
+      for (TSequence<BaseType> const *sequence : sequence_set.orderedSequences()) {
+        append(partial, *sequence, sequence_set.interpolation(), linear, f);
+      }
+    }
+  }
+  return partial;
+}
+
+bool is_discrete(TemporalDuration const duration) {
+  return duration == TemporalDuration::Instant || duration == TemporalDuration::InstantSet;
+}
+
+/**
+ * Are the values instants or instant sets? Throws if they are mixed with
+ * sequences.
+ */
+template <typename BaseType>
+bool are_discrete(vector<Temporal<BaseType> const *> const &temporals) {
+  bool const discrete = is_discrete(temporals.front()->duration());
+  for (Temporal<BaseType> const *temporal : temporals) {
+    if (is_discrete(temporal->duration()) != discrete) {
+      throw invalid_argument("Cannot aggregate instants together with sequences");
+    }
+  }
+  return discrete;
+}
+
+template <typename BaseType>
+bool any_linear(vector<Temporal<BaseType> const *> const &temporals) {
+  for (Temporal<BaseType> const *temporal : temporals) {
+    if (temporal->duration() == TemporalDuration::Sequence
+        && static_cast<TSequence<BaseType> const *>(temporal)->interpolation()
+               == Interpolation::Linear) {
+      return true;
+    }
+    if (temporal->duration() == TemporalDuration::SequenceSet
+        && static_cast<TSequenceSet<BaseType> const *>(temporal)->interpolation()
+               == Interpolation::Linear) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Partial aggregates of each value, merged pairwise, level by level, with the
+ * merges of each level spread over the threads.
+ */
+template <typename T, typename Operator, typename BaseType, typename Function>
+Partial<T> aggregate(vector<Temporal<BaseType> const *> const &temporals, bool const linear,
+                     Function const &f, size_t const num_threads) {
+  vector<Partial<T>> partials(temporals.size());
+  parallel_for(
+      temporals.size(), [&](size_t i) { partials[i] = leaf<T>(*temporals[i], linear, f); },
+      num_threads);
+
+  while (partials.size() > 1) {
+    size_t const pairs = partials.size() / 2;
+    vector<Partial<T>> merged(pairs + partials.size() % 2);
+    parallel_for(
+        pairs,
+        [&](size_t i) {
+          merged[i] = merge<T, Operator>(partials[2 * i], partials[2 * i + 1], linear);
+        },
+        num_threads);
+    if (partials.size() % 2 == 1) merged.back() = move(partials.back());
+    partials = move(merged);
+  }
+  return move(partials.front());
+}
+
+/**
+ * Temporal value of a partial aggregate, applying f to its values.
+ */
+template <typename R, typename T, typename Function>
+unique_ptr<Temporal<R>> to_temporal(Partial<T> const &partial, bool const discrete,
+                                    bool const linear, Function const &f) {
+  vector<R> values;
+  values.reserve(partial.values.size());
+  for (T const &value : partial.values) values.push_back(f(value));
+  if (discrete) return make_unique<TInstantSet<R>>(partial.timestamps, move(values));
+
+  Interpolation const interpolation = linear ? Interpolation::Linear : Interpolation::Stepwise;
+  auto const sequence = [&](Span const &span) {
+    return TSequence<R>(vector<time_point>(partial.timestamps.begin() + span.from,
+                                           partial.timestamps.begin() + span.to),
+                        vector<R>(values.begin() + span.from, values.begin() + span.to),
+                        span.lower_inc, span.upper_inc, interpolation);
+  };
+  if (partial.spans.size() == 1) return make_unique<TSequence<R>>(sequence(partial.spans.front()));
+  set<TSequence<R>> sequences;
+  for (Span const &span : partial.spans) sequences.insert(sequence(span));
+  return make_unique<TSequenceSet<R>>(move(sequences), interpolation);
+}
+
+template <typename BaseType, typename Operator>
+unique_ptr<Temporal<BaseType>> aggregate_values(
+    vector<Temporal<BaseType> const *> const &temporals, size_t const num_threads) {
+  if (temporals.empty()) return nullptr;
+  bool const discrete = are_discrete(temporals);
+  bool const linear = !discrete && any_linear(temporals);
+  auto const identity = [](BaseType const &value) { return value; };
+  Partial<BaseType> const result
+      = aggregate<BaseType, Operator>(temporals, linear, identity, num_threads);
+  return to_temporal<BaseType>(result, discrete, linear, identity);
+}
+
+}  // namespace
+
+template <typename BaseType> unique_ptr<Temporal<int>> tcount(
+    vector<Temporal<BaseType> const *> const &temporals, size_t num_threads) {
+  if (temporals.empty()) return nullptr;
+  bool const discrete = are_discrete(temporals);
+  Partial<int> const result = aggregate<int, Sum>(
+      temporals, false, [](BaseType const &) { return 1; }, num_threads);
+  return to_temporal<int>(result, discrete, false, [](int const count) { return count; });
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> tmin(vector<Temporal<BaseType> const *> const &temporals,
+                                    size_t num_threads) {
+  return aggregate_values<BaseType, Min>(temporals, num_threads);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> tmax(vector<Temporal<BaseType> const *> const &temporals,
+                                    size_t num_threads) {
+  return aggregate_values<BaseType, Max>(temporals, num_threads);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> tsum(vector<Temporal<BaseType> const *> const &temporals,
+                                    size_t num_threads) {
+  return aggregate_values<BaseType, Sum>(temporals, num_threads);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<float>> tavg(vector<Temporal<BaseType> const *> const &temporals,
+                                 size_t num_threads) {
+  if (temporals.empty()) return nullptr;
+  bool const discrete = are_discrete(temporals);
+  bool const linear = !discrete && any_linear(temporals);
+  Partial<Average> const result = aggregate<Average, Sum>(
+      temporals, linear,
+      [](BaseType const &value) { return Average{static_cast<double>(value), 1}; }, num_threads);
+  return to_temporal<float>(result, discrete, linear, [](Average const &average) {
+    return static_cast<float>(average.sum / average.count);
+  });
+}
+
+template <typename BaseType>
+bbox_t<BaseType> extent(vector<Temporal<BaseType> const *> const &temporals,
+                        size_t num_threads) {
+  if (temporals.empty()) {
+    throw invalid_argument("Cannot compute the extent of no temporal values");
+  }
+  size_t const n = temporals.size();
+  if (num_threads == 0) num_threads = default_num_threads();
+  size_t const chunks = min(num_threads, n);
+  vector<bbox_t<BaseType>> boxes(chunks);
+  parallel_for(
+      chunks,
+      [&](size_t chunk) {
+        size_t const from = chunk * n / chunks;
+        size_t const to = (chunk + 1) * n / chunks;
+        bbox_t<BaseType> box = temporals[from]->boundingBox();
+        for (size_t i = from + 1; i < to; i++) box = bbox_union(box, temporals[i]->boundingBox());
+        boxes[chunk] = box;
+      },
+      num_threads);
+
+  bbox_t<BaseType> result = boxes.front();
+  for (size_t chunk = 1; chunk < chunks; chunk++) result = bbox_union(result, boxes[chunk]);
+  return result;
+}
+
+template unique_ptr<Temporal<int>> tcount(vector<Temporal<bool> const *> const &, size_t);
+template unique_ptr<Temporal<int>> tcount(vector<Temporal<int> const *> const &, size_t);
+template unique_ptr<Temporal<int>> tcount(vector<Temporal<float> const *> const &, size_t);
+template unique_ptr<Temporal<int>> tcount(vector<Temporal<string> const *> const &, size_t);
+template unique_ptr<Temporal<int>> tcount(vector<Temporal<GeomPoint> const *> const &, size_t);
+
+template unique_ptr<Temporal<int>> tmin(vector<Temporal<int> const *> const &, size_t);
+template unique_ptr<Temporal<int>> tmax(vector<Temporal<int> const *> const &, size_t);
+template unique_ptr<Temporal<int>> tsum(vector<Temporal<int> const *> const &, size_t);
+template unique_ptr<Temporal<float>> tavg(vector<Temporal<int> const *> const &, size_t);
+
+template unique_ptr<Temporal<float>> tmin(vector<Temporal<float> const *> const &, size_t);
+template unique_ptr<Temporal<float>> tmax(vector<Temporal<float> const *> const &, size_t);
+template unique_ptr<Temporal<float>> tsum(vector<Temporal<float> const *> const &, size_t);
+template unique_ptr<Temporal<float>> tavg(vector<Temporal<float> const *> const &, size_t);
+
+template Period extent(vector<Temporal<bool> const *> const &, size_t);
+template TBox extent(vector<Temporal<int> const *> const &, size_t);
+template TBox extent(vector<Temporal<float> const *> const &, size_t);
+template Period extent(vector<Temporal<string> const *> const &, size_t);
+template STBox extent(vector<Temporal<GeomPoint> const *> const &, size_t);
+
+}  // namespace meos
@@ -0,0 +1,339 @@
+#include <cmath>
+#include <iterator>
+#include <meos/types/temporal/Synchronize.hpp>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/types/temporal/TemporalArithmetic.hpp>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace meos {
+using namespace std;
+
+namespace {
+
+struct Add {
+  static constexpr bool divides = false;
+  static constexpr bool turns = false;
+  template <typename T> T operator()(T lhs, T rhs) const { return lhs + rhs; }
+};
+
+struct Subtract {
+  static constexpr bool divides = false;
+  static constexpr bool turns = false;
+  template <typename T> T operator()(T lhs, T rhs) const { return lhs - rhs; }
+};
+
+struct Multiply {
+  static constexpr bool divides = false;
+  static constexpr bool turns = true;
+  template <typename T> T operator()(T lhs, T rhs) const { return lhs * rhs; }
+};
+
+struct Divide {
+  static constexpr bool divides = true;
+  static constexpr bool turns = false;
+  template <typename T> T operator()(T lhs, T rhs) const { return lhs / rhs; }
+};
+
+template <typename BaseType> void check_divisor(BaseType const value) {
+  if (value == 0) throw invalid_argument("Division by zero");
+}
+
+/**
+ * Linear values cross zero between two instants of opposite signs.
+ */
+template <typename BaseType> void check_divisor(BaseType const from, BaseType const to) {
+  if ((from < 0 && to > 0) || (from > 0 && to < 0)) throw invalid_argument("Division by zero");
+}
+
+template <typename BaseType>
+void check_divisors(SharedVector<BaseType> const &values, Interpolation const interpolation) {
+  for (size_t i = 0; i < values.size(); i++) {
+    check_divisor(values[i]);
+    if (i > 0 && interpolation == Interpolation::Linear) check_divisor(values[i - 1], values[i]);
+  }
+}
+
+/**
+ * Collects the results of an operator applied on synchronised values, directly
+ * into the arrays the result is built from.
+ */
+template <typename BaseType, typename Operator> class ArithmeticSink {
+public:
+  void instant(time_point const t, BaseType const lhs, BaseType const rhs) {
+    if (Operator::divides) check_divisor(rhs);
+    this->m_timestamps.push_back(t);
+    this->m_values.push_back(this->m_operator(lhs, rhs));
+  }
+
+  void begin(bool const lower_inc, Interpolation const interpolation) {
+    this->m_timestamps.clear();
+    this->m_values.clear();
+    this->m_lower_inc = lower_inc;
+    this->m_interpolation = interpolation;
+  }
+
+  void add(time_point const t, BaseType const lhs, BaseType const rhs) {
+    if (this->m_interpolation == Interpolation::Linear && !this->m_timestamps.empty()) {
+      if (Operator::divides) check_divisor(this->m_rhs, rhs);
+      if (Operator::turns) this->add_turning_point(t, lhs, rhs);
+    }
+    this->instant(t, lhs, rhs);
+    this->m_lhs = lhs;
+    this->m_rhs = rhs;
+  }
+
+  void end(bool const upper_inc) {
+    this->m_sequences.emplace_back(move(this->m_timestamps), move(this->m_values),
+                                   this->m_lower_inc, upper_inc, this->m_interpolation);
+  }
+
+  unique_ptr<Temporal<BaseType>> result(TemporalDuration const duration) {
+    switch (duration) {
+      case TemporalDuration::Instant:
+        if (this->m_timestamps.empty()) return nullptr;
+        return make_unique<TInstant<BaseType>>(this->m_values.front(),
+                                               this->m_timestamps.front());
+      case TemporalDuration::InstantSet:
+        if (this->m_timestamps.empty()) return nullptr;
+        return make_unique<TInstantSet<BaseType>>(move(this->m_timestamps),
+                                                  move(this->m_values));
+      default:
+        if (this->m_sequences.empty()) return nullptr;
+        if (duration == TemporalDuration::Sequence && this->m_sequences.size() == 1) {
+          return make_unique<TSequence<BaseType>>(move(this->m_sequences.front()));
+        }
+        // The sequences come in order of time, so each one goes at the end
+        Interpolation const interpolation = this->m_interpolation;
+        set<TSequence<BaseType>> sequences;
+        for (TSequence<BaseType> &sequence : this->m_sequences) {
+          sequences.insert(sequences.end(), move(sequence));
+        }
+        return make_unique<TSequenceSet<BaseType>>(move(sequences), interpolation);
+    }
+  }
+
+private:
+  Operator m_operator;
+  vector<time_point> m_timestamps;
+  vector<BaseType> m_values;
+  vector<TSequence<BaseType>> m_sequences;
+  bool m_lower_inc = true;
+  Interpolation m_interpolation = default_interp_v<BaseType>;
+
+  // Operands at the last instant added
+  BaseType m_lhs = 0;
+  BaseType m_rhs = 0;
+
+  /**
+   * The product of two linear segments is a parabola, which is added its
+   * vertex if it lies strictly within the segment.
+   */
+  void add_turning_point(time_point const t, BaseType const lhs, BaseType const rhs) {
+    double const lhs_delta = static_cast<double>(lhs) - this->m_lhs;
+    double const rhs_delta = static_cast<double>(rhs) - this->m_rhs;
+    if (lhs_delta == 0 || rhs_delta == 0) return;
+    double const ratio = -(this->m_lhs * rhs_delta + this->m_rhs * lhs_delta)
+                         / (2 * lhs_delta * rhs_delta);
+    if (ratio <= 0 || ratio >= 1) return;
+
+    time_point const from = this->m_timestamps.back();
+    time_point const turn
+        = from
+          + time_point::duration(static_cast<time_point::rep>(llround((t - from).count() * ratio)));
+    if (turn <= from || turn >= t) return;
+    double const exact = static_cast<double>((turn - from).count()) / (t - from).count();
+    this->m_timestamps.push_back(turn);
+    this->m_values.push_back(static_cast<BaseType>((this->m_lhs + lhs_delta * exact)
+                                                   * (this->m_rhs + rhs_delta * exact)));
+  }
+};
+
+template <typename BaseType, typename Operator>
+unique_ptr<Temporal<BaseType>> apply(Temporal<BaseType> const &lhs,
+                                     Temporal<BaseType> const &rhs) {
+  ArithmeticSink<BaseType, Operator> sink;
+  Synchronizer<BaseType>::synchronize(lhs, rhs, sink);
+  return sink.result(synchronized_duration(lhs.duration(), rhs.duration()));
+}
+
+template <typename BaseType, typename Function>
+TSequence<BaseType> map_sequence(TSequence<BaseType> const &sequence,
+                                 Interpolation const interpolation, bool const divisor,
+                                 Function const &f) {
+  SharedVector<BaseType> const &values = sequence.storedValues();
+  if (divisor) check_divisors(values, interpolation);
+  vector<BaseType> result;
+  result.reserve(values.size());
+  for (BaseType const value : values) result.push_back(f(value));
+  return TSequence<BaseType>(sequence.storedTimestamps().copy(), move(result), sequence.lower_inc(),
+                             sequence.upper_inc(), interpolation);
+}
+
+/**
+ * Applies f to each value, keeping the timestamps. With divisor, the values are
+ * checked for being usable as divisors first.
+ */
+template <typename BaseType, typename Function>
+unique_ptr<Temporal<BaseType>> map_values(Temporal<BaseType> const &temporal, bool const divisor,
+                                          Function const &f) {
+  switch (temporal.duration()) {
+    case TemporalDuration::Instant: {
+      auto const &instant = static_cast<TInstant<BaseType> const &>(temporal);
+      if (divisor) check_divisor(instant.getValue());
+      return make_unique<TInstant<BaseType>>(f(instant.getValue()), instant.getTimestamp());
+    }
+    case TemporalDuration::InstantSet: {
+      auto const &instant_set = static_cast<TInstantSet<BaseType> const &>(temporal);
+      SharedVector<BaseType> const &values = instant_set.storedValues();
+      if (divisor) check_divisors(values, Interpolation::Stepwise);
+      vector<BaseType> result;
+      result.reserve(values.size());
+      for (BaseType const value : values) result.push_back(f(value));
+      return make_unique<TInstantSet<BaseType>>(instant_set.storedTimestamps().copy(),
+                                                move(result));
+    }
+    case TemporalDuration::Sequence: {
+      auto const &sequence = static_cast<TSequence<BaseType> const &>(temporal);
+      return make_unique<TSequence<BaseType>>(
+          map_sequence(sequence, sequence.interpolation(), divisor, f));
+    }
+    default: {
+      auto const &sequence_set = static_cast<TSequenceSet<BaseType> const &>(temporal);
+      set<TSequence<BaseType>> sequences;
+      for (TSequence<BaseType> const &sequence : sequence_set.storedSequences()) {
+        sequences.insert(sequences.end(),
+                         map_sequence(sequence, sequence_set.interpolation(), divisor, f));
+      }
+      return make_unique<TSequenceSet<BaseType>>(move(sequences), sequence_set.interpolation());
+    }
+  }
+}
+
+template <typename BaseType, typename Operator>
+unique_ptr<Temporal<BaseType>> apply(Temporal<BaseType> const &lhs, BaseType const rhs) {
+  if (Operator::divides) check_divisor(rhs);
+  Operator const op{};
+  return map_values(lhs, false, [&op, rhs](BaseType const value) { return op(value, rhs); });
+}
+
+template <typename BaseType, typename Operator>
+unique_ptr<Temporal<BaseType>> apply(BaseType const lhs, Temporal<BaseType> const &rhs) {
+  Operator const op{};
+  return map_values(rhs, Operator::divides,
+                    [&op, lhs](BaseType const value) { return op(lhs, value); });
+}
+
+}  // namespace
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> operator+(Temporal<BaseType> const &lhs,
+                                         Temporal<BaseType> const &rhs) {
+  return apply<BaseType, Add>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> operator+(Temporal<BaseType> const &lhs,
+                                         typename is_number<BaseType>::type rhs) {
+  return apply<BaseType, Add>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> operator+(typename is_number<BaseType>::type lhs,
+                                         Temporal<BaseType> const &rhs) {
+  return apply<BaseType, Add>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> operator-(Temporal<BaseType> const &lhs,
+                                         Temporal<BaseType> const &rhs) {
+  return apply<BaseType, Subtract>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> operator-(Temporal<BaseType> const &lhs,
+                                         typename is_number<BaseType>::type rhs) {
+  return apply<BaseType, Subtract>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> operator-(typename is_number<BaseType>::type lhs,
+                                         Temporal<BaseType> const &rhs) {
+  return apply<BaseType, Subtract>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> operator*(Temporal<BaseType> const &lhs,
+                                         Temporal<BaseType> const &rhs) {
+  return apply<BaseType, Multiply>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> operator*(Temporal<BaseType> const &lhs,
+                                         typename is_number<BaseType>::type rhs) {
+  return apply<BaseType, Multiply>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> operator*(typename is_number<BaseType>::type lhs,
+                                         Temporal<BaseType> const &rhs) {
+  return apply<BaseType, Multiply>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> operator/(Temporal<BaseType> const &lhs,
+                                         Temporal<BaseType> const &rhs) {
+  return apply<BaseType, Divide>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> operator/(Temporal<BaseType> const &lhs,
+                                         typename is_number<BaseType>::type rhs) {
+  return apply<BaseType, Divide>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_number<BaseType>::type *>
+unique_ptr<Temporal<BaseType>> operator/(typename is_number<BaseType>::type lhs,
+                                         Temporal<BaseType> const &rhs) {
+  return apply<BaseType, Divide>(lhs, rhs);
+}
+
+template unique_ptr<Temporal<int>> operator+(Temporal<int> const &lhs,
+                                             Temporal<int> const &rhs);
+template unique_ptr<Temporal<int>> operator+(Temporal<int> const &lhs, int rhs);
+template unique_ptr<Temporal<int>> operator+(int lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<int>> operator-(Temporal<int> const &lhs,
+                                             Temporal<int> const &rhs);
+template unique_ptr<Temporal<int>> operator-(Temporal<int> const &lhs, int rhs);
+template unique_ptr<Temporal<int>> operator-(int lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<int>> operator*(Temporal<int> const &lhs,
+                                             Temporal<int> const &rhs);
+template unique_ptr<Temporal<int>> operator*(Temporal<int> const &lhs, int rhs);
+template unique_ptr<Temporal<int>> operator*(int lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<int>> operator/(Temporal<int> const &lhs,
+                                             Temporal<int> const &rhs);
+template unique_ptr<Temporal<int>> operator/(Temporal<int> const &lhs, int rhs);
+template unique_ptr<Temporal<int>> operator/(int lhs, Temporal<int> const &rhs);
+
+template unique_ptr<Temporal<float>> operator+(Temporal<float> const &lhs,
+                                               Temporal<float> const &rhs);
+template unique_ptr<Temporal<float>> operator+(Temporal<float> const &lhs, float rhs);
+template unique_ptr<Temporal<float>> operator+(float lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<float>> operator-(Temporal<float> const &lhs,
+                                               Temporal<float> const &rhs);
+template unique_ptr<Temporal<float>> operator-(Temporal<float> const &lhs, float rhs);
+template unique_ptr<Temporal<float>> operator-(float lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<float>> operator*(Temporal<float> const &lhs,
+                                               Temporal<float> const &rhs);
+template unique_ptr<Temporal<float>> operator*(Temporal<float> const &lhs, float rhs);
+template unique_ptr<Temporal<float>> operator*(float lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<float>> operator/(Temporal<float> const &lhs,
+                                               Temporal<float> const &rhs);
+template unique_ptr<Temporal<float>> operator/(Temporal<float> const &lhs, float rhs);
+template unique_ptr<Temporal<float>> operator/(float lhs, Temporal<float> const &rhs);
+
+}  // namespace meos
@@ -0,0 +1,68 @@
+#include <meos/types/temporal/TemporalBuilder.hpp>
+#include <string>
+
+namespace meos {
+using namespace std;
+
+template <typename BaseType> TemporalBuilder<BaseType>::TemporalBuilder() {}
+
+template <typename BaseType> TemporalBuilder<BaseType>::TemporalBuilder(size_t capacity) {
+  reserve(capacity);
+}
+
+template <typename BaseType> void TemporalBuilder<BaseType>::reserve(size_t capacity) {
+  this->m_timestamps.reserve(capacity);
+  this->m_values.reserve(capacity);
+}
+
+template <typename BaseType> size_t TemporalBuilder<BaseType>::size() const {
+  return this->m_timestamps.size();
+}
+
+template <typename BaseType> void TemporalBuilder<BaseType>::add(BaseType value, time_point t) {
+  this->m_timestamps.push_back(t);
+  this->m_values.push_back(move(value));
+}
+
+template <typename BaseType>
+void TemporalBuilder<BaseType>::add(TInstant<BaseType> const &instant) {
+  add(instant.getValue(), instant.getTimestamp());
+}
+
+template <typename BaseType> TInstantSet<BaseType> TemporalBuilder<BaseType>::buildInstantSet() {
+  TemporalSet<BaseType>::sort_instants(this->m_timestamps, this->m_values);
+  vector<time_point> timestamps = move(this->m_timestamps);
+  vector<BaseType> values = move(this->m_values);
+  this->m_timestamps.clear();
+  this->m_values.clear();
+  return TInstantSet<BaseType>(move(timestamps), move(values));
+}
+
+template <typename BaseType> TSequence<BaseType> TemporalBuilder<BaseType>::buildSequence(
+    bool lower_inc, bool upper_inc, Interpolation interpolation) {
+  TemporalSet<BaseType>::sort_instants(this->m_timestamps, this->m_values);
+  vector<time_point> timestamps = move(this->m_timestamps);
+  vector<BaseType> values = move(this->m_values);
+  this->m_timestamps.clear();
+  this->m_values.clear();
+  return TSequence<BaseType>(move(timestamps), move(values), lower_inc, upper_inc, interpolation);
+}
+
+template <typename BaseType> void TemporalBuilder<BaseType>::closeSequence(
+    bool lower_inc, bool upper_inc, Interpolation interpolation) {
+  this->m_sequences.insert(buildSequence(lower_inc, upper_inc, interpolation));
+}
+
+template <typename BaseType> TSequenceSet<BaseType> TemporalBuilder<BaseType>::buildSequenceSet() {
+  set<TSequence<BaseType>> sequences = move(this->m_sequences);
+  this->m_sequences.clear();
+  return TSequenceSet<BaseType>(move(sequences));
+}
+
+template class TemporalBuilder<bool>;
+template class TemporalBuilder<int>;
+template class TemporalBuilder<float>;
+template class TemporalBuilder<string>;
+template class TemporalBuilder<GeomPoint>;
+
+}  // namespace meos
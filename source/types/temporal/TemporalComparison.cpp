@@ -0,0 +1,547 @@
+#include <cmath>
+#include <meos/types/box/TBox.hpp>
+#include <meos/types/temporal/Synchronize.hpp>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/types/temporal/TemporalComparison.hpp>
+#include <meos/types/time/PeriodSet.hpp>
+#include <meos/types/traits.hpp>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace meos {
+using namespace std;
+
+namespace {
+
+// Comparisons as predicates on the sign of lhs - rhs
+
+struct Equal {
+  bool operator()(int const sign) const { return sign == 0; }
+};
+
+struct NotEqual {
+  bool operator()(int const sign) const { return sign != 0; }
+};
+
+struct Less {
+  bool operator()(int const sign) const { return sign < 0; }
+};
+
+struct LessEqual {
+  bool operator()(int const sign) const { return sign <= 0; }
+};
+
+struct Greater {
+  bool operator()(int const sign) const { return sign > 0; }
+};
+
+struct GreaterEqual {
+  bool operator()(int const sign) const { return sign >= 0; }
+};
+
+/**
+ * The same comparison with its operands swapped, e.g. 1 < x as x > 1.
+ */
+template <typename Predicate> struct Swapped {
+  bool operator()(int const sign) const { return Predicate{}(-sign); }
+};
+
+int sign(double const value) { return (value > 0) - (value < 0); }
+
+/**
+ * Difference of the values, whose sign orders them. Text only has a sign, but
+ * is never linear.
+ */
+template <typename BaseType> double difference(BaseType const &lhs, BaseType const &rhs) {
+  return lhs < rhs ? -1 : (rhs < lhs ? 1 : 0);
+}
+double difference(int const lhs, int const rhs) { return static_cast<double>(lhs) - rhs; }
+double difference(float const lhs, float const rhs) { return static_cast<double>(lhs) - rhs; }
+
+/**
+ * Collects the results of a comparison of synchronised values as a stepwise
+ * temporal boolean, keeping an instant only where the result changes.
+ *
+ * Within a linear segment, the operands cross at most once, when the sign of
+ * their difference changes, and the result jumps at that instant only.
+ */
+template <typename BaseType, typename Predicate> class ComparisonSink {
+public:
+  void instant(time_point const t, BaseType const &lhs, BaseType const &rhs) {
+    this->m_timestamps.push_back(t);
+    this->m_values.push_back(this->m_predicate(sign(difference(lhs, rhs))));
+  }
+
+  void begin(bool const lower_inc, Interpolation const interpolation) {
+    this->m_timestamps.clear();
+    this->m_values.clear();
+    this->m_lower_inc = lower_inc;
+    this->m_linear = interpolation == Interpolation::Linear;
+  }
+
+  void add(time_point const t, BaseType const &lhs, BaseType const &rhs) {
+    double const diff = difference(lhs, rhs);
+    if (this->m_timestamps.empty()) {
+      this->m_timestamps.push_back(t);
+      this->m_values.push_back(this->m_predicate(sign(diff)));
+      this->m_current = t;
+    } else {
+      if (this->m_current != this->m_last) {
+        this->point(this->m_last, this->m_predicate(sign(this->m_diff)));
+      }
+      this->segment(t, diff);
+    }
+    this->m_last = t;
+    this->m_diff = diff;
+  }
+
+  void end(bool const upper_inc) {
+    if (this->m_current != this->m_last) {
+      if (upper_inc) this->point(this->m_last, this->m_predicate(sign(this->m_diff)));
+      if (this->m_timestamps.back() != this->m_last) {
+        bool const held = this->m_values.back();
+        this->m_timestamps.push_back(this->m_last);
+        this->m_values.push_back(held);
+      }
+    }
+    this->m_sequences.emplace_back(move(this->m_timestamps), move(this->m_values),
+                                   this->m_lower_inc, upper_inc, Interpolation::Stepwise);
+    this->m_timestamps.clear();
+    this->m_values.clear();
+  }
+
+  unique_ptr<Temporal<bool>> result(TemporalDuration const duration) {
+    switch (duration) {
+      case TemporalDuration::Instant:
+        if (this->m_timestamps.empty()) return nullptr;
+        return make_unique<TInstant<bool>>(this->m_values.front(), this->m_timestamps.front());
+      case TemporalDuration::InstantSet:
+        if (this->m_timestamps.empty()) return nullptr;
+        return make_unique<TInstantSet<bool>>(move(this->m_timestamps), move(this->m_values));
+      default:
+        if (this->m_sequences.empty()) return nullptr;
+        if (duration == TemporalDuration::Sequence && this->m_sequences.size() == 1) {
+          return make_unique<TSequence<bool>>(move(this->m_sequences.front()));
+        }
+        set<TSequence<bool>> sequences;
+        for (TSequence<bool> &sequence : this->m_sequences) {
+          sequences.insert(sequences.end(), move(sequence));
+        }
+        return make_unique<TSequenceSet<bool>>(move(sequences), Interpolation::Stepwise);
+    }
+  }
+
+private:
+  Predicate m_predicate;
+  vector<time_point> m_timestamps;
+  vector<bool> m_values;
+  vector<TSequence<bool>> m_sequences;
+  bool m_lower_inc = true;
+  bool m_linear = false;
+
+  // Last synchronised instant, and the difference of the operands there
+  time_point m_last;
+  double m_diff = 0;
+
+  // Instant up to which the result is known, m_values.back() being its value
+  time_point m_current;
+
+  void point(time_point const t, bool const value) {
+    if (value != this->m_values.back()) {
+      this->m_timestamps.push_back(t);
+      this->m_values.push_back(value);
+    }
+    this->m_current = t;
+  }
+
+  /**
+   * The result holds value after the current instant. When it changes there,
+   * the sequence is closed and a new one starts, excluding the current
+   * instant, unless the current instant is an excluded start anyway.
+   */
+  void hold(bool const value) {
+    if (value == this->m_values.back()) return;
+    if (!this->m_lower_inc && this->m_timestamps.size() == 1
+        && this->m_timestamps.front() == this->m_current) {
+      this->m_values.front() = value;
+      return;
+    }
+    if (this->m_timestamps.back() != this->m_current) {
+      bool const held = this->m_values.back();
+      this->m_timestamps.push_back(this->m_current);
+      this->m_values.push_back(held);
+    }
+    this->m_sequences.emplace_back(move(this->m_timestamps), move(this->m_values),
+                                   this->m_lower_inc, true, Interpolation::Stepwise);
+    this->m_timestamps.assign({this->m_current});
+    this->m_values.assign({value});
+    this->m_lower_inc = false;
+  }
+
+  /**
+   * Result strictly between the last instant and t, where the difference of
+   * the operands is diff.
+   */
+  void segment(time_point const t, double const diff) {
+    int const from = sign(this->m_diff);
+    if (!this->m_linear) {
+      this->hold(this->m_predicate(from));
+      return;
+    }
+
+    int const to = sign(diff);
+    int inside = from != 0 ? from : to;
+    if (from * to < 0) {
+      time_point const last = this->m_last;
+      double const ratio = this->m_diff / (this->m_diff - diff);
+      time_point const crossing = last
+                                  + time_point::duration(static_cast<time_point::rep>(
+                                      llround((t - last).count() * ratio)));
+      if (crossing > last && crossing < t) {
+        this->hold(this->m_predicate(from));
+        this->point(crossing, this->m_predicate(0));
+        this->hold(this->m_predicate(to));
+        return;
+      }
+      // Crossing within a tick of an instant
+      inside = crossing <= last ? to : from;
+    }
+    this->hold(this->m_predicate(inside));
+  }
+};
+
+/**
+ * When the values of lhs are all above, or all below, those of rhs, or both
+ * are the same constant, sets sign to the one of lhs - rhs and returns true.
+ */
+bool constant_sign(TBox const &lhs, TBox const &rhs, int &sign) {
+  if (lhs.xmin() > rhs.xmax()) {
+    sign = 1;
+  } else if (lhs.xmax() < rhs.xmin()) {
+    sign = -1;
+  } else if (lhs.xmin() == lhs.xmax() && rhs.xmin() == rhs.xmax()) {
+    sign = 0;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+template <typename BaseType, typename enable_if<!is_number_v<BaseType>>::type * = nullptr>
+bool constant_sign(Temporal<BaseType> const &, Temporal<BaseType> const &, int &) {
+  return false;
+}
+
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+bool constant_sign(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs, int &sign) {
+  return constant_sign(lhs.boundingBox(), rhs.boundingBox(), sign);
+}
+
+template <typename BaseType, typename enable_if<!is_number_v<BaseType>>::type * = nullptr>
+bool constant_sign(Temporal<BaseType> const &, BaseType const &, int &) {
+  return false;
+}
+
+template <typename BaseType, typename is_number<BaseType>::type * = nullptr>
+bool constant_sign(Temporal<BaseType> const &lhs, BaseType const &rhs, int &sign) {
+  return constant_sign(lhs.boundingBox(), TBox(rhs, rhs), sign);
+}
+
+TSequence<bool> constant_sequence(Period const &period, bool const value) {
+  if (period.lower() == period.upper()) {
+    return TSequence<bool>({period.lower()}, {value}, true, true, Interpolation::Stepwise);
+  }
+  return TSequence<bool>({period.lower(), period.upper()}, {value, value}, period.lower_inc(),
+                         period.upper_inc(), Interpolation::Stepwise);
+}
+
+TSequence<bool> constant_sequence(SharedVector<time_point> const &timestamps, bool const lower_inc,
+                                  bool const upper_inc, bool const value) {
+  return constant_sequence(Period(timestamps.front(), timestamps.back(), lower_inc, upper_inc),
+                           value);
+}
+
+/**
+ * Constant temporal boolean defined when temporal is.
+ */
+template <typename BaseType>
+unique_ptr<Temporal<bool>> constant_like(Temporal<BaseType> const &temporal, bool const value) {
+  switch (temporal.duration()) {
+    case TemporalDuration::Instant:
+      return make_unique<TInstant<bool>>(
+          value, static_cast<TInstant<BaseType> const &>(temporal).getTimestamp());
+    case TemporalDuration::InstantSet: {
+      auto const &instant_set = static_cast<TInstantSet<BaseType> const &>(temporal);
+      return make_unique<TInstantSet<bool>>(
+          instant_set.storedTimestamps().copy(),
+          vector<bool>(instant_set.storedTimestamps().size(), value));
+    }
+    case TemporalDuration::Sequence: {
+      auto const &sequence = static_cast<TSequence<BaseType> const &>(temporal);
+      return make_unique<TSequence<bool>>(constant_sequence(
+          sequence.storedTimestamps(), sequence.lower_inc(), sequence.upper_inc(), value));
+    }
+    default: {
+      auto const &sequence_set = static_cast<TSequenceSet<BaseType> const &>(temporal);
+      set<TSequence<bool>> sequences;
+      for (TSequence<BaseType> const &sequence : sequence_set.storedSequences()) {
+        sequences.insert(sequences.end(),
+                         constant_sequence(sequence.storedTimestamps(), sequence.lower_inc(),
+                                           sequence.upper_inc(), value));
+      }
+      return make_unique<TSequenceSet<bool>>(move(sequences), Interpolation::Stepwise);
+    }
+  }
+}
+
+/**
+ * Constant temporal boolean over the time at which two sequences or sequence
+ * sets are both defined.
+ */
+template <typename BaseType>
+unique_ptr<Temporal<bool>> constant_over(Temporal<BaseType> const &lhs,
+                                         Temporal<BaseType> const &rhs, bool const value) {
+  PeriodSet const time = lhs.getTime().intersection(rhs.getTime());
+  if (time.numPeriods() == 0) return nullptr;
+  if (synchronized_duration(lhs.duration(), rhs.duration()) == TemporalDuration::Sequence) {
+    return make_unique<TSequence<bool>>(constant_sequence(*time.begin(), value));
+  }
+  set<TSequence<bool>> sequences;
+  for (Period const &period : time) {
+    sequences.insert(sequences.end(), constant_sequence(period, value));
+  }
+  return make_unique<TSequenceSet<bool>>(move(sequences), Interpolation::Stepwise);
+}
+
+template <typename BaseType, typename Predicate>
+unique_ptr<Temporal<bool>> compare(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs) {
+  TemporalDuration const duration = synchronized_duration(lhs.duration(), rhs.duration());
+  int sign;
+  if ((duration == TemporalDuration::Sequence || duration == TemporalDuration::SequenceSet)
+      && constant_sign(lhs, rhs, sign)) {
+    return constant_over(lhs, rhs, Predicate{}(sign));
+  }
+
+  ComparisonSink<BaseType, Predicate> sink;
+  Synchronizer<BaseType>::synchronize(lhs, rhs, sink);
+  return sink.result(duration);
+}
+
+template <typename BaseType, typename Predicate>
+void compare_sequence(TSequence<BaseType> const &sequence, BaseType const &scalar,
+                      Interpolation const interpolation,
+                      ComparisonSink<BaseType, Predicate> &sink) {
+  SharedVector<time_point> const &timestamps = sequence.storedTimestamps();
+  SharedVector<BaseType> const &values = sequence.storedValues();
+  sink.begin(sequence.lower_inc(), interpolation);
+  for (size_t i = 0; i < timestamps.size(); i++) sink.add(timestamps[i], values[i], scalar);
+  sink.end(sequence.upper_inc());
+}
+
+template <typename BaseType, typename Predicate>
+unique_ptr<Temporal<bool>> compare(Temporal<BaseType> const &lhs, BaseType const &rhs) {
+  int sign;
+  if (constant_sign(lhs, rhs, sign)) return constant_like(lhs, Predicate{}(sign));
+
+  ComparisonSink<BaseType, Predicate> sink;
+  switch (lhs.duration()) {
+    case TemporalDuration::Instant: {
+      auto const &instant = static_cast<TInstant<BaseType> const &>(lhs);
+      sink.instant(instant.getTimestamp(), instant.getValue(), rhs);
+      break;
+    }
+    case TemporalDuration::InstantSet: {
+      auto const &instant_set = static_cast<TInstantSet<BaseType> const &>(lhs);
+      SharedVector<time_point> const &timestamps = instant_set.storedTimestamps();
+      SharedVector<BaseType> const &values = instant_set.storedValues();
+      for (size_t i = 0; i < timestamps.size(); i++) sink.instant(timestamps[i], values[i], rhs);
+      break;
+    }
+    case TemporalDuration::Sequence: {
+      auto const &sequence = static_cast<TSequence<BaseType> const &>(lhs);
+      compare_sequence(sequence, rhs, sequence.interpolation(), sink);
+      break;
+    }
+    default: {
+      auto const &sequence_set = static_cast<TSequenceSet<BaseType> const &>(lhs);
+      for (TSequence<BaseType> const &sequence : sequence_set.storedSequences()) {
+        compare_sequence(sequence, rhs, sequence_set.interpolation(), sink);
+      }
+    }
+  }
+  return sink.result(lhs.duration());
+}
+
+}  // namespace
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> teq(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs) {
+  return compare<BaseType, Equal>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> teq(Temporal<BaseType> const &lhs,
+                               typename is_ordered<BaseType>::type const &rhs) {
+  return compare<BaseType, Equal>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> teq(typename is_ordered<BaseType>::type const &lhs,
+                               Temporal<BaseType> const &rhs) {
+  return compare<BaseType, Swapped<Equal>>(rhs, lhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tne(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs) {
+  return compare<BaseType, NotEqual>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tne(Temporal<BaseType> const &lhs,
+                               typename is_ordered<BaseType>::type const &rhs) {
+  return compare<BaseType, NotEqual>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tne(typename is_ordered<BaseType>::type const &lhs,
+                               Temporal<BaseType> const &rhs) {
+  return compare<BaseType, Swapped<NotEqual>>(rhs, lhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tlt(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs) {
+  return compare<BaseType, Less>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tlt(Temporal<BaseType> const &lhs,
+                               typename is_ordered<BaseType>::type const &rhs) {
+  return compare<BaseType, Less>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tlt(typename is_ordered<BaseType>::type const &lhs,
+                               Temporal<BaseType> const &rhs) {
+  return compare<BaseType, Swapped<Less>>(rhs, lhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tle(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs) {
+  return compare<BaseType, LessEqual>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tle(Temporal<BaseType> const &lhs,
+                               typename is_ordered<BaseType>::type const &rhs) {
+  return compare<BaseType, LessEqual>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tle(typename is_ordered<BaseType>::type const &lhs,
+                               Temporal<BaseType> const &rhs) {
+  return compare<BaseType, Swapped<LessEqual>>(rhs, lhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tgt(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs) {
+  return compare<BaseType, Greater>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tgt(Temporal<BaseType> const &lhs,
+                               typename is_ordered<BaseType>::type const &rhs) {
+  return compare<BaseType, Greater>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tgt(typename is_ordered<BaseType>::type const &lhs,
+                               Temporal<BaseType> const &rhs) {
+  return compare<BaseType, Swapped<Greater>>(rhs, lhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tge(Temporal<BaseType> const &lhs, Temporal<BaseType> const &rhs) {
+  return compare<BaseType, GreaterEqual>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tge(Temporal<BaseType> const &lhs,
+                               typename is_ordered<BaseType>::type const &rhs) {
+  return compare<BaseType, GreaterEqual>(lhs, rhs);
+}
+
+template <typename BaseType, typename is_ordered<BaseType>::type *>
+unique_ptr<Temporal<bool>> tge(typename is_ordered<BaseType>::type const &lhs,
+                               Temporal<BaseType> const &rhs) {
+  return compare<BaseType, Swapped<GreaterEqual>>(rhs, lhs);
+}
+
+template unique_ptr<Temporal<bool>> teq(Temporal<int> const &lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<bool>> teq(Temporal<int> const &lhs, int const &rhs);
+template unique_ptr<Temporal<bool>> teq(int const &lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<bool>> tne(Temporal<int> const &lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<bool>> tne(Temporal<int> const &lhs, int const &rhs);
+template unique_ptr<Temporal<bool>> tne(int const &lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<bool>> tlt(Temporal<int> const &lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<bool>> tlt(Temporal<int> const &lhs, int const &rhs);
+template unique_ptr<Temporal<bool>> tlt(int const &lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<bool>> tle(Temporal<int> const &lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<bool>> tle(Temporal<int> const &lhs, int const &rhs);
+template unique_ptr<Temporal<bool>> tle(int const &lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<bool>> tgt(Temporal<int> const &lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<bool>> tgt(Temporal<int> const &lhs, int const &rhs);
+template unique_ptr<Temporal<bool>> tgt(int const &lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<bool>> tge(Temporal<int> const &lhs, Temporal<int> const &rhs);
+template unique_ptr<Temporal<bool>> tge(Temporal<int> const &lhs, int const &rhs);
+template unique_ptr<Temporal<bool>> tge(int const &lhs, Temporal<int> const &rhs);
+
+template unique_ptr<Temporal<bool>> teq(Temporal<float> const &lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<bool>> teq(Temporal<float> const &lhs, float const &rhs);
+template unique_ptr<Temporal<bool>> teq(float const &lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<bool>> tne(Temporal<float> const &lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<bool>> tne(Temporal<float> const &lhs, float const &rhs);
+template unique_ptr<Temporal<bool>> tne(float const &lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<bool>> tlt(Temporal<float> const &lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<bool>> tlt(Temporal<float> const &lhs, float const &rhs);
+template unique_ptr<Temporal<bool>> tlt(float const &lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<bool>> tle(Temporal<float> const &lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<bool>> tle(Temporal<float> const &lhs, float const &rhs);
+template unique_ptr<Temporal<bool>> tle(float const &lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<bool>> tgt(Temporal<float> const &lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<bool>> tgt(Temporal<float> const &lhs, float const &rhs);
+template unique_ptr<Temporal<bool>> tgt(float const &lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<bool>> tge(Temporal<float> const &lhs, Temporal<float> const &rhs);
+template unique_ptr<Temporal<bool>> tge(Temporal<float> const &lhs, float const &rhs);
+template unique_ptr<Temporal<bool>> tge(float const &lhs, Temporal<float> const &rhs);
+
+template unique_ptr<Temporal<bool>> teq(Temporal<string> const &lhs,
+                                        Temporal<string> const &rhs);
+template unique_ptr<Temporal<bool>> teq(Temporal<string> const &lhs, string const &rhs);
+template unique_ptr<Temporal<bool>> teq(string const &lhs, Temporal<string> const &rhs);
+template unique_ptr<Temporal<bool>> tne(Temporal<string> const &lhs,
+                                        Temporal<string> const &rhs);
+template unique_ptr<Temporal<bool>> tne(Temporal<string> const &lhs, string const &rhs);
+template unique_ptr<Temporal<bool>> tne(string const &lhs, Temporal<string> const &rhs);
+template unique_ptr<Temporal<bool>> tlt(Temporal<string> const &lhs,
+                                        Temporal<string> const &rhs);
+template unique_ptr<Temporal<bool>> tlt(Temporal<string> const &lhs, string const &rhs);
+template unique_ptr<Temporal<bool>> tlt(string const &lhs, Temporal<string> const &rhs);
+template unique_ptr<Temporal<bool>> tle(Temporal<string> const &lhs,
+                                        Temporal<string> const &rhs);
+template unique_ptr<Temporal<bool>> tle(Temporal<string> const &lhs, string const &rhs);
+template unique_ptr<Temporal<bool>> tle(string const &lhs, Temporal<string> const &rhs);
+template unique_ptr<Temporal<bool>> tgt(Temporal<string> const &lhs,
+                                        Temporal<string> const &rhs);
+template unique_ptr<Temporal<bool>> tgt(Temporal<string> const &lhs, string const &rhs);
+template unique_ptr<Temporal<bool>> tgt(string const &lhs, Temporal<string> const &rhs);
+template unique_ptr<Temporal<bool>> tge(Temporal<string> const &lhs,
+                                        Temporal<string> const &rhs);
+template unique_ptr<Temporal<bool>> tge(Temporal<string> const &lhs, string const &rhs);
+template unique_ptr<Temporal<bool>> tge(string const &lhs, Temporal<string> const &rhs);
+
+}  // namespace meos
@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <iomanip>
 #include <meos/types/temporal/TemporalSet.hpp>
+#include <meos/util/hash.hpp>
 #include <sstream>
 #include <string>
 
@@ -10,21 +11,194 @@ using namespace std;
 template <typename BaseType> TemporalSet<BaseType>::TemporalSet() {}
 
 template <typename BaseType>
-TemporalSet<BaseType>::TemporalSet(set<TInstant<BaseType>> const &instants)
-    : m_instants(instants) {}
+TemporalSet<BaseType>::TemporalSet(set<TInstant<BaseType>> const &instants) {
+  assign_instants(instants);
+}
+
+template <typename BaseType>
+TemporalSet<BaseType>::TemporalSet(vector<time_point> timestamps, vector<BaseType> values) {
+  assign_instants(move(timestamps), move(values));
+}
+
+template <typename BaseType>
+void TemporalSet<BaseType>::sort_instants(vector<time_point> &timestamps,
+                                          vector<BaseType> &values) {
+  if (timestamps.size() != values.size()) {
+    throw invalid_argument("Expected as many values as timestamps, got "
+                           + to_string(values.size()) + " values and "
+                           + to_string(timestamps.size()) + " timestamps");
+  }
+
+  auto const before = [&](size_t i, size_t j) {
+    return timestamps[i] < timestamps[j]
+           || (timestamps[i] == timestamps[j] && values[i] < values[j]);
+  };
+  size_t const n = timestamps.size();
+  size_t i = 1;
+  while (i < n && !before(i, i - 1)) i++;
+  if (i >= n) return;
+
+  vector<size_t> order(n);
+  for (size_t k = 0; k < n; k++) order[k] = k;
+  sort(order.begin(), order.end(), before);
+  vector<time_point> sorted_timestamps;
+  vector<BaseType> sorted_values;
+  sorted_timestamps.reserve(n);
+  sorted_values.reserve(n);
+  for (size_t k : order) {
+    sorted_timestamps.push_back(timestamps[k]);
+    sorted_values.push_back(move(values[k]));
+  }
+  timestamps = move(sorted_timestamps);
+  values = move(sorted_values);
+}
+
+template <typename BaseType>
+void TemporalSet<BaseType>::assign_instants(set<TInstant<BaseType>> const &instants) {
+  vector<time_point> timestamps;
+  vector<BaseType> values;
+  timestamps.reserve(instants.size());
+  values.reserve(instants.size());
+  for (auto const &e : instants) {
+    timestamps.push_back(e.getTimestamp());
+    values.push_back(e.getValue());
+  }
+  this->m_timestamps = move(timestamps);
+  this->m_values = move(values);
+  count_timestamps();
+}
+
+template <typename BaseType>
+void TemporalSet<BaseType>::assign_instants(vector<time_point> timestamps,
+                                            vector<BaseType> values) {
+  if (timestamps.size() != values.size()) {
+    throw invalid_argument("Expected as many values as timestamps, got "
+                           + to_string(values.size()) + " values and "
+                           + to_string(timestamps.size()) + " timestamps");
+  }
+
+  // Single pass over the input: check ordering and drop exact duplicates in place
+  size_t n = 0;
+  for (size_t i = 0; i < timestamps.size(); i++) {
+    if (n > 0) {
+      time_point const &pt = timestamps[n - 1];
+      BaseType const &pv = values[n - 1];
+      bool const same_t = pt == timestamps[i];
+      if (same_t && pv == values[i]) continue;
+      if (pt > timestamps[i] || (same_t && values[i] < pv)) {
+        throw invalid_argument("Instants should be ordered by timestamp and then by value");
+      }
+    }
+    if (n != i) {
+      timestamps[n] = timestamps[i];
+      values[n] = move(values[i]);
+    }
+    n++;
+  }
+  timestamps.resize(n);
+  values.resize(n);
+
+  this->m_timestamps = move(timestamps);
+  this->m_values = move(values);
+  count_timestamps();
+}
+
+template <typename BaseType>
+void TemporalSet<BaseType>::parse_instants(set<string> const &instants) {
+  vector<time_point> timestamps;
+  vector<BaseType> values;
+  timestamps.reserve(instants.size());
+  values.reserve(instants.size());
+  for (string const &e : instants) {
+    TInstant<BaseType> instant(e);
+    timestamps.push_back(instant.getTimestamp());
+    values.push_back(instant.getValue());
+  }
+  sort_instants(timestamps, values);
+  assign_instants(move(timestamps), move(values));
+}
+
+template <typename BaseType> void TemporalSet<BaseType>::count_timestamps() {
+  size_t n = 0;
+  for (size_t i = 0; i < this->m_timestamps.size(); i++) {
+    if (i == 0 || this->m_timestamps[i] != this->m_timestamps[i - 1]) n++;
+  }
+  this->m_num_timestamps = n;
+}
+
+template <typename BaseType> TInstant<BaseType> TemporalSet<BaseType>::instant_at(size_t i) const {
+  return TInstant<BaseType>(this->m_values[i], this->m_timestamps[i]);
+}
+
+template <typename BaseType> size_t TemporalSet<BaseType>::hash_instants() const {
+  // One pass over the arrays, without materializing the instants
+  size_t const n = this->m_timestamps.size();
+  size_t seed = n;
+  for (size_t i = 0; i < n; i++) {
+    hash_combine(seed, hash_value(this->m_timestamps[i]));
+    hash_combine(seed, hash_value(this->m_values[i]));
+  }
+  return seed;
+}
 
 template <typename BaseType> set<TInstant<BaseType>> TemporalSet<BaseType>::instants() const {
-  return this->m_instants;
+  // Storage is already ordered, so hinting at the end makes each insert O(1)
+  set<TInstant<BaseType>> s;
+  for (size_t i = 0; i < this->m_timestamps.size(); i++) {
+    s.insert(s.end(), instant_at(i));
+  }
+  return s;
 }
 
 template <typename BaseType> set<time_point> TemporalSet<BaseType>::timestamps() const {
   set<time_point> s;
-  for (auto const &e : this->m_instants) {
-    s.insert(e.getTimestamp());
+  for (auto const &t : this->m_timestamps) {
+    s.insert(s.end(), t);
   }
   return s;
 }
 
+template <typename BaseType> bbox_t<BaseType> TemporalSet<BaseType>::boundingBox() const {
+  return this->m_bbox;
+}
+
+template <typename BaseType> size_t TemporalSet<BaseType>::numTimestamps() const {
+  return this->m_num_timestamps;
+}
+
+template <typename BaseType> time_point TemporalSet<BaseType>::startTimestamp() const {
+  if (this->m_timestamps.empty()) {
+    throw "At least one timestamp expected";
+  }
+  return this->m_timestamps.front();
+}
+
+template <typename BaseType> time_point TemporalSet<BaseType>::endTimestamp() const {
+  if (this->m_timestamps.empty()) {
+    throw "At least one timestamp expected";
+  }
+  return this->m_timestamps.back();
+}
+
+template <typename BaseType> time_point TemporalSet<BaseType>::timestampN(size_t n) const {
+  if (this->m_num_timestamps <= n) {
+    throw "At least " + to_string(n) + " timestamp(s) expected";
+  }
+
+  // Without repeated timestamps, the n-th distinct one is simply at position n
+  if (this->m_num_timestamps == this->m_timestamps.size()) {
+    return this->m_timestamps[n];
+  }
+
+  size_t i = 0;
+  while (true) {
+    if (n == 0) return this->m_timestamps[i];
+    time_point const t = this->m_timestamps[i];
+    while (this->m_timestamps[i] == t) i++;
+    n--;
+  }
+}
+
 template class TemporalSet<bool>;
 template class TemporalSet<int>;
 template class TemporalSet<float>;
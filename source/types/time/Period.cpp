@@ -1,5 +1,6 @@
 #include <meos/io/utils.hpp>
 #include <meos/types/time/Period.hpp>
+#include <meos/util/hash.hpp>
 #include <meos/util/serializing.hpp>
 #include <sstream>
 #include <string>
@@ -80,8 +81,9 @@ bool Period::overlap(Period const &period) const {
                                                            - max(this->lower(), period.lower()));
   if (o.count() > 0) return true;
   if (o.count() < 0) return false;
-  return this->lower() < period.lower() ? this->upper_inc() && period.lower_inc()
-                                        : period.upper_inc() && this->lower_inc();
+  // The two only share a single timestamp, which both must contain
+  time_point const t = max(this->lower(), period.lower());
+  return this->contains_timestamp(t) && period.contains_timestamp(t);
 }
 
 bool Period::contains_timestamp(time_point const timestamp) const {
@@ -110,6 +112,10 @@ int Period::compare(Period const &other) const {
   return 0;
 }
 
+size_t Period::hash() const {
+  return hash_fields(this->m_lower, this->m_upper, this->m_lower_inc, this->m_upper_inc);
+}
+
 bool operator==(Period const &lhs, Period const &rhs) { return lhs.compare(rhs) == 0; }
 
 bool operator!=(Period const &lhs, Period const &rhs) { return lhs.compare(rhs) != 0; }
@@ -1,47 +1,191 @@
+#include <algorithm>
 #include <iomanip>
 #include <meos/io/utils.hpp>
 #include <meos/types/time/PeriodSet.hpp>
+#include <meos/util/hash.hpp>
 #include <sstream>
 #include <string>
 
 namespace meos {
 using namespace std;
 
-PeriodSet::PeriodSet() {}
+namespace {
+
+/**
+ * Adds a period to sorted, disjoint and non adjacent periods, merging it with
+ * the last one when they overlap or are adjacent. The period must not start
+ * before the last one does.
+ */
+void append(vector<Period> &periods, Period const &period) {
+  if (periods.empty()) {
+    periods.push_back(period);
+    return;
+  }
+  Period const &last = periods.back();
+  bool const joined
+      = period.lower() < last.upper()
+        || (period.lower() == last.upper() && (last.upper_inc() || period.lower_inc()));
+  if (!joined) {
+    periods.push_back(period);
+    return;
+  }
+  bool const lower_inc = last.lower_inc() || (period.lower() == last.lower() && period.lower_inc());
+  time_point upper = last.upper();
+  bool upper_inc = last.upper_inc();
+  if (period.upper() > upper) {
+    upper = period.upper();
+    upper_inc = period.upper_inc();
+  } else if (period.upper() == upper) {
+    upper_inc = upper_inc || period.upper_inc();
+  }
+  periods.back() = Period(last.lower(), upper, lower_inc, upper_inc);
+}
 
-PeriodSet::PeriodSet(set<unique_ptr<Period>> const &periods) {
-  for (auto const &e : periods) m_periods.insert(e->clone());
+/**
+ * Does the first period start before the second one? Periods must be appended
+ * in this order, as Period's own ordering may put a shorter period starting at
+ * the same time first, which would then hide the longer one from the period
+ * before.
+ */
+bool starts_before(Period const &lhs, Period const &rhs) {
+  return lhs.lower() < rhs.lower()
+         || (lhs.lower() == rhs.lower() && lhs.lower_inc() && !rhs.lower_inc());
+}
+
+vector<Period> normalize(vector<Period> periods) {
+  if (!is_sorted(periods.begin(), periods.end(), starts_before)) {
+    sort(periods.begin(), periods.end(), starts_before);
+  }
+  vector<Period> normalized;
+  normalized.reserve(periods.size());
+  for (Period const &period : periods) append(normalized, period);
+  return normalized;
+}
+
+vector<Period> instant_periods(TimestampSet const &timestampset) {
+  vector<Period> periods;
+  periods.reserve(timestampset.numTimestamps());
+  for (size_t i = 0; i < timestampset.numTimestamps(); i++) {
+    time_point const t = timestampset.timestampN(i);
+    periods.emplace_back(t, t, true, true);
+  }
+  return periods;
+}
+
+/**
+ * Merges two arrays of normalized periods into a normalized array.
+ */
+vector<Period> merge_union(vector<Period> const &lhs, vector<Period> const &rhs) {
+  vector<Period> result;
+  result.reserve(lhs.size() + rhs.size());
+  size_t i = 0, j = 0;
+  while (i < lhs.size() || j < rhs.size()) {
+    bool const take_lhs = j == rhs.size() || (i < lhs.size() && starts_before(lhs[i], rhs[j]));
+    append(result, take_lhs ? lhs[i++] : rhs[j++]);
+  }
+  return result;
+}
+
+vector<Period> merge_intersection(vector<Period> const &lhs, vector<Period> const &rhs) {
+  vector<Period> result;
+  size_t i = 0, j = 0;
+  while (i < lhs.size() && j < rhs.size()) {
+    Period const &a = lhs[i];
+    Period const &b = rhs[j];
+    if (a.overlap(b)) {
+      time_point const lower = max(a.lower(), b.lower());
+      time_point const upper = min(a.upper(), b.upper());
+      bool const lower_inc = (a.lower() != lower || a.lower_inc())
+                             && (b.lower() != lower || b.lower_inc());
+      bool const upper_inc = (a.upper() != upper || a.upper_inc())
+                             && (b.upper() != upper || b.upper_inc());
+      result.emplace_back(lower, upper, lower_inc, upper_inc);
+    }
+    // Whichever ends first can't overlap anything else on the other side
+    if (a.upper() <= b.upper()) i++;
+    if (b.upper() <= a.upper()) j++;
+  }
+  return result;
 }
 
-PeriodSet::PeriodSet(set<Period> const &periods) {
-  for (auto e : periods) m_periods.insert(e.clone());
+vector<Period> merge_minus(vector<Period> const &lhs, vector<Period> const &rhs) {
+  vector<Period> result;
+  size_t j = 0;
+  for (Period const &a : lhs) {
+    time_point lower = a.lower();
+    bool lower_inc = a.lower_inc();
+
+    // Skip what ends before the period starts
+    while (j < rhs.size()
+           && (rhs[j].upper() < lower
+               || (rhs[j].upper() == lower && !(rhs[j].upper_inc() && lower_inc)))) {
+      j++;
+    }
+
+    // Cut out what starts before the period ends
+    bool covered = false;
+    for (; j < rhs.size(); j++) {
+      Period const &b = rhs[j];
+      bool const starts_before_end = b.lower() < a.upper()
+                                     || (b.lower() == a.upper() && b.lower_inc() && a.upper_inc());
+      if (!starts_before_end) break;
+      if (lower < b.lower() || (lower == b.lower() && lower_inc && !b.lower_inc())) {
+        result.emplace_back(lower, b.lower(), lower_inc, !b.lower_inc());
+      }
+      // The last one cut out may also overlap the next period, so it isn't skipped
+      if (b.upper() > a.upper() || (b.upper() == a.upper() && (b.upper_inc() || !a.upper_inc()))) {
+        covered = true;
+        break;
+      }
+      lower = b.upper();
+      lower_inc = !b.upper_inc();
+    }
+
+    if (!covered
+        && (lower < a.upper() || (lower == a.upper() && lower_inc && a.upper_inc()))) {
+      result.emplace_back(lower, a.upper(), lower_inc, a.upper_inc());
+    }
+  }
+  return result;
 }
 
-PeriodSet::PeriodSet(PeriodSet const &t) {
-  for (auto const &e : t.m_periods) m_periods.insert(e->clone());
+}  // namespace
+
+PeriodSet::PeriodSet() {}
+
+PeriodSet::PeriodSet(set<unique_ptr<Period>> const &periods) {
+  vector<Period> v;
+  v.reserve(periods.size());
+  for (auto const &e : periods) v.push_back(*e);
+  m_periods = normalize(move(v));
 }
 
+PeriodSet::PeriodSet(set<Period> const &periods)
+    : m_periods(normalize(vector<Period>(periods.begin(), periods.end()))) {}
+
+PeriodSet::PeriodSet(PeriodSet const &t) : m_periods(t.m_periods) {}
+
 PeriodSet::PeriodSet(set<string> const &periods) {
-  PeriodSet period_set;
-  for (auto const &e : periods) m_periods.insert(make_unique<Period>(e));
+  vector<Period> v;
+  v.reserve(periods.size());
+  for (auto const &e : periods) v.emplace_back(e);
+  m_periods = normalize(move(v));
 }
 
 PeriodSet::PeriodSet(string const &serialized) {
   stringstream ss(serialized);
+  ss >> *this;
+}
+
+PeriodSet PeriodSet::from_normalized(vector<Period> periods) {
   PeriodSet period_set;
-  ss >> period_set;
-  for (auto const &e : period_set.m_periods) m_periods.insert(e->clone());
+  period_set.m_periods = move(periods);
+  return period_set;
 }
 
-unique_ptr<PeriodSet> PeriodSet::clone() { return make_unique<PeriodSet>(this->m_periods); }
+unique_ptr<PeriodSet> PeriodSet::clone() { return make_unique<PeriodSet>(*this); }
 
-set<Period> PeriodSet::periods() const {
-  set<Period> s;
-  for (auto const &e : m_periods) {
-    s.insert(*e.get());
-  }
-  return s;
-}
+set<Period> PeriodSet::periods() const { return set<Period>(m_periods.begin(), m_periods.end()); }
 
 Period PeriodSet::period() const {
   Period start = startPeriod();
@@ -49,49 +193,54 @@ Period PeriodSet::period() const {
   return Period(start.lower(), end.upper(), start.lower_inc(), end.upper_inc());
 }
 
-size_t PeriodSet::numPeriods() const { return periods().size(); }
+size_t PeriodSet::numPeriods() const { return m_periods.size(); }
 
 Period PeriodSet::startPeriod() const {
-  set<Period> s = periods();
-  if (s.size() <= 0) {
+  if (m_periods.size() <= 0) {
     throw "At least one period expected";
   }
-  return *s.begin();
+  return m_periods.front();
 }
 
 Period PeriodSet::endPeriod() const {
-  set<Period> s = periods();
-  if (s.size() <= 0) {
+  if (m_periods.size() <= 0) {
     throw "At least one period expected";
   }
-  return *s.rbegin();
+  return m_periods.back();
 }
 
 Period PeriodSet::periodN(size_t n) const {
-  set<Period> s = periods();
-  if (s.size() <= n) {
+  if (m_periods.size() <= n) {
     throw "At least " + to_string(n) + " period(s) expected";
   }
-  return *next(s.begin(), n);
+  return m_periods[n];
 }
 
+vector<Period>::const_iterator PeriodSet::begin() const { return m_periods.begin(); }
+
+vector<Period>::const_iterator PeriodSet::end() const { return m_periods.end(); }
+
 duration_ms PeriodSet::timespan() const {
   duration_ms result(0);
-  for (auto const &period : m_periods) result += period->timespan();
+  for (auto const &period : m_periods) result += period.timespan();
   return result;
 }
 
 unique_ptr<PeriodSet> PeriodSet::shift(duration_ms const timedelta) const {
-  set<unique_ptr<Period>> pset;
-  for (auto const &e : m_periods) pset.insert(e->shift(timedelta));
-  return make_unique<PeriodSet>(pset);
+  vector<Period> periods;
+  periods.reserve(m_periods.size());
+  for (auto const &e : m_periods) {
+    periods.emplace_back(e.lower() + timedelta, e.upper() + timedelta, e.lower_inc(),
+                         e.upper_inc());
+  }
+  return make_unique<PeriodSet>(from_normalized(move(periods)));
 }
 
 set<time_point> PeriodSet::timestamps() const {
   set<time_point> s;
   for (auto const &e : m_periods) {
-    s.insert(e->lower());
-    s.insert(e->upper());
+    s.insert(s.end(), e.lower());
+    s.insert(s.end(), e.upper());
   }
   return s;
 }
@@ -99,19 +248,17 @@ set<time_point> PeriodSet::timestamps() const {
 size_t PeriodSet::numTimestamps() const { return timestamps().size(); }
 
 time_point PeriodSet::startTimestamp() const {
-  set<time_point> s = timestamps();
-  if (s.size() <= 0) {
+  if (m_periods.size() <= 0) {
     throw "At least one timestamp expected";
   }
-  return *s.begin();
+  return m_periods.front().lower();
 }
 
 time_point PeriodSet::endTimestamp() const {
-  set<time_point> s = timestamps();
-  if (s.size() <= 0) {
+  if (m_periods.size() <= 0) {
     throw "At least one timestamp expected";
   }
-  return *s.rbegin();
+  return m_periods.back().upper();
 }
 
 time_point PeriodSet::timestampN(size_t n) const {
@@ -122,15 +269,86 @@ time_point PeriodSet::timestampN(size_t n) const {
   return *next(s.begin(), n);
 }
 
+bool PeriodSet::contains_timestamp(time_point const timestamp) const {
+  // Only the first period not ending before the timestamp can contain it
+  auto it = lower_bound(m_periods.begin(), m_periods.end(), timestamp,
+                        [](Period const &p, time_point const t) { return p.upper() < t; });
+  return it != m_periods.end() && it->contains_timestamp(timestamp);
+}
+
+bool PeriodSet::overlap(Period const &period) const {
+  // Bounds being exclusive, the first period not ending before the lower
+  // bound might miss it by a single timestamp, but then the next one is the
+  // only other candidate
+  auto it = lower_bound(m_periods.begin(), m_periods.end(), period.lower(),
+                        [](Period const &p, time_point const t) { return p.upper() < t; });
+  for (; it != m_periods.end() && it->lower() <= period.upper(); it++) {
+    if (it->overlap(period)) return true;
+  }
+  return false;
+}
+
+bool PeriodSet::overlap(PeriodSet const &other) const {
+  size_t i = 0, j = 0;
+  while (i < m_periods.size() && j < other.m_periods.size()) {
+    Period const &a = m_periods[i];
+    Period const &b = other.m_periods[j];
+    if (a.overlap(b)) return true;
+    if (a.upper() <= b.upper()) i++;
+    if (b.upper() <= a.upper()) j++;
+  }
+  return false;
+}
+
+PeriodSet PeriodSet::union_(Period const &period) const {
+  return from_normalized(merge_union(m_periods, {period}));
+}
+
+PeriodSet PeriodSet::union_(PeriodSet const &other) const {
+  return from_normalized(merge_union(m_periods, other.m_periods));
+}
+
+PeriodSet PeriodSet::union_(TimestampSet const &timestampset) const {
+  return from_normalized(merge_union(m_periods, instant_periods(timestampset)));
+}
+
+PeriodSet PeriodSet::intersection(Period const &period) const {
+  return from_normalized(merge_intersection(m_periods, {period}));
+}
+
+PeriodSet PeriodSet::intersection(PeriodSet const &other) const {
+  return from_normalized(merge_intersection(m_periods, other.m_periods));
+}
+
+TimestampSet PeriodSet::intersection(TimestampSet const &timestampset) const {
+  return timestampset.intersection(*this);
+}
+
+PeriodSet PeriodSet::minus(Period const &period) const {
+  return from_normalized(merge_minus(m_periods, {period}));
+}
+
+PeriodSet PeriodSet::minus(PeriodSet const &other) const {
+  return from_normalized(merge_minus(m_periods, other.m_periods));
+}
+
+PeriodSet PeriodSet::minus(TimestampSet const &timestampset) const {
+  return from_normalized(merge_minus(m_periods, instant_periods(timestampset)));
+}
+
+size_t PeriodSet::hash() const { return hash_range(m_periods.begin(), m_periods.end()); }
+
 bool operator==(PeriodSet const &lhs, PeriodSet const &rhs) {
-  return lhs.periods() == rhs.periods();
+  return lhs.m_periods == rhs.m_periods;
 }
 
 bool operator!=(PeriodSet const &lhs, PeriodSet const &rhs) {
-  return lhs.periods() != rhs.periods();
+  return lhs.m_periods != rhs.m_periods;
 }
 
-bool operator<(PeriodSet const &lhs, PeriodSet const &rhs) { return lhs.periods() < rhs.periods(); }
+bool operator<(PeriodSet const &lhs, PeriodSet const &rhs) {
+  return lhs.m_periods < rhs.m_periods;
+}
 
 bool operator>(PeriodSet const &lhs, PeriodSet const &rhs) { return rhs < lhs; }
 
@@ -143,25 +361,24 @@ istream &operator>>(istream &in, PeriodSet &period_set) {
 
   consume(in, '{');
 
-  set<unique_ptr<Period>> s = {};
+  vector<Period> v;
 
   Period period;
   in >> period;
-  s.insert(period.clone());
+  v.push_back(period);
 
   while (true) {
     in >> c;
     if (c != ',') break;
     in >> period;
-    s.insert(period.clone());
+    v.push_back(period);
   }
 
   if (c != '}') {
     throw invalid_argument("Expected '}'");
   }
 
-  period_set.m_periods.empty();
-  for (auto const &e : s) period_set.m_periods.insert(e->clone());
+  period_set.m_periods = normalize(move(v));
 
   return in;
 }
@@ -169,7 +386,7 @@ istream &operator>>(istream &in, PeriodSet &period_set) {
 ostream &operator<<(ostream &os, PeriodSet const &period_set) {
   bool first = true;
   os << "{";
-  for (auto period : period_set.periods()) {
+  for (auto const &period : period_set.m_periods) {
     if (first)
       first = false;
     else
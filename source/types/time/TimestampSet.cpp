@@ -1,36 +1,93 @@
+#include <algorithm>
 #include <iomanip>
 #include <meos/io/utils.hpp>
+#include <meos/types/time/PeriodSet.hpp>
 #include <meos/types/time/TimestampSet.hpp>
+#include <meos/util/hash.hpp>
+#include <meos/util/sorted.hpp>
 #include <sstream>
 #include <string>
 
 namespace meos {
 using namespace std;
 
+namespace {
+
+int64_t to_ticks(time_point const t) { return t.time_since_epoch().count(); }
+
+time_point from_ticks(int64_t const ticks) { return time_point(time_point::duration(ticks)); }
+
+/**
+ * Positions of the first timestamp within the period and of the first one
+ * after it.
+ */
+pair<size_t, size_t> bounds_within(vector<int64_t> const &timestamps, Period const &period) {
+  auto const begin = timestamps.begin();
+  auto const end = timestamps.end();
+  int64_t const lower = to_ticks(period.lower());
+  int64_t const upper = to_ticks(period.upper());
+  auto first = period.lower_inc() ? lower_bound(begin, end, lower) : upper_bound(begin, end, lower);
+  auto last = period.upper_inc() ? upper_bound(first, end, upper) : lower_bound(first, end, upper);
+  return {first - begin, last - begin};
+}
+
+/**
+ * Keeps the timestamps which are, or are not, within the periods.
+ */
+vector<int64_t> filter_within(vector<int64_t> const &timestamps, PeriodSet const &periodset,
+                              bool const within) {
+  vector<int64_t> result;
+  size_t outside = 0;
+  for (Period const &period : periodset) {
+    // The periods being disjoint and sorted, so are the ranges of timestamps within them
+    auto const range = bounds_within(timestamps, period);
+    if (within) {
+      result.insert(result.end(), timestamps.begin() + range.first,
+                    timestamps.begin() + range.second);
+    } else {
+      result.insert(result.end(), timestamps.begin() + outside, timestamps.begin() + range.first);
+    }
+    outside = range.second;
+  }
+  if (!within) result.insert(result.end(), timestamps.begin() + outside, timestamps.end());
+  return result;
+}
+
+}  // namespace
+
 TimestampSet::TimestampSet() {}
 
-TimestampSet::TimestampSet(set<time_point> &timestamps) {
-  for (auto const &e : timestamps) m_timestamps.insert(e);
+TimestampSet::TimestampSet(set<time_point> const &timestamps) {
+  m_timestamps.reserve(timestamps.size());
+  for (auto const &e : timestamps) m_timestamps.push_back(to_ticks(e));
 }
 
-TimestampSet::TimestampSet(set<string> &timestamps) {
+TimestampSet::TimestampSet(set<string> const &timestamps) {
   for (auto const &e : timestamps) {
     stringstream ss(e);
-    m_timestamps.insert(nextTime(ss));
+    m_timestamps.push_back(to_ticks(nextTime(ss)));
   }
+  // Different strings may still be the same timestamp
+  sort(m_timestamps.begin(), m_timestamps.end());
+  m_timestamps.erase(unique(m_timestamps.begin(), m_timestamps.end()), m_timestamps.end());
 }
 
 TimestampSet::TimestampSet(string const &serialized) {
   stringstream ss(serialized);
+  ss >> *this;
+}
+
+TimestampSet TimestampSet::from_sorted(vector<int64_t> timestamps) {
   TimestampSet timestamp_set;
-  ss >> timestamp_set;
-  for (auto const &e : timestamp_set.m_timestamps) m_timestamps.insert(e);
+  timestamp_set.m_timestamps = move(timestamps);
+  return timestamp_set;
 }
 
 set<Period> TimestampSet::periods() const {
   set<Period> s;
   for (auto const &e : m_timestamps) {
-    s.insert(Period(e, e, true, true));
+    time_point const t = from_ticks(e);
+    s.insert(s.end(), Period(t, t, true, true));
   }
   return s;
 }
@@ -41,30 +98,30 @@ Period TimestampSet::period() const {
   return Period(start.lower(), end.upper(), start.lower_inc(), end.upper_inc());
 }
 
-size_t TimestampSet::numPeriods() const { return periods().size(); }
+size_t TimestampSet::numPeriods() const { return m_timestamps.size(); }
 
 Period TimestampSet::startPeriod() const {
-  set<Period> s = periods();
-  if (s.size() <= 0) {
+  if (m_timestamps.size() <= 0) {
     throw "At least one period expected";
   }
-  return *s.begin();
+  time_point const t = from_ticks(m_timestamps.front());
+  return Period(t, t, true, true);
 }
 
 Period TimestampSet::endPeriod() const {
-  set<Period> s = periods();
-  if (s.size() <= 0) {
+  if (m_timestamps.size() <= 0) {
     throw "At least one period expected";
   }
-  return *s.rbegin();
+  time_point const t = from_ticks(m_timestamps.back());
+  return Period(t, t, true, true);
 }
 
 Period TimestampSet::periodN(size_t n) const {
-  set<Period> s = periods();
-  if (s.size() <= n) {
+  if (m_timestamps.size() <= n) {
     throw "At least " + to_string(n) + " period(s) expected";
   }
-  return *next(s.begin(), n);
+  time_point const t = from_ticks(m_timestamps[n]);
+  return Period(t, t, true, true);
 }
 
 /**
@@ -73,55 +130,160 @@ Period TimestampSet::periodN(size_t n) const {
 duration_ms TimestampSet::timespan() const { return duration_ms(0); }
 
 unique_ptr<TimestampSet> TimestampSet::shift(duration_ms const timedelta) const {
-  set<time_point> pset;
-  for (auto const &e : m_timestamps) pset.insert(e + timedelta);
-  return make_unique<TimestampSet>(pset);
+  int64_t const delta = chrono::duration_cast<time_point::duration>(timedelta).count();
+  vector<int64_t> timestamps;
+  timestamps.reserve(m_timestamps.size());
+  for (auto const &e : m_timestamps) timestamps.push_back(e + delta);
+  return make_unique<TimestampSet>(from_sorted(move(timestamps)));
 }
 
 set<time_point> TimestampSet::timestamps() const {
   set<time_point> s;
   for (auto const &e : m_timestamps) {
-    s.insert(e);
+    s.insert(s.end(), from_ticks(e));
   }
   return s;
 }
 
-size_t TimestampSet::numTimestamps() const { return timestamps().size(); }
+size_t TimestampSet::numTimestamps() const { return m_timestamps.size(); }
 
 time_point TimestampSet::startTimestamp() const {
-  set<time_point> s = timestamps();
-  if (s.size() <= 0) {
+  if (m_timestamps.size() <= 0) {
     throw "At least one timestamp expected";
   }
-  return *s.begin();
+  return from_ticks(m_timestamps.front());
 }
 
 time_point TimestampSet::endTimestamp() const {
-  set<time_point> s = timestamps();
-  if (s.size() <= 0) {
+  if (m_timestamps.size() <= 0) {
     throw "At least one timestamp expected";
   }
-  return *s.rbegin();
+  return from_ticks(m_timestamps.back());
 }
 
 time_point TimestampSet::timestampN(size_t n) const {
-  set<time_point> s = timestamps();
-  if (s.size() <= n) {
+  if (m_timestamps.size() <= n) {
     throw "At least " + to_string(n) + " timestamp(s) expected";
   }
-  return *next(s.begin(), n);
+  return from_ticks(m_timestamps[n]);
+}
+
+bool TimestampSet::contains_timestamp(time_point const timestamp) const {
+  return binary_search(m_timestamps.begin(), m_timestamps.end(), to_ticks(timestamp));
+}
+
+vector<bool> TimestampSet::contains_timestamps(vector<time_point> const &timestamps) const {
+  vector<bool> result(timestamps.size());
+  if (!is_sorted(timestamps.begin(), timestamps.end())) {
+    for (size_t j = 0; j < timestamps.size(); j++) result[j] = contains_timestamp(timestamps[j]);
+    return result;
+  }
+
+  size_t const n = m_timestamps.size();
+  size_t i = 0;
+  for (size_t j = 0; j < timestamps.size() && i < n; j++) {
+    int64_t const query = to_ticks(timestamps[j]);
+    i = advance_to(m_timestamps.data(), i, n, query);
+    result[j] = i < n && m_timestamps[i] == query;
+  }
+  return result;
 }
 
+bool TimestampSet::contains_any(vector<time_point> const &timestamps) const {
+  return contains_any(timestamps.data(), timestamps.size());
+}
+
+bool TimestampSet::contains_any(time_point const *timestamps, size_t size) const {
+  if (!is_sorted(timestamps, timestamps + size)) {
+    return any_of(timestamps, timestamps + size,
+                  [this](time_point const &t) { return contains_timestamp(t); });
+  }
+  return intersects_sorted(m_timestamps.data(), m_timestamps.size(), timestamps, size);
+}
+
+bool TimestampSet::overlap(Period const &period) const {
+  auto const range = bounds_within(m_timestamps, period);
+  return range.first < range.second;
+}
+
+TimestampSet TimestampSet::union_(TimestampSet const &other) const {
+  vector<int64_t> result;
+  result.reserve(m_timestamps.size() + other.m_timestamps.size());
+  set_union(m_timestamps.begin(), m_timestamps.end(), other.m_timestamps.begin(),
+            other.m_timestamps.end(), back_inserter(result));
+  return from_sorted(move(result));
+}
+
+PeriodSet TimestampSet::union_(Period const &period) const {
+  return PeriodSet(set<Period>{period}).union_(*this);
+}
+
+PeriodSet TimestampSet::union_(PeriodSet const &periodset) const {
+  return periodset.union_(*this);
+}
+
+TimestampSet TimestampSet::intersection(TimestampSet const &other) const {
+  // Leapfrog over whichever side is behind, so that a small set is cheap to
+  // intersect with a large one
+  vector<int64_t> const &lhs = m_timestamps;
+  vector<int64_t> const &rhs = other.m_timestamps;
+  vector<int64_t> result;
+  size_t i = 0, j = 0;
+  while (i < lhs.size() && j < rhs.size()) {
+    if (lhs[i] == rhs[j]) {
+      result.push_back(lhs[i]);
+      i++;
+      j++;
+    } else if (lhs[i] < rhs[j]) {
+      i = advance_to(lhs.data(), i, lhs.size(), rhs[j]);
+    } else {
+      j = advance_to(rhs.data(), j, rhs.size(), lhs[i]);
+    }
+  }
+  return from_sorted(move(result));
+}
+
+TimestampSet TimestampSet::intersection(Period const &period) const {
+  auto const range = bounds_within(m_timestamps, period);
+  return from_sorted(vector<int64_t>(m_timestamps.begin() + range.first,
+                                     m_timestamps.begin() + range.second));
+}
+
+TimestampSet TimestampSet::intersection(PeriodSet const &periodset) const {
+  return from_sorted(filter_within(m_timestamps, periodset, true));
+}
+
+TimestampSet TimestampSet::minus(TimestampSet const &other) const {
+  vector<int64_t> result;
+  result.reserve(m_timestamps.size());
+  set_difference(m_timestamps.begin(), m_timestamps.end(), other.m_timestamps.begin(),
+                 other.m_timestamps.end(), back_inserter(result));
+  return from_sorted(move(result));
+}
+
+TimestampSet TimestampSet::minus(Period const &period) const {
+  auto const range = bounds_within(m_timestamps, period);
+  vector<int64_t> result(m_timestamps.begin(), m_timestamps.begin() + range.first);
+  result.insert(result.end(), m_timestamps.begin() + range.second, m_timestamps.end());
+  return from_sorted(move(result));
+}
+
+TimestampSet TimestampSet::minus(PeriodSet const &periodset) const {
+  return from_sorted(filter_within(m_timestamps, periodset, false));
+}
+
+size_t TimestampSet::hash() const { return hash_range(m_timestamps.begin(), m_timestamps.end()); }
+
 bool operator==(TimestampSet const &lhs, TimestampSet const &rhs) {
-  return lhs.timestamps() == rhs.timestamps();
+  return lhs.m_timestamps == rhs.m_timestamps;
 }
 
 bool operator!=(TimestampSet const &lhs, TimestampSet const &rhs) {
-  return lhs.timestamps() != rhs.timestamps();
+  return lhs.m_timestamps != rhs.m_timestamps;
 }
 
 bool operator<(TimestampSet const &lhs, TimestampSet const &rhs) {
-  return lhs.timestamps() < rhs.timestamps();
+  return lhs.m_timestamps < rhs.m_timestamps;
 }
 
 bool operator>(TimestampSet const &lhs, TimestampSet const &rhs) { return rhs < lhs; }
@@ -135,21 +297,23 @@ istream &operator>>(istream &in, TimestampSet &timestamp_set) {
 
   consume(in, '{');
 
-  set<time_point> s = {};
+  vector<int64_t> v;
 
-  s.insert(nextTime(in));
+  v.push_back(to_ticks(nextTime(in)));
 
   while (true) {
     in >> c;
     if (c != ',') break;
-    s.insert(nextTime(in));
+    v.push_back(to_ticks(nextTime(in)));
   }
 
   if (c != '}') {
     throw invalid_argument("Expected '}'");
   }
 
-  timestamp_set.m_timestamps = s;
+  sort(v.begin(), v.end());
+  v.erase(unique(v.begin(), v.end()), v.end());
+  timestamp_set.m_timestamps = move(v);
 
   return in;
 }
@@ -157,12 +321,12 @@ istream &operator>>(istream &in, TimestampSet &timestamp_set) {
 ostream &operator<<(ostream &os, TimestampSet const &timestamp_set) {
   bool first = true;
   os << "{";
-  for (auto t : timestamp_set.timestamps()) {
+  for (auto t : timestamp_set.m_timestamps) {
     if (first)
       first = false;
     else
       os << ", ";
-    os << write_ISO8601_time(t);
+    os << write_ISO8601_time(from_ticks(t));
   }
   os << "}";
   return os;
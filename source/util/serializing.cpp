@@ -1,26 +1,72 @@
-#include <iomanip>
-#include <meos/types/geom/GeomPoint.hpp>
+#include <cstdint>
 #include <meos/util/serializing.hpp>
-#include <sstream>
+#include <meos/util/time.hpp>
 #include <string>
 
 namespace meos {
 
+namespace {
+
+// Writes the number zero padded to the given width
+char *write_digits(char *p, int64_t value, int width) {
+  char digits[20];
+  int n = 0;
+  do {
+    digits[n++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value > 0);
+  for (int i = n; i < width; i++) *p++ = '0';
+  while (n > 0) *p++ = digits[--n];
+  return p;
+}
+
+}  // namespace
+
 std::string write_ISO8601_time(time_point const &t) {
-  std::stringstream textStream;
-  time_t tt = std::chrono::time_point_cast<std::chrono::milliseconds>(t).time_since_epoch().count();
-  int millis = tt % 1000;
-  tt = tt / 1000;
+  char buffer[32];
+  return std::string(buffer, write_ISO8601_time(t, buffer));
+}
 
-  textStream << std::put_time(gmtime(&tt), "%FT%T");
+size_t write_ISO8601_time(time_point const &t, char *buffer) {
+  int64_t const ms_per_day = 24 * 60 * 60 * 1000;
+  auto const since_epoch = std::chrono::time_point_cast<std::chrono::milliseconds>(t);
+  int64_t const ms = since_epoch.time_since_epoch().count();
+
+  // Floor division, so that times before 1970 still get positive time of day
+  int64_t days = ms / ms_per_day;
+  if (ms % ms_per_day < 0) days--;
+  int64_t time_of_day = ms - days * ms_per_day;
+
+  int64_t year;
+  unsigned month, day;
+  civil_from_days(days, year, month, day);
+
+  char *p = buffer;
+  if (year < 0) {
+    *p++ = '-';
+    year = -year;
+  }
+  p = write_digits(p, year, 4);
+  *p++ = '-';
+  p = write_digits(p, month, 2);
+  *p++ = '-';
+  p = write_digits(p, day, 2);
+  *p++ = 'T';
+  p = write_digits(p, time_of_day / 3600000, 2);
+  *p++ = ':';
+  p = write_digits(p, time_of_day / 60000 % 60, 2);
+  *p++ = ':';
+  p = write_digits(p, time_of_day / 1000 % 60, 2);
 
+  int64_t const millis = time_of_day % 1000;
   if (millis > 0) {
-    textStream << "." << std::setfill('0') << std::setw(3) << millis;
+    *p++ = '.';
+    p = write_digits(p, millis, 3);
   }
 
   // We only output time in UTC
-  textStream << "+0000";
-  return textStream.str();
+  for (char c : {'+', '0', '0', '0', '0'}) *p++ = c;
+  return p - buffer;
 }
 
 }  // namespace meos
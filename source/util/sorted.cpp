@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <meos/util/sorted.hpp>
+
+namespace meos {
+using namespace std;
+
+using time_point = chrono::system_clock::time_point;
+
+namespace {
+
+int64_t ticks(int64_t const value) { return value; }
+
+int64_t ticks(time_point const t) { return t.time_since_epoch().count(); }
+
+}  // namespace
+
+template <typename T> size_t advance_to(T const *values, size_t i, size_t n, int64_t value) {
+  // Merges mostly move forward by a position or two at a time, and then by a
+  // few more, which a linear scan settles
+  for (size_t const stop = min(i + 16, n); i < stop; i++) {
+    if (ticks(values[i]) >= value) return i;
+  }
+
+  // Larger jumps gallop ahead, doubling the step until overshooting, and
+  // binary search the last step
+  size_t lower = i;
+  for (size_t step = 1; i < n && ticks(values[i]) < value; step *= 2) {
+    lower = i + 1;
+    i += step;
+  }
+  return lower_bound(values + lower, values + min(i, n), value,
+                     [](T const &lhs, int64_t const rhs) { return ticks(lhs) < rhs; })
+         - values;
+}
+
+template <typename L, typename R>
+bool intersects_sorted(L const *lhs, size_t lhs_n, R const *rhs, size_t rhs_n) {
+  size_t i = 0, j = 0;
+  while (i < lhs_n && j < rhs_n) {
+    if (ticks(lhs[i]) == ticks(rhs[j])) return true;
+    if (ticks(lhs[i]) < ticks(rhs[j])) {
+      i = advance_to(lhs, i, lhs_n, ticks(rhs[j]));
+    } else {
+      j = advance_to(rhs, j, rhs_n, ticks(lhs[i]));
+    }
+  }
+  return false;
+}
+
+template size_t advance_to(int64_t const *values, size_t i, size_t n, int64_t value);
+template size_t advance_to(time_point const *values, size_t i, size_t n, int64_t value);
+template bool intersects_sorted(int64_t const *lhs, size_t lhs_n, time_point const *rhs,
+                                size_t rhs_n);
+
+}  // namespace meos
@@ -0,0 +1,34 @@
+#include <meos/util/time.hpp>
+
+namespace meos {
+
+int64_t days_from_civil(int64_t year, unsigned month, unsigned day) {
+  // Shift the year to start on March 1st, so that the leap day is the last one
+  year -= month <= 2;
+  int64_t const era = (year >= 0 ? year : year - 399) / 400;
+  unsigned const yoe = static_cast<unsigned>(year - era * 400);  // [0, 399]
+  unsigned const mp = month > 2 ? month - 3 : month + 9;         // [0, 11]
+  unsigned const doy = (153 * mp + 2) / 5 + day - 1;             // [0, 365]
+  unsigned const doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;    // [0, 146096]
+  return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+void civil_from_days(int64_t days, int64_t &year, unsigned &month, unsigned &day) {
+  days += 719468;
+  int64_t const era = (days >= 0 ? days : days - 146096) / 146097;
+  unsigned const doe = static_cast<unsigned>(days - era * 146097);             // [0, 146096]
+  unsigned const yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;  // [0, 399]
+  unsigned const doy = doe - (365 * yoe + yoe / 4 - yoe / 100);                // [0, 365]
+  unsigned const mp = (5 * doy + 2) / 153;                                     // [0, 11]
+  day = doy - (153 * mp + 2) / 5 + 1;
+  month = mp < 10 ? mp + 3 : mp - 9;
+  year = static_cast<int64_t>(yoe) + era * 400 + (month <= 2);
+}
+
+unsigned days_in_month(int64_t year, unsigned month) {
+  static unsigned const days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  bool const leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+  return month == 2 && leap ? 29 : days[month - 1];
+}
+
+}  // namespace meos
@@ -105,3 +105,12 @@ def test_accessor_functions():
     assert stbox.geodetic == False
 
     assert stbox == STBox(11, 12, 13, "2011-01-01 00:00", 21, 22, 23, "2011-01-02 00:00", srid=5676)
+
+
+def test_predicates():
+    stbox = STBox(0, 0, 10, 10)
+    assert stbox.overlaps(STBox(5, 5, 15, 15))
+    assert stbox.contains(STBox(1, 1, 2, 2))
+    assert stbox.adjacent(STBox(10, 0, 20, 10))
+    assert stbox.expand(1.0) == STBox(-1, -1, 11, 11)
+    assert stbox.union(STBox(5, -5, 20, 5)) == STBox(0, -5, 20, 10)
@@ -38,3 +38,9 @@ from ..utils import unix_dt
 def test_constructor_and_serdes(tbox, serialized):
     assert str(tbox) == serialized
     assert TBox(serialized) == tbox
+
+
+def test_hash():
+    tbox = TBox(1, unix_dt(2011, 1, 1), 2, unix_dt(2011, 1, 2))
+    assert hash(tbox) == hash(TBox(1, unix_dt(2011, 1, 1), 2, unix_dt(2011, 1, 2)))
+    assert len({tbox, TBox(1, 2)}) == 2
@@ -1,5 +1,5 @@
-from pymeos.io import (DeserializerFloat, DeserializerGeom, DeserializerInt,
-                       SerializerFloat, SerializerInt)
+from pymeos.io import (BinaryDeserializerFloat, BinarySerializerFloat, DeserializerFloat,
+                       DeserializerGeom, DeserializerInt, SerializerFloat, SerializerInt)
 from pymeos.temporal import (TFloatInst, TIntInst, TIntInstSet, TFloatSeq, TFloatSeqSet)
 
 from ..utils import unix_dt
@@ -57,3 +57,26 @@ def test_deserialization():
     tf2 = TFloatInst(2.5, unix_dt(2011, 1, 2))
     expected = TFloatSeqSet({TFloatSeq({tf1, tf2})})
     assert tseqset == expected
+
+
+def test_binary_roundtrip():
+    tf1 = TFloatInst(1.0, unix_dt(2011, 1, 1))
+    tf2 = TFloatInst(2.5, unix_dt(2011, 1, 2))
+    tseqf = TFloatSeq({tf1, tf2})
+
+    serialized = BinarySerializerFloat().write(tf1) + BinarySerializerFloat().write(tseqf)
+    assert isinstance(serialized, bytes)
+
+    df = BinaryDeserializerFloat(serialized)
+    assert df.nextTInstant() == tf1
+    assert df.nextTSequence() == tseqf
+    assert not df.hasNext()
+
+
+def test_batches():
+    serialized = ["{}@2011-01-01".format(i) for i in range(10)] + ["[1@2011-01-01, 2@2011-01-02)"]
+    for num_threads in (0, 1, 4):
+        temporals = DeserializerInt.readTemporals(serialized, num_threads)
+        assert len(temporals) == len(serialized)
+        assert temporals[3] == TIntInst(3, unix_dt(2011, 1, 1))
+        assert SerializerInt.writeTemporals(temporals, num_threads) == [SerializerInt().write(t) for t in temporals]
@@ -1,3 +1,4 @@
+import numpy as np
 import pytest
 
 from pymeos import GeomPoint
@@ -85,3 +86,17 @@ def test_str():
     tsetb = get_sample_tinstant_set()
     assert str(tsetb) == '{t@2011-01-01T00:00:00+0000, t@2011-01-02T00:00:00+0000}'
     assert repr(tsetb) == '{t@2011-01-01T00:00:00+0000, t@2011-01-02T00:00:00+0000}'
+
+
+def test_numpy():
+    timestamps = np.array(['2019-09-10', '2020-09-10'], dtype='datetime64[s]')
+    tinstset = TIntInstSet(timestamps, np.array([20, 10]))
+    assert tinstset == TIntInstSet({TIntInst(20, unix_dt(2019, 9, 10)), TIntInst(10, unix_dt(2020, 9, 10))})
+    assert tinstset.valuesArray().tolist() == [20, 10]
+    assert tinstset.timestampsArray().astype('datetime64[s]').tolist() == timestamps.tolist()
+
+    tbinstset = TBoolInstSet(timestamps, np.array([True, False]))
+    assert tbinstset.valuesArray().tolist() == [True, False]
+
+    tginstset = TGeomPointInstSet(timestamps, np.array([1, 2]), np.array([3, 4]), np.array([5, 6]))
+    assert tginstset.coordinatesArray().tolist() == [[1, 3, 5], [2, 4, 6]]
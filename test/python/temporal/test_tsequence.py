@@ -1,10 +1,14 @@
+import numpy as np
 import pytest
 
 from pymeos import GeomPoint
+from pymeos.box import TBox
 from pymeos.io import DeserializerGeom
 from pymeos.temporal import (Interpolation, TemporalDuration, TFloatInst,
-                             TGeomPointInst, TIntInst, TFloatSeq,
-                             TGeomPointSeq, TIntSeq)
+                             TGeomPointInst, TIntInst, TBoolSeq, TBoolSeqSet,
+                             TFloatSeq, TFloatSeqSet, TGeomPointSeq, TIntSeq,
+                             TIntSeqSet, TTextSeq, extent, tavg, tcount, tmax, tsum)
+from pymeos.time import Period
 
 from ..utils import unix_dt
 
@@ -154,3 +158,111 @@ def test_str():
     tseqf = TFloatSeq({TFloatInst(10, unix_dt(2020, 9, 10)), TFloatInst(20, unix_dt(2019, 9, 10))}, False, True, Interpolation.Stepwise)
     assert str(tseqf) == "Interp=Stepwise;(20@2019-09-10T00:00:00+0000, 10@2020-09-10T00:00:00+0000]"
     assert repr(tseqf) == "Interp=Stepwise;(20@2019-09-10T00:00:00+0000, 10@2020-09-10T00:00:00+0000]"
+
+
+def test_restrictions():
+    tseqf = TFloatSeq('[10@2012-01-01, 20@2012-01-03]')
+    assert tseqf.atPeriod(Period('[2012-01-02, 2012-01-04]')) == TFloatSeq('[15@2012-01-02, 20@2012-01-03]')
+    assert tseqf.atPeriod(Period('[2013-01-01, 2013-01-02]')) is None
+    assert tseqf.atTimestamp(unix_dt(2012, 1, 2)) == TFloatInst(15, unix_dt(2012, 1, 2))
+    assert tseqf.minusTimestamp(unix_dt(2012, 1, 2)) == TFloatSeqSet('{[10@2012-01-01, 15@2012-01-02), (15@2012-01-02, 20@2012-01-03]}')
+
+
+def test_bounding_box():
+    tseqf = TFloatSeq('[10@2012-01-01, 20@2012-01-03, 5@2012-01-04)')
+    assert tseqf.boundingBox == TBox(5, unix_dt(2012, 1, 1), 20, unix_dt(2012, 1, 4))
+
+
+def test_numpy():
+    timestamps = np.array(['2012-01-03', '2012-01-01', '2012-01-02'], dtype='datetime64[ns]')
+    tseqf = TFloatSeq(timestamps, np.array([30, 10, 20], dtype=np.float64), True, True)
+    assert tseqf == TFloatSeq('[10@2012-01-01, 20@2012-01-02, 30@2012-01-03]')
+
+    values = tseqf.valuesArray()
+    assert values.tolist() == [10, 20, 30]
+    assert not values.flags.writeable
+    assert not values.flags.owndata
+    assert tseqf.timestampsArray().tolist() == np.sort(timestamps).tolist()
+    del tseqf
+    assert values.tolist() == [10, 20, 30]
+
+    tseqg = TGeomPointSeq(timestamps[1:], [1.5, 2.5], [3.5, 4.5], srid=4326)
+    assert tseqg == TGeomPointSeq('SRID=4326;[Point(1.5 3.5)@2012-01-01, Point(2.5 4.5)@2012-01-02)')
+    assert tseqg.coordinatesArray().tolist() == [[1.5, 3.5], [2.5, 4.5]]
+
+    with pytest.raises(ValueError):
+        TFloatSeq(timestamps, np.array([10, 20]))
+
+
+def test_simplify():
+    tseq = TGeomPointSeq("SRID=4326;[POINT(0 0)@2012-01-01 00:00, POINT(1 0)@2012-01-01 00:01, POINT(2 0)@2012-01-01 00:09, POINT(3 0)@2012-01-01 00:10]")
+    assert len(tseq.simplify(0.5).instants) == 2
+    assert tseq.simplify(0.5, synchronized=True) == tseq
+    assert tseq.simplify(0.5).srid == 4326
+
+    tseq = TFloatSeq("[0@2012-01-01 00:00:00, 10@2012-01-01 00:00:10, 21@2012-01-01 00:00:20, 30@2012-01-01 00:00:30]")
+    assert len(tseq.simplify(0.5).instants) == 3
+    assert len(tseq.simplifyMaxSpeed(0.2).instants) == 2
+
+
+def test_trajectory_functions():
+    tseq = TGeomPointSeq("[POINT(0 0)@2012-01-01 00:00, POINT(3 4)@2012-01-01 00:01, POINT(3 4)@2012-01-01 00:02, POINT(3 0)@2012-01-01 00:03]")
+    assert tseq.length() == 9
+    assert tseq.cumulativeLength() == TFloatSeq("[0@2012-01-01 00:00, 5@2012-01-01 00:01, 5@2012-01-01 00:02, 9@2012-01-01 00:03]")
+    assert tseq.speed().interpolation == Interpolation.Stepwise
+    assert tseq.speed().valueAtTimestamp(unix_dt(2012, 1, 1, 0, 0, 30)) == pytest.approx(5 / 60)
+    assert len(tseq.azimuth().sequences) == 2
+    assert TGeomPointSeq("[POINT(0 0)@2012-01-01]").speed() is None
+    assert TGeomPointSeq("[POINT(1 1)@2012-01-01, POINT(1 1)@2012-01-02]").azimuth() is None
+
+
+def test_arithmetic():
+    lhs = TFloatSeq("[0@2012-01-01, 10@2012-01-03]")
+    rhs = TFloatSeq("[10@2012-01-02, 20@2012-01-04]")
+    assert lhs + rhs == TFloatSeq("[15@2012-01-02, 25@2012-01-03]")
+    assert lhs - 1 == TFloatSeq("[-1@2012-01-01, 9@2012-01-03]")
+    assert 2 * lhs == TFloatSeq("[0@2012-01-01, 20@2012-01-03]")
+    assert (lhs / rhs).valueAtTimestamp(unix_dt(2012, 1, 2)) == 0.5
+    assert lhs + TFloatSeq("[1@2013-01-01, 2@2013-01-02]") is None
+    assert TIntSeq("[7@2012-01-01, 9@2012-01-02]") / 2 == TIntSeq("[3@2012-01-01, 4@2012-01-02]")
+    with pytest.raises(ValueError):
+        lhs / 0
+
+
+def test_comparisons():
+    seq = TFloatSeq("[0@2012-01-01, 10@2012-01-03]")
+    assert seq.tlt(5) == TBoolSeq("Interp=Stepwise;[t@2012-01-01, f@2012-01-02, f@2012-01-03]")
+    assert seq.tge(5) == TBoolSeq("Interp=Stepwise;[f@2012-01-01, t@2012-01-02, t@2012-01-03]")
+    assert seq.tgt(TFloatSeq("[10@2012-01-01, 0@2012-01-03]")) == TBoolSeqSet(
+        "Interp=Stepwise;{[f@2012-01-01, f@2012-01-02], (t@2012-01-02, t@2012-01-03]}"
+    )
+    assert seq.tlt(20) == TBoolSeq("Interp=Stepwise;[t@2012-01-01, t@2012-01-03]")
+    assert TTextSeq("[a@2012-01-01, b@2012-01-02]").teq("b") == TBoolSeq(
+        "Interp=Stepwise;[f@2012-01-01, t@2012-01-02]"
+    )
+
+
+def test_aggregates():
+    a = TFloatSeq("[0@2012-01-01, 10@2012-01-03]")
+    b = TFloatSeq("[10@2012-01-01, 0@2012-01-03]")
+    assert tmax([a, b]) == TFloatSeq("[10@2012-01-01, 5@2012-01-02, 10@2012-01-03]")
+    assert tsum([a, b], num_threads=2) == TFloatSeq("[10@2012-01-01, 10@2012-01-03]")
+    assert tavg([a, b]) == TFloatSeq("[5@2012-01-01, 5@2012-01-03]")
+    assert tcount([a, TFloatSeq("[1@2012-01-02, 1@2012-01-04)")]) == TIntSeqSet(
+        "{[1@2012-01-01, 2@2012-01-02, 2@2012-01-03], (1@2012-01-03, 1@2012-01-04)}"
+    )
+    ints = [TIntSeq("[1@2012-01-01, 2@2012-01-02]"), TIntSeq("[3@2012-01-01, 3@2012-01-02]")]
+    assert tsum(ints) == TIntSeq("[4@2012-01-01, 5@2012-01-02]")
+    assert extent([a, b]) == TBox(0, unix_dt(2012, 1, 1), 10, unix_dt(2012, 1, 3))
+    with pytest.raises(ValueError):
+        extent([])
+
+
+def test_time_weighted_average():
+    tseq = TFloatSeq("[0@2012-01-01 00:00, 10@2012-01-01 00:01, 10@2012-01-01 00:03]")
+    assert tseq.integral() == pytest.approx(1500)
+    assert tseq.twAvg() == pytest.approx(1500 / 180)
+    assert TIntSeq("[1@2012-01-01, 3@2012-01-02, 3@2012-01-04)").twAvg() == pytest.approx(7 / 3)
+
+    tseq = TGeomPointSeq("SRID=4326;[POINT(0 0)@2012-01-01, POINT(2 4)@2012-01-02]")
+    assert tseq.twCentroid() == GeomPoint(1, 2, 4326)
@@ -1,3 +1,4 @@
+import numpy as np
 import pytest
 
 from pymeos import GeomPoint
@@ -222,3 +223,46 @@ def test_str():
     tseqset = TFloatSeqSet({"Interp=Stepwise;[10@2011-01-01, 40@2011-01-02)", "Interp=Stepwise;[20@2011-01-03, 30@2011-01-04)"}, Interpolation.Stepwise)
     assert str(tseqset) == "Interp=Stepwise;{[10@2011-01-01T00:00:00+0000, 40@2011-01-02T00:00:00+0000), [20@2011-01-03T00:00:00+0000, 30@2011-01-04T00:00:00+0000)}"
     assert repr(tseqset) == "Interp=Stepwise;{[10@2011-01-01T00:00:00+0000, 40@2011-01-02T00:00:00+0000), [20@2011-01-03T00:00:00+0000, 30@2011-01-04T00:00:00+0000)}"
+
+
+def test_numpy():
+    timestamps = np.array(['2012-01-01', '2012-01-02', '2012-01-05', '2012-01-06'], dtype='datetime64[ns]')
+    starts = np.array([0, 2])
+    tseqsetf = TFloatSeqSet(timestamps, np.array([1, 2, 3, 4]), starts, True, True)
+    assert tseqsetf == TFloatSeqSet('{[1@2012-01-01, 2@2012-01-02], [3@2012-01-05, 4@2012-01-06]}')
+    assert tseqsetf.timestampsArray().tolist() == timestamps.tolist()
+    assert tseqsetf.valuesArray().tolist() == [1, 2, 3, 4]
+    assert tseqsetf.sequenceStartsArray().tolist() == [0, 2]
+
+    tseqsetg = TGeomPointSeqSet(timestamps, [1, 2, 3, 4], [5, 6, 7, 8], starts, srid=4326, upper_inc=True)
+    assert tseqsetg.srid == 4326
+    assert tseqsetg.coordinatesArray()[:, 1].tolist() == [5, 6, 7, 8]
+
+    with pytest.raises(ValueError):
+        TFloatSeqSet(timestamps, np.array([1, 2, 3, 4]), np.array([1, 2]))
+
+
+def test_hash():
+    tseqset = TFloatSeqSet("{[1.0@2011-01-01, 2.5@2011-01-02), [3@2011-01-03]}")
+    same = TFloatSeqSet({"[3@2011-01-03]", "[1.0@2011-01-01, 2.5@2011-01-02)"})
+    assert hash(tseqset) == hash(same)
+    assert len({tseqset, same, TFloatSeqSet("{[3@2011-01-03]}")}) == 2
+
+
+def test_trajectory_functions():
+    tseqset = TGeomPointSeqSet("{[POINT(0 0)@2012-01-01 00:00, POINT(3 4)@2012-01-01 00:01], [POINT(3 4)@2012-01-01 00:02, POINT(3 0)@2012-01-01 00:03]}")
+    assert tseqset.length() == 9
+    assert tseqset.cumulativeLength() == TFloatSeqSet({"[0@2012-01-01 00:00, 5@2012-01-01 00:01]", "[5@2012-01-01 00:02, 9@2012-01-01 00:03]"})
+    assert len(tseqset.speed().sequences) == 2
+    assert len(tseqset.azimuth().sequences) == 2
+
+
+def test_time_weighted_average():
+    tseqset = TFloatSeqSet("{[0@2012-01-01, 10@2012-01-02], [20@2012-01-05, 20@2012-01-06]}")
+    assert tseqset.integral() == pytest.approx(25 * 86400)
+    assert tseqset.twAvg() == pytest.approx(12.5)
+
+    tseqset = TGeomPointSeqSet("{[POINT(0 0)@2012-01-01, POINT(2 0)@2012-01-02], [POINT(4 4)@2012-01-03, POINT(4 4)@2012-01-05]}")
+    centroid = tseqset.twCentroid()
+    assert centroid.x == pytest.approx(3)
+    assert centroid.y == pytest.approx(8 / 3)
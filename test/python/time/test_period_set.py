@@ -33,3 +33,27 @@ def test_constructor():
     assert period_set.startPeriod == period_1
     assert period_set.endPeriod == period_2
     assert period_set.period == Period(unix_dt(2011, 1, 1), unix_dt(2011, 1, 6), True, True)
+
+
+def test_normalization():
+    period_set = PeriodSet(
+        "{[2011-01-01, 2011-01-03), [2011-01-02, 2011-01-04), [2011-01-05, 2011-01-06]}")
+    assert period_set.numPeriods == 2
+    assert period_set.startPeriod == Period(unix_dt(2011, 1, 1), unix_dt(2011, 1, 4))
+    assert period_set.contains_timestamp(unix_dt(2011, 1, 3)) == True
+    assert period_set.contains_timestamp(unix_dt(2011, 1, 4)) == False
+    assert period_set.overlap(Period(unix_dt(2011, 1, 4), unix_dt(2011, 1, 5))) == False
+
+
+def test_set_operations():
+    lhs = PeriodSet("{[2011-01-01, 2011-01-03), [2011-01-05, 2011-01-07]}")
+    rhs = PeriodSet("{[2011-01-02, 2011-01-05), (2011-01-07, 2011-01-08]}")
+    assert lhs.union(rhs) == PeriodSet("{[2011-01-01, 2011-01-08]}")
+    assert lhs.intersection(rhs) == PeriodSet("{[2011-01-02, 2011-01-03)}")
+    assert lhs.minus(rhs) == PeriodSet("{[2011-01-01, 2011-01-02), [2011-01-05, 2011-01-07]}")
+
+
+def test_hash():
+    period_set = PeriodSet({get_sample_period()})
+    assert hash(period_set) == hash(PeriodSet("{[2011-01-01, 2011-01-02)}"))
+    assert len({period_set, PeriodSet({get_sample_period()})}) == 1
@@ -1,6 +1,6 @@
 import pytest
 
-from pymeos.time import Period, TimestampSet
+from pymeos.time import Period, PeriodSet, TimestampSet
 
 from ..utils import unix_dt
 
@@ -35,3 +35,30 @@ def test_constructor():
     assert tset.endPeriod == Period(t2, t2, True, True)
     assert tset.periodN(0) == Period(t1, t1, True, True)
     assert tset.periodN(1) == Period(t2, t2, True, True)
+
+
+def test_lookups():
+    tset = TimestampSet({unix_dt(2011, 1, 1), unix_dt(2011, 1, 3), unix_dt(2011, 1, 5)})
+
+    assert tset.contains_timestamp(unix_dt(2011, 1, 3))
+    assert not tset.contains_timestamp(unix_dt(2011, 1, 4))
+    assert tset.contains_timestamps([unix_dt(2011, 1, 1), unix_dt(2011, 1, 2)]) == [True, False]
+    assert tset.contains_any([unix_dt(2011, 1, 2), unix_dt(2011, 1, 5)])
+    assert not tset.contains_any([unix_dt(2011, 1, 2), unix_dt(2011, 1, 4)])
+    assert tset.overlap(Period(unix_dt(2011, 1, 2), unix_dt(2011, 1, 3), True, True))
+    assert not tset.overlap(Period(unix_dt(2011, 1, 2), unix_dt(2011, 1, 3), True, False))
+
+
+def test_set_operations():
+    t1, t2, t3 = unix_dt(2011, 1, 1), unix_dt(2011, 1, 3), unix_dt(2011, 1, 5)
+    tset = TimestampSet({t1, t2, t3})
+    other = TimestampSet({t2, unix_dt(2011, 1, 7)})
+    period = Period(unix_dt(2011, 1, 2), unix_dt(2011, 1, 4))
+
+    assert tset.union(other) == TimestampSet({t1, t2, t3, unix_dt(2011, 1, 7)})
+    assert tset.intersection(other) == TimestampSet({t2})
+    assert tset.minus(other) == TimestampSet({t1, t3})
+
+    assert tset.intersection(period) == TimestampSet({t2})
+    assert tset.minus(PeriodSet({period})) == TimestampSet({t1, t3})
+    assert tset.union(period).numPeriods == 3
@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <meos/index/RTree.hpp>
+#include <random>
+#include <vector>
+
+#include "../common/time_utils.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+time_t const hour = 60 * 60 * 1000L;
+
+vector<STBox> random_boxes(size_t n, mt19937 &gen) {
+  uniform_real_distribution<double> coordinate(0, 1000);
+  uniform_real_distribution<double> extent(0, 20);
+  uniform_int_distribution<int> start(0, 24 * 30);
+  uniform_int_distribution<int> span(0, 48);
+  vector<STBox> boxes;
+  for (size_t i = 0; i < n; i++) {
+    double const x = coordinate(gen), y = coordinate(gen);
+    time_point const t = unix_time_point(2020, 1, 1) + duration_ms(start(gen) * hour);
+    boxes.push_back(STBox(x, y, t, x + extent(gen), y + extent(gen),
+                          t + duration_ms(span(gen) * hour)));
+  }
+  return boxes;
+}
+
+double distance(STBox const &a, STBox const &b) {
+  double const dx = max(0.0, max(a.xmin(), b.xmin()) - min(a.xmax(), b.xmax()));
+  double const dy = max(0.0, max(a.ymin(), b.ymin()) - min(a.ymax(), b.ymax()));
+  return sqrt(dx * dx + dy * dy);
+}
+
+}  // namespace
+
+TEST_CASE("RTree queries match a linear scan", "[rtree]") {
+  mt19937 gen(42);
+  vector<STBox> boxes = random_boxes(2000, gen);
+  size_t const capacity = GENERATE(2, 4, 16);
+  RTree tree(boxes, capacity);
+  REQUIRE(tree.size() == boxes.size());
+
+  SECTION("window") {
+    for (STBox const &query : random_boxes(50, gen)) {
+      STBox const window = query.expand(30.0).expand(duration_ms(24 * hour));
+      vector<size_t> expected;
+      for (size_t i = 0; i < boxes.size(); i++) {
+        if (boxes[i].overlaps(window)) expected.push_back(i);
+      }
+      vector<size_t> actual = tree.window(window);
+      sort(actual.begin(), actual.end());
+      REQUIRE(actual == expected);
+    }
+
+    // Spatial only, and temporal only windows
+    REQUIRE(tree.window(STBox(-1, -1, 2000, 2000)).size() == boxes.size());
+    REQUIRE(tree.window(STBox(unix_time_point(2019, 1, 1), unix_time_point(2019, 2, 1))).empty());
+  }
+
+  SECTION("nearest") {
+    for (STBox const &query : random_boxes(20, gen)) {
+      vector<double> expected;
+      for (STBox const &box : boxes) {
+        if (box.tmax() >= query.tmin() && query.tmax() >= box.tmin()) {
+          expected.push_back(distance(box, query));
+        }
+      }
+      sort(expected.begin(), expected.end());
+
+      // Boxes not overlapping the query in time are never returned
+      vector<size_t> actual = tree.nearest(query, 10);
+      REQUIRE(actual.size() == min<size_t>(10, expected.size()));
+      for (size_t i = 0; i < actual.size(); i++) {
+        REQUIRE(distance(boxes[actual[i]], query) == expected[i]);
+      }
+    }
+    REQUIRE_THROWS_AS(
+        tree.nearest(STBox(unix_time_point(2020, 1, 1), unix_time_point(2020, 1, 2)), 1),
+        invalid_argument);
+  }
+
+  SECTION("join") {
+    vector<STBox> others = random_boxes(300, gen);
+    RTree other(others, 8);
+    vector<pair<size_t, size_t>> expected;
+    for (size_t i = 0; i < boxes.size(); i++) {
+      for (size_t j = 0; j < others.size(); j++) {
+        if (boxes[i].overlaps(others[j])) expected.emplace_back(i, j);
+      }
+    }
+    vector<pair<size_t, size_t>> actual = tree.join(other);
+    sort(actual.begin(), actual.end());
+    REQUIRE(actual == expected);
+  }
+}
+
+TEST_CASE("RTree edge cases", "[rtree]") {
+  SECTION("empty tree") {
+    RTree tree({});
+    REQUIRE(tree.size() == 0);
+    REQUIRE(tree.window(STBox(0.0, 0.0, 1, 1)).empty());
+    REQUIRE(tree.nearest(STBox(0.0, 0.0, 1, 1), 3).empty());
+    REQUIRE(tree.join(tree).empty());
+  }
+
+  SECTION("fewer boxes than asked for") {
+    RTree tree({STBox(0.0, 0.0, 1, 1), STBox(5, 5, 6, 6)});
+    REQUIRE(tree.nearest(STBox(4, 4, 4, 4), 3) == vector<size_t>{1, 0});
+  }
+
+  SECTION("bad capacity") { REQUIRE_THROWS_AS(RTree({}, 1), invalid_argument); }
+}
@@ -0,0 +1,48 @@
+#include <catch2/catch.hpp>
+#include <meos/io/Serializer.hpp>
+#include <meos/io/batch.hpp>
+#include <string>
+#include <vector>
+
+using namespace meos;
+using namespace std;
+
+TEST_CASE("temporals are read and written in batches", "[batch]") {
+  size_t const num_threads = GENERATE(0, 1, 4);
+  vector<string> serialized;
+  for (int i = 0; i < 100; i++) {
+    string const value = to_string(i);
+    switch (i % 4) {
+      case 0:
+        serialized.push_back(value + "@2012-01-01T00:00:00+0000");
+        break;
+      case 1:
+        serialized.push_back("{" + value + "@2012-01-01T00:00:00+0000, " + value
+                             + "@2012-01-02T00:00:00+0000}");
+        break;
+      case 2:
+        serialized.push_back("[" + value
+                             + "@2012-01-01T00:00:00+0000, 0@2012-01-02T00:00:00+0000)");
+        break;
+      default:
+        serialized.push_back("{[" + value + "@2012-01-01T00:00:00+0000], [" + value
+                             + "@2012-01-03T00:00:00+0000]}");
+    }
+  }
+
+  vector<unique_ptr<Temporal<int>>> temporals = read_temporals<int>(serialized, num_threads);
+  REQUIRE(temporals.size() == serialized.size());
+  vector<Temporal<int> const *> pointers;
+  for (size_t i = 0; i < temporals.size(); i++) {
+    REQUIRE(temporals[i]->maxValue() == static_cast<int>(i));
+    pointers.push_back(temporals[i].get());
+  }
+
+  REQUIRE(write_temporals<int>(pointers, num_threads) == serialized);
+}
+
+TEST_CASE("errors while reading batches are thrown", "[batch]") {
+  vector<string> serialized(10, "1@2012-01-01");
+  serialized[7] = "1@";
+  CHECK_THROWS(read_temporals<int>(serialized, 4));
+}
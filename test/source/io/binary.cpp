@@ -0,0 +1,260 @@
+#include <catch2/catch.hpp>
+#include <meos/io/BinaryDeserializer.hpp>
+#include <meos/io/BinarySerializer.hpp>
+#include <meos/io/DeserializationException.hpp>
+#include <string>
+
+#include "../common/time_utils.hpp"
+
+using namespace meos;
+using namespace std;
+
+namespace {
+
+string from_hex(string const &hex) {
+  string bytes;
+  for (size_t i = 0; i < hex.size(); i += 2) {
+    bytes.push_back(static_cast<char>(stoi(hex.substr(i, 2), nullptr, 16)));
+  }
+  return bytes;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("temporals roundtrip through the binary format",
+                   "[serializer][deserializer][binary]", int, float) {
+  BinarySerializer<TestType> w;
+
+  SECTION("TInstant") {
+    TInstant<TestType> instant(10, unix_time_point(2012, 11, 1, 12, 30, 15, 123));
+    BinaryDeserializer<TestType> r(w.write(&instant));
+    REQUIRE(*r.nextTInstant() == instant);
+    REQUIRE_FALSE(r.hasNext());
+  }
+
+  SECTION("TInstantSet") {
+    TInstantSet<TestType> instant_set(
+        {unix_time_point(2012, 11, 1), unix_time_point(2012, 11, 2), unix_time_point(2012, 11, 3)},
+        {10, -20, 30});
+    BinaryDeserializer<TestType> r(w.write(&instant_set));
+    REQUIRE(*r.nextTInstantSet() == instant_set);
+  }
+
+  SECTION("TSequence") {
+    TSequence<TestType> sequence({unix_time_point(2012, 11, 1), unix_time_point(2012, 11, 2)},
+                                 {10, 20}, false, true);
+    BinaryDeserializer<TestType> r(w.write(&sequence));
+    auto actual = r.nextTSequence();
+    REQUIRE(*actual == sequence);
+    REQUIRE(actual->lower_inc() == false);
+    REQUIRE(actual->upper_inc() == true);
+    REQUIRE(actual->interpolation() == sequence.interpolation());
+  }
+
+  SECTION("TSequenceSet") {
+    TSequenceSet<TestType> sequence_set(set<TSequence<TestType>>{
+        TSequence<TestType>({unix_time_point(2012, 11, 1), unix_time_point(2012, 11, 2)}, {1, 2}),
+        TSequence<TestType>({unix_time_point(2012, 11, 3), unix_time_point(2012, 11, 4),
+                             unix_time_point(2012, 11, 5)},
+                            {3, 4, 5}, true, true),
+    });
+    BinaryDeserializer<TestType> r(w.write(&sequence_set));
+    auto actual = r.nextTSequenceSet();
+    REQUIRE(*actual == sequence_set);
+    REQUIRE(actual->interpolation() == sequence_set.interpolation());
+  }
+
+  SECTION("multiple temporals one after the other") {
+    TInstant<TestType> instant(10, unix_time_point(2012, 11, 1));
+    TSequence<TestType> sequence({unix_time_point(2012, 11, 1), unix_time_point(2012, 11, 2)},
+                                 {10, 20});
+    BinaryDeserializer<TestType> r(w.write(&instant) + w.write(&sequence));
+    unique_ptr<Temporal<TestType>> first = r.nextTemporal();
+    unique_ptr<Temporal<TestType>> second = r.nextTemporal();
+    REQUIRE(first->duration() == TemporalDuration::Instant);
+    REQUIRE(second->duration() == TemporalDuration::Sequence);
+    REQUIRE(*static_cast<TInstant<TestType> *>(first.get()) == instant);
+    REQUIRE(*static_cast<TSequence<TestType> *>(second.get()) == sequence);
+    REQUIRE_FALSE(r.hasNext());
+  }
+
+  SECTION("truncated input is rejected") {
+    TSequence<TestType> sequence({unix_time_point(2012, 11, 1), unix_time_point(2012, 11, 2)},
+                                 {10, 20});
+    string serialized = w.write(&sequence);
+    size_t length = GENERATE(0, 1, 5, 10);
+    BinaryDeserializer<TestType> r(serialized.substr(0, serialized.size() - length - 1));
+    REQUIRE_THROWS_AS(r.nextTSequence(), DeserializationException);
+  }
+
+  SECTION("unexpected duration is rejected") {
+    TInstant<TestType> instant(10, unix_time_point(2012, 11, 1));
+    BinaryDeserializer<TestType> r(w.write(&instant));
+    REQUIRE_THROWS_AS(r.nextTSequence(), DeserializationException);
+  }
+}
+
+TEST_CASE("values are written in network byte order", "[serializer][binary]") {
+  REQUIRE(BinarySerializer<int>().write(0x01020304) == string("\x01\x02\x03\x04", 4));
+  REQUIRE(BinarySerializer<float>().write(1) == string("\x3f\xf0\0\0\0\0\0\0", 8));
+  REQUIRE(BinarySerializer<int>().writeTime(unix_time_point(2000, 1, 1, 0, 0, 1))
+          == string("\0\0\0\0\0\x0f\x42\x40", 8));
+}
+
+// Bytes of the send functions of MobilityDB 1.0 for the same values, e.g.
+// encode(tint_send('10@2000-01-01 00:00:01+00'), 'hex')
+TEST_CASE("values are written as MobilityDB sends them", "[serializer][deserializer][binary]") {
+  time_point const t0 = unix_time_point(2000, 1, 1);
+  time_point const t1 = unix_time_point(2000, 1, 1, 0, 0, 1);
+  time_point const t2 = unix_time_point(2000, 1, 2);
+
+  SECTION("tint instant") {
+    TInstant<int> instant(10, t1);
+    string const bytes = from_hex("01" "00000000000f4240" "00000004" "0000000a");
+    REQUIRE(BinarySerializer<int>().write(&instant) == bytes);
+    REQUIRE(*BinaryDeserializer<int>(bytes).nextTInstant() == instant);
+  }
+
+  SECTION("tfloat sequence") {
+    TSequence<float> sequence({t0, t2}, {1.5, 2.5}, true, false, Interpolation::Linear);
+    string const bytes = from_hex(
+        "03" "00000002" "01" "00" "01"
+        "0000000000000000" "00000008" "3ff8000000000000"
+        "000000141dd76000" "00000008" "4004000000000000");
+    REQUIRE(BinarySerializer<float>().write(&sequence) == bytes);
+    REQUIRE(*BinaryDeserializer<float>(bytes).nextTSequence() == sequence);
+  }
+
+  SECTION("tbool sequence set") {
+    TSequenceSet<bool> sequence_set(
+        set<TSequence<bool>>{TSequence<bool>({t0, t2}, {true, false}, true, true)});
+    string const bytes = from_hex(
+        "04" "00000001"
+        "00000002" "01" "01" "00"
+        "0000000000000000" "00000001" "01"
+        "000000141dd76000" "00000001" "00");
+    REQUIRE(BinarySerializer<bool>().write(&sequence_set) == bytes);
+    REQUIRE(*BinaryDeserializer<bool>(bytes).nextTSequenceSet() == sequence_set);
+  }
+
+  SECTION("ttext instant set") {
+    TInstantSet<string> instant_set({t0, t1}, {"abc", ""});
+    string const bytes = from_hex(
+        "02" "00000002"
+        "0000000000000000" "00000003" "616263"
+        "00000000000f4240" "00000000");
+    REQUIRE(BinarySerializer<string>().write(&instant_set) == bytes);
+    REQUIRE(*BinaryDeserializer<string>(bytes).nextTInstantSet() == instant_set);
+  }
+
+  SECTION("tgeompoint instant") {
+    TInstant<GeomPoint> instant(GeomPoint(1, 2, 4326), t0);
+    string const bytes = from_hex(
+        "01" "0000000000000000" "00000019"
+        "01" "01000020" "e6100000" "000000000000f03f" "0000000000000040");
+    REQUIRE(BinarySerializer<GeomPoint>().write(&instant) == bytes);
+    auto actual = BinaryDeserializer<GeomPoint>(bytes).nextTInstant();
+    REQUIRE(*actual == instant);
+    REQUIRE(actual->getValue().srid() == 4326);
+  }
+
+  SECTION("period and timestamp set") {
+    Period period(t1, t2, true, false);
+    string const period_bytes = from_hex("00000000000f4240" "000000141dd76000" "01" "00");
+    REQUIRE(BinarySerializer<>().write(&period) == period_bytes);
+    REQUIRE(*BinaryDeserializer<>(period_bytes).nextPeriod() == period);
+
+    TimestampSet timestamp_set(set<time_point>{unix_time_point(1999, 12, 31, 23, 59, 59), t1});
+    string const set_bytes = from_hex("00000002" "fffffffffff0bdc0" "00000000000f4240");
+    REQUIRE(BinarySerializer<>().write(&timestamp_set) == set_bytes);
+    REQUIRE(*BinaryDeserializer<>(set_bytes).nextTimestampSet() == timestamp_set);
+  }
+
+  SECTION("values that don't take their length are rejected") {
+    string const bytes = from_hex("01" "00000000000f4240" "00000005" "0000000a" "00");
+    REQUIRE_THROWS_AS(BinaryDeserializer<int>(bytes).nextTInstant(), DeserializationException);
+  }
+}
+
+TEST_CASE("text and geometry temporals roundtrip through the binary format",
+          "[serializer][deserializer][binary]") {
+  SECTION("text") {
+    TInstantSet<string> instant_set({unix_time_point(2012, 11, 1), unix_time_point(2012, 11, 2)},
+                                    {"", string("with \0 and \"quotes\"", 19)});
+    BinaryDeserializer<string> r(BinarySerializer<string>().write(&instant_set));
+    REQUIRE(*r.nextTInstantSet() == instant_set);
+  }
+
+  SECTION("bool") {
+    TSequence<bool> sequence({unix_time_point(2012, 11, 1), unix_time_point(2012, 11, 2)},
+                             {true, false});
+    BinaryDeserializer<bool> r(BinarySerializer<bool>().write(&sequence));
+    REQUIRE(*r.nextTSequence() == sequence);
+  }
+
+  SECTION("geometry") {
+    TSequence<GeomPoint> sequence({unix_time_point(2012, 11, 1), unix_time_point(2012, 11, 2)},
+                                  {GeomPoint(1.5, 2.5, 4326), GeomPoint(-3, 4.25, 4326)});
+    BinaryDeserializer<GeomPoint> r(BinarySerializer<GeomPoint>().write(&sequence));
+    auto actual = r.nextTSequence();
+    REQUIRE(*actual == sequence);
+    REQUIRE(actual->srid() == 4326);
+  }
+
+  SECTION("3D geometry") {
+    TInstant<GeomPoint> instant(GeomPoint(1, 2, 3, 0), unix_time_point(2012, 11, 1));
+    BinaryDeserializer<GeomPoint> r(BinarySerializer<GeomPoint>().write(&instant));
+    GeomPoint value = r.nextTInstant()->getValue();
+    REQUIRE(value.has_z());
+    REQUIRE(value.z() == 3);
+    REQUIRE(value.srid() == 0);
+  }
+}
+
+TEST_CASE("time types and boxes roundtrip through the binary format",
+          "[serializer][deserializer][binary]") {
+  BinarySerializer<> w;
+
+  SECTION("Period") {
+    Period period(unix_time_point(2012, 11, 1), unix_time_point(2012, 11, 2), false, true);
+    BinaryDeserializer<> r(w.write(&period));
+    REQUIRE(*r.nextPeriod() == period);
+  }
+
+  SECTION("PeriodSet") {
+    PeriodSet period_set(set<Period>{
+        Period(unix_time_point(2012, 11, 1), unix_time_point(2012, 11, 2)),
+        Period(unix_time_point(2012, 11, 3), unix_time_point(2012, 11, 4), true, true),
+    });
+    BinaryDeserializer<> r(w.write(&period_set));
+    REQUIRE(*r.nextPeriodSet() == period_set);
+  }
+
+  SECTION("TimestampSet") {
+    set<time_point> timestamps = {unix_time_point(1999, 12, 31, 23, 59, 59, 999),
+                                  unix_time_point(2012, 11, 1)};
+    TimestampSet timestamp_set(timestamps);
+    BinaryDeserializer<> r(w.write(&timestamp_set));
+    REQUIRE(*r.nextTimestampSet() == timestamp_set);
+  }
+
+  SECTION("TBox") {
+    time_point tmin = unix_time_point(2012, 11, 1), tmax = unix_time_point(2012, 11, 2);
+    TBox tbox = GENERATE_COPY(TBox(), TBox(1, 2), TBox(tmin, tmax), TBox(1, tmin, 2, tmax));
+    BinaryDeserializer<> r(w.write(&tbox));
+    REQUIRE(*r.nextTBox() == tbox);
+  }
+
+  SECTION("STBox") {
+    time_point tmin = unix_time_point(2012, 11, 1), tmax = unix_time_point(2012, 11, 2);
+    STBox stbox = GENERATE_COPY(STBox(), STBox(1, 2, 3, 4, 5, 6, 4326),
+                                STBox(1, 2, 3, tmin, 4, 5, 6, tmax, 4326, true),
+                                STBox(1, 2, tmin, 3, 4, tmax), STBox(1, 2, 3, 4, 5432),
+                                STBox(tmin, tmax, 0, true));
+    BinaryDeserializer<> r(w.write(&stbox));
+    auto actual = r.nextSTBox();
+    REQUIRE(*actual == stbox);
+    REQUIRE(actual->srid() == stbox.srid());
+    REQUIRE(actual->geodetic() == stbox.geodetic());
+  }
+}
@@ -14,13 +14,13 @@ TEST_CASE("geometries are serialized", "[serializer][geom]") {
 
   SECTION("Without SRID") {
     GeomPoint g(x, y);
-    REQUIRE(g.geom != nullptr);
+    REQUIRE(g.geom() != nullptr);
     REQUIRE(w.write(g) == wkt);
   }
 
   SECTION("With SRID") {
     GeomPoint g(x, y, 4326);
-    REQUIRE(g.geom != nullptr);
+    REQUIRE(g.geom() != nullptr);
     REQUIRE(w.write(g) == "SRID=4326;" + wkt);
   }
 }
@@ -81,8 +81,8 @@ TEST_CASE("geometries are deserialized", "[deserializer][geom]") {
     CHECK_THROWS(r.nextValue());
   }
 
-  GEOSGeomGetX_r(geos_context, g.geom, &x);
-  GEOSGeomGetY_r(geos_context, g.geom, &y);
+  GEOSGeomGetX_r(geos_context(), g.geom().get(), &x);
+  GEOSGeomGetY_r(geos_context(), g.geom().get(), &y);
   REQUIRE(x == expectedX);
   REQUIRE(y == expectedY);
   REQUIRE(g.srid() == expected_srid);
@@ -101,10 +101,10 @@ TEST_CASE("geometry serdes", "[serializer][deserializer][geom]") {
     Deserializer<GeomPoint> r(serialized);
 
     g = r.nextValue();
-    REQUIRE(g.geom != nullptr);
+    REQUIRE(g.geom() != nullptr);
     double x, y;
-    GEOSGeomGetX_r(geos_context, g.geom, &x);
-    GEOSGeomGetY_r(geos_context, g.geom, &y);
+    GEOSGeomGetX_r(geos_context(), g.geom().get(), &x);
+    GEOSGeomGetY_r(geos_context(), g.geom().get(), &y);
     REQUIRE(x == expectedX);
     REQUIRE(y == expectedY);
   }
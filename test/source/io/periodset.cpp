@@ -72,8 +72,11 @@ TEST_CASE("PeriodSets are serialized", "[serializer][periodset]") {
     set<string> expected;
     set<unique_ptr<Period>> periods;
 
+    // Each period starts after the previous one ends, as overlapping ones would be merged
+    long start = 0;
     for (size_t i = 0; i < size; i++) {
-      long lbound = GENERATE(0L, unix_time(2012, 1, 1), take(4, random(0L, 4102488000000L)));
+      long lbound = max(start, GENERATE(0L, unix_time(2012, 1, 1),
+                                        take(4, random(0L, 4102488000000L))));
       long duration = GENERATE(take(4, random(0L, 10 * 365 * millis_in_day)));
       auto rbound = lbound + duration;  // This is to make sure lbound <= rbound
       auto period = make_unique<Period>(std::chrono::system_clock::from_time_t(lbound / 1000L),
@@ -82,6 +85,7 @@ TEST_CASE("PeriodSets are serialized", "[serializer][periodset]") {
       expected.insert(w.write(period.get()));
 
       periods.insert(move(period));
+      start = rbound + millis_in_day;
     }
 
     PeriodSet period_set(periods);
@@ -119,8 +123,8 @@ TEST_CASE("PeriodSets are deserialized", "[deserializer][periodset]") {
 
       unique_ptr<PeriodSet> period_set = r.nextPeriodSet();
       set<Period> actual = period_set->periods();
+      // The two overlap, and are merged together
       set<Period> expected = {
-          Period(unix_time_point(2012, 1, 1), unix_time_point(2012, 4, 1), false, false),
           Period(unix_time_point(2012, 1, 1), unix_time_point(2012, 4, 1), true, false),
       };
       auto x = UnorderedEquals(expected);
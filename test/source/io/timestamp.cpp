@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 #include <meos/io/Deserializer.hpp>
+#include <meos/io/utils.hpp>
 #include <meos/util/serializing.hpp>
 #include <string>
 
@@ -31,11 +32,27 @@ TEST_CASE("timestamps are deserialized", "[deserializer][timestamp]") {
         {"2012-11-02 00:00:00-01", unix_time_point(2012, 11, 2, 1)},
         {"2012-11-02 00:00:00-0100", unix_time_point(2012, 11, 2, 1)},
         {"2012-11-02 00:00:00-0130", unix_time_point(2012, 11, 2, 1, 30)},
+        {"2012-11-02 00:00:00-01:30", unix_time_point(2012, 11, 2, 1, 30)},
+        {"2012-11-02T01:44:32Z", unix_time_point(2012, 11, 2, 1, 44, 32)},
+        {"2012-11-02T01:44:32.7Z", unix_time_point(2012, 11, 2, 1, 44, 32, 700)},
+        {"2012-11-02T01:44:32.789123", unix_time_point(2012, 11, 2, 1, 44, 32, 789)},
+        {"2012-11-02 01:44", unix_time_point(2012, 11, 2, 1, 44)},
+        {"2012-02-29", unix_time_point(2012, 2, 29)},
+        {"1969-12-31 23:59:59.5", unix_time_point(1970) - duration_ms(500)},
+        {"  2012-11-02  ", unix_time_point(2012, 11, 2)},
     }));
     Deserializer<int> r(s);
     REQUIRE(r.nextTime() == expected);
   }
 
+  SECTION("invalid timestamps are rejected") {
+    string s = GENERATE("2012-13-01", "2012-00-01", "2011-02-29", "2012-11-31", "2012-11-02 24:00",
+                        "2012-11-02 00:60", "2012-11-02X00:00", "2012-11-02 00:00:00.",
+                        "2012-11-02 00:00:00+1", "2012-11-02 00:00:00 junk", "12-11-02", "");
+    Deserializer<int> r(s);
+    CHECK_THROWS_AS(r.nextTime(), invalid_argument);
+  }
+
   SECTION("multiple timestamps present") {
     Deserializer<int> r("2012-11-01\n2012-12-02");
 
@@ -51,6 +68,17 @@ TEST_CASE("timestamps are serialized properly", "[serializer][timestamp]") {
   std::tie(t, expected) = GENERATE(table<time_point, string>({
       {unix_time_point(2012, 11, 2), "2012-11-02T00:00:00+0000"},
       {unix_time_point(2012, 11, 2, 1, 44, 32, 789), "2012-11-02T01:44:32.789+0000"},
+      {unix_time_point(2012, 11, 2, 1, 44, 32, 7), "2012-11-02T01:44:32.007+0000"},
+      {unix_time_point(2012, 2, 29, 23, 59, 59), "2012-02-29T23:59:59+0000"},
+      {unix_time_point(1970) - duration_ms(500), "1969-12-31T23:59:59.500+0000"},
+      {unix_time_point(1900, 3, 1), "1900-03-01T00:00:00+0000"},
   }));
   REQUIRE(write_ISO8601_time(t) == expected);
 }
+
+TEST_CASE("timestamps roundtrip through serialization", "[serializer][deserializer][timestamp]") {
+  time_point t = GENERATE(unix_time_point(1970), unix_time_point(1969, 12, 31, 23, 59, 59, 999),
+                          unix_time_point(2000, 2, 29, 12), unix_time_point(2100, 3, 1),
+                          unix_time_point(1700, 3, 1), unix_time_point(2200, 12, 31, 23, 59, 59));
+  REQUIRE(parse_ISO8601(write_ISO8601_time(t)) == t);
+}
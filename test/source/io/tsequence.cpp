@@ -130,3 +130,34 @@ TEMPLATE_TEST_CASE("TSequence are deserialized", "[deserializer][tsequence]", in
     CHECK_THROWS(r.nextTSequence());
   }
 }
+
+TEMPLATE_TEST_CASE("long TSequences are deserialized", "[deserializer][tsequence]", int, float) {
+  Serializer<TestType> w;
+  set<TInstant<TestType>> instants;
+  for (int i = 0; i < 1000; i++) {
+    instants.insert(TInstant<TestType>(i % 100, unix_time_point(2012, 1, 1) + duration_ms(i)));
+  }
+  TSequence<TestType> expected(instants, true, true);
+  string serialized = w.write(&expected);
+  REQUIRE(serialized.size() > 2048);
+
+  Deserializer<TestType> r(serialized + " " + serialized);
+  REQUIRE(*r.nextTSequence() == expected);
+  REQUIRE(*r.nextTSequence() == expected);
+  CHECK_THROWS(r.nextTSequence());
+}
+
+TEST_CASE("TSequence<GeomPoint> are deserialized", "[deserializer][tsequence]") {
+  SECTION("SRID prefix is applied to the instants") {
+    Deserializer<GeomPoint> r("SRID=4326;[POINT(0 0)@2012-01-01, POINT(1 1)@2012-01-02]");
+    unique_ptr<TSequence<GeomPoint>> tseq = r.nextTSequence();
+    REQUIRE(tseq->srid() == 4326);
+    REQUIRE(tseq->startValue() == GeomPoint(0, 0, 4326));
+    REQUIRE(tseq->endValue() == GeomPoint(1, 1, 4326));
+  }
+
+  SECTION("conflicting SRIDs") {
+    Deserializer<GeomPoint> r("SRID=4326;[SRID=5676;POINT(0 0)@2012-01-01]");
+    CHECK_THROWS_AS(r.nextTSequence(), std::invalid_argument);
+  }
+}
@@ -144,4 +144,53 @@ TEST_CASE("STBoxes throw when constructed with bad arguments", "[stbox]") {
       REQUIRE_THROWS_AS((STBox{"2012-01-01", "2012-01-02", 4326, true}), std::invalid_argument);
     }
   }
-}
\ No newline at end of file
+}
+TEST_CASE("STBox predicates", "[stbox]") {
+  STBox box(0, 0, unix_time_point(2012, 1, 1), 10, 10, unix_time_point(2012, 1, 3));
+
+  SECTION("overlaps") {
+    REQUIRE(box.overlaps(STBox(5, 5, unix_time_point(2012, 1, 2), 15, 15,
+                               unix_time_point(2012, 1, 4))));
+    REQUIRE(box.overlaps(STBox(10, 10, 20, 20)));
+    REQUIRE(box.overlaps(STBox(unix_time_point(2012, 1, 3), unix_time_point(2012, 1, 4))));
+    REQUIRE_FALSE(box.overlaps(STBox(11, 0, 20, 10)));
+    REQUIRE_FALSE(box.overlaps(STBox(unix_time_point(2012, 1, 4), unix_time_point(2012, 1, 5))));
+    REQUIRE_THROWS_AS(box.overlaps(STBox(0.0, 0.0, 1, 1, 4326)), invalid_argument);
+  }
+
+  SECTION("contains") {
+    REQUIRE(box.contains(STBox(1, 1, unix_time_point(2012, 1, 1), 10, 2,
+                               unix_time_point(2012, 1, 2))));
+    REQUIRE(box.contains(box));
+    REQUIRE_FALSE(box.contains(STBox(1, 1, 11, 2)));
+    REQUIRE(STBox(0.0, 0.0, 10, 10).contains(box));
+  }
+
+  SECTION("adjacent") {
+    REQUIRE(box.adjacent(STBox(10, 0, 20, 10)));
+    REQUIRE(box.adjacent(STBox(unix_time_point(2012, 1, 3), unix_time_point(2012, 1, 4))));
+    REQUIRE_FALSE(box.adjacent(STBox(9, 0, 20, 10)));
+    REQUIRE_FALSE(box.adjacent(STBox(11, 0, 20, 10)));
+  }
+
+  SECTION("expand") {
+    REQUIRE(box.expand(1.0)
+            == STBox(-1, -1, unix_time_point(2012, 1, 1), 11, 11, unix_time_point(2012, 1, 3)));
+    REQUIRE(box.expand(duration_ms(24 * 60 * 60 * 1000L))
+            == STBox(0.0, 0.0, unix_time_point(2011, 12, 31), 10, 10, unix_time_point(2012, 1, 4)));
+    REQUIRE(STBox(0.0, 0.0, 1, 1).expand(duration_ms(1)) == STBox(0.0, 0.0, 1, 1));
+  }
+
+  SECTION("union") {
+    REQUIRE(box.union_(STBox(5, -5, unix_time_point(2012, 1, 2), 20, 5,
+                             unix_time_point(2012, 1, 5)))
+            == STBox(0.0, -5.0, unix_time_point(2012, 1, 1), 20, 10, unix_time_point(2012, 1, 5)));
+    REQUIRE(box.union_(STBox(5, -5, 20, 5)) == STBox(0.0, -5.0, 20, 10));
+  }
+}
+
+TEST_CASE("equal STBoxes hash equally", "[stbox]") {
+  STBox stbox(1.0, 2.0, 3.0, 4.0, 4326);
+  REQUIRE(hash<STBox>()(stbox) == hash<STBox>()(STBox("SRID=4326;STBOX((1, 2), (3, 4))")));
+  REQUIRE(hash<STBox>()(stbox) != hash<STBox>()(STBox(1.0, 2.0, 3.0, 4.0)));
+}
@@ -56,3 +56,11 @@ TEST_CASE("TBoxes are constructed and serialized properly", "[tbox]") {
     REQUIRE(output.str() == "TBOX((1, 2012-01-01T00:00:00+0000), (2, 2012-01-02T00:00:00+0000))");
   }
 }
+
+TEST_CASE("equal TBoxes hash equally", "[tbox]") {
+  TBox tbox(1.0, unix_time_point(2012, 1, 1), 2.0, unix_time_point(2012, 1, 2));
+  TBox same("TBOX((1, 2012-01-01), (2, 2012-01-02))");
+  REQUIRE(std::hash<TBox>()(tbox) == std::hash<TBox>()(same));
+  REQUIRE(std::hash<TBox>()(tbox) != std::hash<TBox>()(TBox(1.0, 2.0)));
+  REQUIRE(std::hash<TBox>()(TBox(0.0, 1.0)) == std::hash<TBox>()(TBox(-0.0, 1.0)));
+}
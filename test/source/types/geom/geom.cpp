@@ -1,7 +1,11 @@
+#include <algorithm>
 #include <catch2/catch.hpp>
 #include <meos/types/geom/GeomPoint.hpp>
+#include <meos/types/temporal/TSequence.hpp>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace meos;
 
@@ -130,3 +134,92 @@ TEST_CASE("toHex EWKB", "[geometry]") {
   g.toHEX(output, true);
   REQUIRE(output.str() == "0101000020E610000000000000000000400000000000000840");
 }
+
+TEST_CASE("3D points", "[geometry]") {
+  SECTION("constructed from coordinates") {
+    GeomPoint g(2, 3, 4, 4326);
+    REQUIRE(g.has_z());
+    REQUIRE(g.z() == 4);
+    REQUIRE(g.toWKT() == "SRID=4326;POINT Z (2 3 4)");
+  }
+
+  SECTION("read from WKT") {
+    GeomPoint g("POINT Z (2 3 4)");
+    REQUIRE(g.has_z());
+    REQUIRE(g.x() == 2);
+    REQUIRE(g.y() == 3);
+    REQUIRE(g.z() == 4);
+  }
+
+  SECTION("WKB roundtrip") {
+    GeomPoint g(2, 3, 4, 4326);
+    std::stringstream output;
+    g.toHEX(output, true);
+    output.seekg(0);
+    GeomPoint read;
+    read.fromHEX(output);
+    REQUIRE(read == g);
+  }
+
+  SECTION("2D and 3D points are different") {
+    REQUIRE(GeomPoint(2, 3, 0, 0) != GeomPoint(2, 3));
+  }
+}
+
+TEST_CASE("with_srid keeps the coordinates", "[geometry]") {
+  GeomPoint g(2, 3, 4, 0);
+  GeomPoint h = g.with_srid(4326);
+  REQUIRE(h.srid() == 4326);
+  REQUIRE(h.x() == 2);
+  REQUIRE(h.y() == 3);
+  REQUIRE(h.z() == 4);
+  REQUIRE(g.srid() == 0);
+}
+
+TEST_CASE("invalid geometries are rejected", "[geometry]") {
+  REQUIRE_THROWS_AS(GeomPoint("POINT (2)"), std::invalid_argument);
+  REQUIRE_THROWS_AS(GeomPoint("POINT Z (2 3)"), std::invalid_argument);
+  REQUIRE_THROWS_AS(GeomPoint("LINESTRING (2 3, 4 5)"), std::invalid_argument);
+  REQUIRE_THROWS_AS(GeomPoint("0101000000000000000000004000"), std::invalid_argument);
+}
+
+TEST_CASE("geometries can be used from many threads at once", "[geometry][threads]") {
+  size_t const num_threads = std::max(8u, 2 * std::thread::hardware_concurrency());
+  size_t const iterations = 200;
+
+  // Catch assertions are not thread safe, so threads only count their failures
+  std::vector<size_t> failures(num_threads, 0);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_threads; t++) {
+    threads.emplace_back([&failures, t, iterations] {
+      for (size_t i = 0; i < iterations; i++) {
+        std::string const a = std::to_string(t) + " " + std::to_string(i);
+        std::string const b = std::to_string(i) + " " + std::to_string(t);
+        TSequence<GeomPoint> sequence("SRID=4326;[POINT(" + a + ")@2012-01-01, POINT(" + b
+                                      + ")@2012-01-02]");
+        TSequence<GeomPoint> copy = sequence;
+
+        GeomPoint start = copy.startValue();
+        double x;
+        GEOSGeomGetX_r(geos_context(), start.geom().get(), &x);
+
+        bool ok = copy == sequence && start.srid() == 4326 && x == t
+                  && copy.endValue().toWKT(false) == "POINT (" + b + ")";
+        if (!ok) failures[t]++;
+      }
+
+      // Half of the threads clean up explicitly, the rest leave it to the thread exit
+      if (t % 2 == 0) finish_geos();
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  REQUIRE(failures == std::vector<size_t>(num_threads, 0));
+}
+
+TEST_CASE("equal points hash equally", "[geometry]") {
+  std::hash<GeomPoint> hash;
+  REQUIRE(hash(GeomPoint(1.0, 2.0, 4326)) == hash(GeomPoint("SRID=4326;POINT(1 2)")));
+  REQUIRE(hash(GeomPoint(1.0, 2.0, 4326)) != hash(GeomPoint(1.0, 2.0, 0)));
+  REQUIRE(hash(GeomPoint(1.0, 2.0, 3.0, 0)) != hash(GeomPoint(1.0, 2.0)));
+}
@@ -129,3 +129,10 @@ TEMPLATE_TEST_CASE("Range contains value", "[range]", int, float) {
     REQUIRE(range.upper_inc() == range.contains(4));
   }
 }
+
+TEST_CASE("equal ranges hash equally", "[range]") {
+  REQUIRE(hash<RangeInt>()(RangeInt(10, 20)) == hash<RangeInt>()(RangeInt("[10, 20)")));
+  REQUIRE(hash<RangeInt>()(RangeInt(10, 20)) != hash<RangeInt>()(RangeInt("[10, 20]")));
+  REQUIRE(hash<RangeFloat>()(RangeFloat(-0.0f, 1.0f))
+          == hash<RangeFloat>()(RangeFloat(0.0f, 1.0f)));
+}
@@ -0,0 +1,136 @@
+#include <catch2/catch.hpp>
+#include <meos/types/box/TBox.hpp>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/types/temporal/TemporalAggregates.hpp>
+#include <stdexcept>
+#include <vector>
+
+#include "../../common/time_utils.hpp"
+
+using namespace meos;
+using namespace std;
+
+TEST_CASE("tcount counts the values defined at each instant", "[temporalaggregates]") {
+  TSequence<float> a("[1@2012-01-01, 1@2012-01-03)");
+  TSequence<float> b("[2@2012-01-02, 2@2012-01-04)");
+  auto result = tcount<float>({&a, &b});
+  REQUIRE(dynamic_cast<TSequence<int> const &>(*result)
+          == TSequence<int>("[1@2012-01-01, 2@2012-01-02, 1@2012-01-03, 1@2012-01-04)"));
+
+  // a includes its end, so the count drops right after it
+  TSequence<float> c("[1@2012-01-01, 1@2012-01-03]");
+  result = tcount<float>({&c, &b});
+  REQUIRE(dynamic_cast<TSequenceSet<int> const &>(*result)
+          == TSequenceSet<int>("{[1@2012-01-01, 2@2012-01-02, 2@2012-01-03], "
+                               "(1@2012-01-03, 1@2012-01-04)}"));
+
+  REQUIRE(tcount<float>({}) == nullptr);
+  TInstant<float> instant(1, unix_time_point(2012, 1, 1));
+  REQUIRE_THROWS_AS(tcount<float>({&a, &instant}), invalid_argument);
+}
+
+TEST_CASE("linear floats are aggregated with their crossings", "[temporalaggregates]") {
+  TSequence<float> a("[0@2012-01-01, 10@2012-01-03]");
+  TSequence<float> b("[10@2012-01-01, 0@2012-01-03]");
+
+  auto result = tmax<float>({&a, &b});
+  REQUIRE(dynamic_cast<TSequence<float> const &>(*result)
+          == TSequence<float>("[10@2012-01-01, 5@2012-01-02, 10@2012-01-03]"));
+
+  result = tmin<float>({&a, &b});
+  REQUIRE(dynamic_cast<TSequence<float> const &>(*result)
+          == TSequence<float>("[0@2012-01-01, 5@2012-01-02, 0@2012-01-03]"));
+
+  // The average jumps where b starts
+  TSequence<float> c("[20@2012-01-02, 20@2012-01-03]");
+  result = tavg<float>({&a, &c});
+  REQUIRE(dynamic_cast<TSequenceSet<float> const &>(*result)
+          == TSequenceSet<float>("{[0@2012-01-01, 5@2012-01-02), "
+                                 "[12.5@2012-01-02, 15@2012-01-03]}"));
+}
+
+TEST_CASE("stepwise integers are summed over the union of their time", "[temporalaggregates]") {
+  TSequence<int> a("[1@2012-01-01, 3@2012-01-02, 3@2012-01-03]");
+  TSequenceSet<int> b("{[10@2012-01-02, 10@2012-01-04], [5@2012-01-05]}");
+  auto result = tsum<int>({&a, &b});
+  REQUIRE(dynamic_cast<TSequenceSet<int> const &>(*result)
+          == TSequenceSet<int>("{[1@2012-01-01, 13@2012-01-02, 13@2012-01-03], "
+                               "(10@2012-01-03, 10@2012-01-04], [5@2012-01-05]}"));
+
+  auto average = tavg<int>({&a, &b});
+  REQUIRE(average->valueAtTimestamp(unix_time_point(2012, 1, 2)) == 6.5);
+  REQUIRE(average->valueAtTimestamp(unix_time_point(2012, 1, 5)) == 5);
+}
+
+TEST_CASE("instant sets are aggregated at their timestamps", "[temporalaggregates]") {
+  TInstantSet<int> a("{1@2012-01-01, 2@2012-01-02}");
+  TInstant<int> b(5, unix_time_point(2012, 1, 2));
+  REQUIRE(dynamic_cast<TInstantSet<int> const &>(*tcount<int>({&a, &b}))
+          == TInstantSet<int>("{1@2012-01-01, 2@2012-01-02}"));
+  REQUIRE(dynamic_cast<TInstantSet<int> const &>(*tmax<int>({&a, &b}))
+          == TInstantSet<int>("{1@2012-01-01, 5@2012-01-02}"));
+  REQUIRE(dynamic_cast<TInstantSet<float> const &>(*tavg<int>({&a, &b}))
+          == TInstantSet<float>("{1@2012-01-01, 3.5@2012-01-02}"));
+}
+
+TEST_CASE("aggregates of many values match their values", "[temporalaggregates]") {
+  size_t const num_threads = GENERATE(1, 4);
+  time_point const start = unix_time_point(2012, 1, 1);
+  vector<TSequence<int>> sequences;
+  for (int k = 0; k < 50; k++) {
+    vector<time_point> timestamps;
+    vector<int> values;
+    time_point t = start + duration_ms(1000 * (random() % 100));
+    for (int i = 0; i < 20; i++) {
+      timestamps.push_back(t);
+      values.push_back(random() % 100);
+      t += duration_ms(1000 * (1 + random() % 10));
+    }
+    sequences.emplace_back(timestamps, values, true, random() % 2 == 0);
+  }
+  vector<Temporal<int> const *> temporals;
+  for (TSequence<int> const &sequence : sequences) temporals.push_back(&sequence);
+
+  auto const count = tcount(temporals, num_threads);
+  auto const sum = tsum(temporals, num_threads);
+  auto const max = tmax(temporals, num_threads);
+  for (int s = 0; s < 300; s++) {
+    time_point const t = start + duration_ms(500 * s);
+    int expected_count = 0;
+    int expected_sum = 0;
+    int expected_max = -1;
+    for (TSequence<int> const &sequence : sequences) {
+      auto const values = sequence.valuesAtTimestamps({t});
+      if (values.empty()) continue;
+      expected_count++;
+      expected_sum += values.front().first;
+      expected_max = std::max(expected_max, values.front().first);
+    }
+    auto const counts = count->valuesAtTimestamps({t});
+    if (expected_count == 0) {
+      REQUIRE(counts.empty());
+      continue;
+    }
+    REQUIRE(counts.front().first == expected_count);
+    REQUIRE(sum->valuesAtTimestamps({t}).front().first == expected_sum);
+    REQUIRE(max->valuesAtTimestamps({t}).front().first == expected_max);
+  }
+
+  TBox const box = meos::extent(temporals, num_threads);
+  for (TSequence<int> const &sequence : sequences) {
+    REQUIRE(box.tmin() <= sequence.startTimestamp());
+    REQUIRE(box.tmax() >= sequence.endTimestamp());
+    REQUIRE(box.xmin() <= sequence.minValue());
+    REQUIRE(box.xmax() >= sequence.maxValue());
+  }
+}
+
+TEST_CASE("extent unites the bounding boxes", "[temporalaggregates]") {
+  TSequence<float> a("[0@2012-01-01, 10@2012-01-03]");
+  TSequence<float> b("[-5@2012-01-02, 2@2012-01-05]");
+  REQUIRE(meos::extent<float>({&a, &b}) == TBox(-5, "2012-01-01", 10, "2012-01-05"));
+  REQUIRE_THROWS_AS(meos::extent<float>({}), invalid_argument);
+}
@@ -0,0 +1,136 @@
+#include <catch2/catch.hpp>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/types/temporal/TemporalArithmetic.hpp>
+#include <stdexcept>
+
+#include "../../common/time_utils.hpp"
+
+using namespace meos;
+using namespace std;
+
+TEMPLATE_TEST_CASE("stepwise temporal numbers are added at the union of their timestamps",
+                   "[temporalarithmetic]", int, float) {
+  TSequence<TestType> lhs("Interp=Stepwise;[1@2012-01-01, 3@2012-01-03]");
+  TSequence<TestType> rhs("Interp=Stepwise;[10@2012-01-02, 20@2012-01-04]");
+
+  auto result = lhs + rhs;
+  REQUIRE(dynamic_cast<TSequence<TestType> const &>(*result)
+          == TSequence<TestType>("Interp=Stepwise;[11@2012-01-02, 13@2012-01-03]"));
+
+  result = rhs - lhs;
+  REQUIRE(dynamic_cast<TSequence<TestType> const &>(*result)
+          == TSequence<TestType>("Interp=Stepwise;[9@2012-01-02, 7@2012-01-03]"));
+
+  // lhs holds its value up to the exclusive cut, while cut keeps its own last value
+  TSequence<TestType> cut("Interp=Stepwise;[2@2012-01-01, 4@2012-01-02 12:00)");
+  result = lhs * cut;
+  REQUIRE(dynamic_cast<TSequence<TestType> const &>(*result)
+          == TSequence<TestType>("Interp=Stepwise;[2@2012-01-01, 4@2012-01-02 12:00)"));
+
+  REQUIRE(lhs + TSequence<TestType>("Interp=Stepwise;[1@2013-01-01, 2@2013-01-02]") == nullptr);
+}
+
+TEMPLATE_TEST_CASE("temporal numbers are combined with scalars", "[temporalarithmetic]", int,
+                   float) {
+  TSequence<TestType> seq("Interp=Stepwise;[7@2012-01-01, 9@2012-01-02]");
+
+  REQUIRE(dynamic_cast<TSequence<TestType> const &>(*(seq + 1))
+          == TSequence<TestType>("Interp=Stepwise;[8@2012-01-01, 10@2012-01-02]"));
+  REQUIRE(dynamic_cast<TSequence<TestType> const &>(*(10 - seq))
+          == TSequence<TestType>("Interp=Stepwise;[3@2012-01-01, 1@2012-01-02]"));
+  REQUIRE(dynamic_cast<TSequence<TestType> const &>(*(2 * seq))
+          == TSequence<TestType>("Interp=Stepwise;[14@2012-01-01, 18@2012-01-02]"));
+
+  TInstantSet<TestType> instant_set("{4@2012-01-01, 8@2012-01-02}");
+  REQUIRE(dynamic_cast<TInstantSet<TestType> const &>(*(instant_set / 4))
+          == TInstantSet<TestType>("{1@2012-01-01, 2@2012-01-02}"));
+
+  REQUIRE_THROWS_AS(seq / 0, invalid_argument);
+  REQUIRE_THROWS_AS(1 / TInstant<TestType>(0, unix_time_point(2012, 1, 1)), invalid_argument);
+}
+
+TEST_CASE("integers divide as in C++", "[temporalarithmetic]") {
+  TSequence<int> seq("[7@2012-01-01, 9@2012-01-02]");
+  REQUIRE(dynamic_cast<TSequence<int> const &>(*(seq / 2))
+          == TSequence<int>("[3@2012-01-01, 4@2012-01-02]"));
+  REQUIRE_THROWS_AS(seq / TSequence<int>("[1@2012-01-01, 0@2012-01-02]"), invalid_argument);
+}
+
+TEST_CASE("linear temporal floats are synchronised", "[temporalarithmetic]") {
+  TSequence<float> lhs("[0@2012-01-01, 10@2012-01-03]");
+  TSequence<float> rhs("[10@2012-01-02, 12@2012-01-02 12:00, 18@2012-01-04)");
+
+  SECTION("sums are interpolated at the timestamps of both") {
+    auto result = lhs + rhs;
+    REQUIRE(dynamic_cast<TSequence<float> const &>(*result)
+            == TSequence<float>("[15@2012-01-02, 19.5@2012-01-02 12:00, 24@2012-01-03]"));
+  }
+
+  SECTION("products get their turning points") {
+    TSequence<float> seq("[-1@2012-01-01, 1@2012-01-03]");
+    auto result = seq * seq;
+    REQUIRE(dynamic_cast<TSequence<float> const &>(*result)
+            == TSequence<float>("[1@2012-01-01, 0@2012-01-02, 1@2012-01-03]"));
+
+    // No turning point within the segment
+    result = lhs * TSequence<float>("[1@2012-01-01, 2@2012-01-03]");
+    REQUIRE(dynamic_cast<TSequence<float> const &>(*result)
+            == TSequence<float>("[0@2012-01-01, 20@2012-01-03]"));
+  }
+
+  SECTION("divisors must not cross zero") {
+    REQUIRE_THROWS_AS(lhs / TSequence<float>("[-1@2012-01-01, 1@2012-01-03]"), invalid_argument);
+    REQUIRE_THROWS_AS(1.0f / TSequence<float>("[-1@2012-01-01, 1@2012-01-03]"),
+                      invalid_argument);
+
+    auto result = lhs / TSequence<float>("[2@2012-01-01, 2@2012-01-03]");
+    REQUIRE(dynamic_cast<TSequence<float> const &>(*result)
+            == TSequence<float>("[0@2012-01-01, 5@2012-01-03]"));
+  }
+
+  SECTION("a stepwise operand makes the result jump") {
+    TSequence<float> stepwise("Interp=Stepwise;[1@2012-01-01, 2@2012-01-02, 2@2012-01-03]");
+    auto result = stepwise + lhs;
+    REQUIRE(dynamic_cast<TSequenceSet<float> const &>(*result)
+            == TSequenceSet<float>("{[1@2012-01-01, 6@2012-01-02), [7@2012-01-02, 12@2012-01-03), "
+                                   "[12@2012-01-03]}"));
+  }
+}
+
+TEST_CASE("discrete and sequence set operands give the duration of the result",
+          "[temporalarithmetic]") {
+  TSequence<float> seq("[0@2012-01-01, 10@2012-01-03]");
+
+  auto result = TInstantSet<float>("{1@2011-12-31, 1@2012-01-02, 1@2012-01-03}") + seq;
+  REQUIRE(dynamic_cast<TInstantSet<float> const &>(*result)
+          == TInstantSet<float>("{6@2012-01-02, 11@2012-01-03}"));
+
+  result = seq - TInstant<float>(1, unix_time_point(2012, 1, 2));
+  REQUIRE(dynamic_cast<TInstant<float> const &>(*result)
+          == TInstant<float>(4, unix_time_point(2012, 1, 2)));
+  REQUIRE(seq - TInstant<float>(1, unix_time_point(2012, 1, 4)) == nullptr);
+
+  TSequenceSet<float> sequence_set(
+      "{[1@2011-12-31, 1@2012-01-02), [2@2012-01-02 12:00, 2@2012-01-05]}");
+  result = seq * sequence_set;
+  REQUIRE(dynamic_cast<TSequenceSet<float> const &>(*result)
+          == TSequenceSet<float>("{[0@2012-01-01, 5@2012-01-02), "
+                                 "[15@2012-01-02 12:00, 20@2012-01-03]}"));
+}
+
+TEST_CASE("sequence set operands are synchronised in order of time", "[temporalarithmetic]") {
+  // Later sequences with fewer instants come first in storage
+  TSequenceSet<float> lhs(
+      "{[1@2012-01-01, 1@2012-01-02, 1@2012-01-03], [5@2012-01-04, 5@2012-01-05]}");
+  TSequenceSet<float> rhs(
+      "{[10@2012-01-01, 10@2012-01-02], "
+      "[20@2012-01-02 12:00, 20@2012-01-03, 20@2012-01-04 12:00, 20@2012-01-05]}");
+  auto result = lhs + rhs;
+  REQUIRE(dynamic_cast<TSequenceSet<float> const &>(*result)
+          == TSequenceSet<float>("{[11@2012-01-01, 11@2012-01-02], "
+                                 "[21@2012-01-02 12:00, 21@2012-01-03], "
+                                 "[25@2012-01-04, 25@2012-01-04 12:00, 25@2012-01-05]}"));
+}
@@ -0,0 +1,99 @@
+#include <catch2/catch.hpp>
+#include <meos/types/temporal/Interpolation.hpp>
+#include <meos/types/temporal/TemporalBuilder.hpp>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "../../common/time_utils.hpp"
+
+using namespace meos;
+using namespace std;
+
+TEMPLATE_TEST_CASE("TemporalBuilder builds each temporal type", "[temporalbuilder]", int, float) {
+  set<TInstant<TestType>> instants = {
+      TInstant<TestType>(10, unix_time_point(2012, 1, 1)),
+      TInstant<TestType>(20, unix_time_point(2012, 1, 2)),
+      TInstant<TestType>(30, unix_time_point(2012, 1, 3)),
+  };
+  TemporalBuilder<TestType> builder(3);
+
+  SECTION("ordered or not, instants end up as from a set") {
+    bool const ordered = GENERATE(true, false);
+    if (ordered) {
+      for (auto const &instant : instants) builder.add(instant);
+    } else {
+      builder.add(30, unix_time_point(2012, 1, 3));
+      builder.add(10, unix_time_point(2012, 1, 1));
+      builder.add(20, unix_time_point(2012, 1, 2));
+      builder.add(10, unix_time_point(2012, 1, 1));  // Duplicate!
+    }
+
+    SECTION("instant set") {
+      REQUIRE(builder.buildInstantSet() == TInstantSet<TestType>(instants));
+    }
+    SECTION("sequence") {
+      REQUIRE(builder.buildSequence(false, true) == TSequence<TestType>(instants, false, true));
+    }
+    REQUIRE(builder.size() == 0);
+  }
+
+  SECTION("sequence set") {
+    builder.add(10, unix_time_point(2012, 1, 1));
+    builder.add(20, unix_time_point(2012, 1, 2));
+    builder.closeSequence(true, true, Interpolation::Stepwise);
+    builder.add(30, unix_time_point(2012, 1, 3));
+    builder.closeSequence(true, true, Interpolation::Stepwise);
+
+    TSequenceSet<TestType> sequence_set = builder.buildSequenceSet();
+    REQUIRE(sequence_set.numSequences() == 2);
+    REQUIRE(sequence_set.interpolation() == Interpolation::Stepwise);
+    REQUIRE(sequence_set.instants() == instants);
+    CHECK_THROWS(builder.buildSequenceSet());
+  }
+
+  SECTION("can be reused after building") {
+    builder.add(10, unix_time_point(2012, 1, 1));
+    builder.buildInstantSet();
+    builder.add(20, unix_time_point(2012, 1, 2));
+    TInstantSet<TestType> instant_set = builder.buildInstantSet();
+    REQUIRE(instant_set.numInstants() == 1);
+    REQUIRE(instant_set.startValue() == 20);
+  }
+
+  SECTION("building validates") {
+    CHECK_THROWS(builder.buildInstantSet());
+    builder.add(10, unix_time_point(2012, 1, 1));
+    CHECK_THROWS(builder.buildSequence(true, false));
+  }
+}
+
+TEST_CASE("TemporalBuilder keeps the SRID of the points", "[temporalbuilder]") {
+  TemporalBuilder<GeomPoint> builder;
+  builder.add(GeomPoint(0, 0, 4326), unix_time_point(2012, 1, 1));
+  builder.add(GeomPoint(1, 1, 4326), unix_time_point(2012, 1, 2));
+  TSequence<GeomPoint> sequence = builder.buildSequence();
+  REQUIRE(sequence.srid() == 4326);
+  REQUIRE(sequence.numInstants() == 2);
+}
+
+TEST_CASE("Temporal values can be moved", "[temporalbuilder]") {
+  set<TInstant<float>> instants = {
+      TInstant<float>(10, unix_time_point(2012, 1, 1)),
+      TInstant<float>(20, unix_time_point(2012, 1, 2)),
+  };
+  TSequence<float> sequence(instants, true, true);
+
+  SECTION("sequences") {
+    TSequence<float> copy = sequence;
+    TSequence<float> moved = move(copy);
+    REQUIRE(moved == sequence);
+  }
+
+  SECTION("sequence sets take the sequences over") {
+    set<TSequence<float>> sequences = {sequence};
+    TSequenceSet<float> sequence_set(move(sequences));
+    REQUIRE(sequence_set.numSequences() == 1);
+    REQUIRE(sequence_set.startSequence() == sequence);
+  }
+}
@@ -0,0 +1,125 @@
+#include <catch2/catch.hpp>
+#include <meos/types/temporal/TInstant.hpp>
+#include <meos/types/temporal/TInstantSet.hpp>
+#include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
+#include <meos/types/temporal/TemporalComparison.hpp>
+#include <string>
+
+#include "../../common/time_utils.hpp"
+
+using namespace meos;
+using namespace std;
+
+TEST_CASE("linear temporal floats are compared with scalars at their crossings",
+          "[temporalcomparison]") {
+  TSequence<float> seq("[0@2012-01-01, 10@2012-01-03, 0@2012-01-05]");
+
+  // The result is split where it differs at an instant from right after it
+  auto result = tgt(seq, 5.0f);
+  REQUIRE(dynamic_cast<TSequenceSet<bool> const &>(*result)
+          == TSequenceSet<bool>("Interp=Stepwise;{[f@2012-01-01, f@2012-01-02], "
+                                "(t@2012-01-02, f@2012-01-04, f@2012-01-05]}"));
+
+  result = tge(seq, 5.0f);
+  REQUIRE(dynamic_cast<TSequenceSet<bool> const &>(*result)
+          == TSequenceSet<bool>("Interp=Stepwise;{[f@2012-01-01, t@2012-01-02, t@2012-01-04], "
+                                "(f@2012-01-04, f@2012-01-05]}"));
+
+  // The scalar first compares the other way around
+  result = tlt(5.0f, seq);
+  REQUIRE(dynamic_cast<TSequenceSet<bool> const &>(*result)
+          == dynamic_cast<TSequenceSet<bool> const &>(*tgt(seq, 5.0f)));
+
+  // Equality only holds at the crossings
+  result = teq(seq, 5.0f);
+  REQUIRE(dynamic_cast<TSequenceSet<bool> const &>(*result)
+          == TSequenceSet<bool>("Interp=Stepwise;{[f@2012-01-01, t@2012-01-02], "
+                                "(f@2012-01-02, t@2012-01-04], (f@2012-01-04, f@2012-01-05]}"));
+
+  // Touching the scalar at an instant
+  result = tge(seq, 10.0f);
+  REQUIRE(dynamic_cast<TSequenceSet<bool> const &>(*result)
+          == TSequenceSet<bool>("Interp=Stepwise;{[f@2012-01-01, t@2012-01-03], "
+                                "(f@2012-01-03, f@2012-01-05]}"));
+
+  // An excluded start is replaced by the value right after it
+  result = tgt(TSequence<float>("(5@2012-01-01, 10@2012-01-02]"), 5.0f);
+  REQUIRE(dynamic_cast<TSequence<bool> const &>(*result)
+          == TSequence<bool>("Interp=Stepwise;(t@2012-01-01, t@2012-01-02]"));
+}
+
+TEST_CASE("bounding boxes give constant comparisons", "[temporalcomparison]") {
+  TSequenceSet<float> sequence_set(
+      "{[1@2012-01-01, 3@2012-01-02], (4@2012-01-03, 2@2012-01-04)}");
+
+  auto result = tlt(sequence_set, 5.0f);
+  REQUIRE(dynamic_cast<TSequenceSet<bool> const &>(*result)
+          == TSequenceSet<bool>("Interp=Stepwise;{[t@2012-01-01, t@2012-01-02], "
+                                "(t@2012-01-03, t@2012-01-04)}"));
+
+  result = tne(TSequence<int>("[1@2012-01-01, 2@2012-01-03]"),
+               TSequence<int>("[5@2012-01-02, 6@2012-01-04]"));
+  REQUIRE(dynamic_cast<TSequence<bool> const &>(*result)
+          == TSequence<bool>("Interp=Stepwise;[t@2012-01-02, t@2012-01-03]"));
+
+  result = teq(TInstantSet<int>("{1@2012-01-01, 1@2012-01-02}"), 1);
+  REQUIRE(dynamic_cast<TInstantSet<bool> const &>(*result)
+          == TInstantSet<bool>("{t@2012-01-01, t@2012-01-02}"));
+
+  REQUIRE(tlt(TSequence<float>("[1@2012-01-01, 2@2012-01-02]"),
+              TSequence<float>("[5@2013-01-01, 6@2013-01-02]"))
+          == nullptr);
+}
+
+TEST_CASE("temporal values are compared at their synchronised instants", "[temporalcomparison]") {
+  SECTION("linear floats crossing each other") {
+    TSequence<float> lhs("[0@2012-01-01, 10@2012-01-03]");
+    TSequence<float> rhs("[10@2012-01-01, 0@2012-01-03]");
+    auto result = tlt(lhs, rhs);
+    REQUIRE(dynamic_cast<TSequence<bool> const &>(*result)
+            == TSequence<bool>("Interp=Stepwise;[t@2012-01-01, f@2012-01-02, f@2012-01-03]"));
+
+    result = tle(lhs, rhs);
+    REQUIRE(dynamic_cast<TSequenceSet<bool> const &>(*result)
+            == TSequenceSet<bool>("Interp=Stepwise;{[t@2012-01-01, t@2012-01-02], "
+                                  "(f@2012-01-02, f@2012-01-03]}"));
+  }
+
+  SECTION("a stepwise integer against another") {
+    TSequence<int> lhs("Interp=Stepwise;[1@2012-01-01, 3@2012-01-02, 3@2012-01-04]");
+    TSequence<int> rhs("Interp=Stepwise;[2@2012-01-01, 2@2012-01-03]");
+    auto result = tgt(lhs, rhs);
+    REQUIRE(dynamic_cast<TSequence<bool> const &>(*result)
+            == TSequence<bool>("Interp=Stepwise;[f@2012-01-01, t@2012-01-02, t@2012-01-03]"));
+  }
+
+  SECTION("a stepwise float against a linear one") {
+    TSequence<float> stepwise("Interp=Stepwise;[1@2012-01-01, 3@2012-01-02, 3@2012-01-03]");
+    TSequence<float> linear("[0@2012-01-01, 4@2012-01-03]");
+    auto result = tge(stepwise, linear);
+    REQUIRE(dynamic_cast<TSequenceSet<bool> const &>(*result)
+            == TSequenceSet<bool>("Interp=Stepwise;{[t@2012-01-01, t@2012-01-01 12:00], "
+                                  "(f@2012-01-01 12:00, f@2012-01-02), "
+                                  "[t@2012-01-02, t@2012-01-02 12:00], "
+                                  "(f@2012-01-02 12:00, f@2012-01-03), [f@2012-01-03]}"));
+  }
+
+  SECTION("text") {
+    TSequence<string> lhs("[a@2012-01-01, c@2012-01-02, c@2012-01-03]");
+    auto result = tle(lhs, TSequence<string>("[b@2012-01-01, b@2012-01-03]"));
+    REQUIRE(dynamic_cast<TSequence<bool> const &>(*result)
+            == TSequence<bool>("Interp=Stepwise;[t@2012-01-01, f@2012-01-02, f@2012-01-03]"));
+
+    result = teq(TInstantSet<string>("{a@2012-01-01, b@2012-01-02}"), string("b"));
+    REQUIRE(dynamic_cast<TInstantSet<bool> const &>(*result)
+            == TInstantSet<bool>("{f@2012-01-01, t@2012-01-02}"));
+  }
+
+  SECTION("instants") {
+    auto result = tgt(TSequence<float>("[0@2012-01-01, 10@2012-01-03]"),
+                      TInstant<float>(4, unix_time_point(2012, 1, 2)));
+    REQUIRE(dynamic_cast<TInstant<bool> const &>(*result)
+            == TInstant<bool>(true, unix_time_point(2012, 1, 2)));
+  }
+}
@@ -329,3 +329,58 @@ TEST_CASE("TInstant<GeomPoint> with_srid", "[tinst]") {
   REQUIRE(g.startInstant().srid() == 4326);
   REQUIRE(g.startValue().srid() == 4326);
 }
+
+TEMPLATE_TEST_CASE("TInstant values at timestamps", "[tinst]", int, float) {
+  TInstant<TestType> instant(10, unix_time_point(2012, 1, 1));
+
+  REQUIRE(instant.valueAtTimestamp(unix_time_point(2012, 1, 1)) == 10);
+  REQUIRE_THROWS_AS(instant.valueAtTimestamp(unix_time_point(2012, 1, 2)), invalid_argument);
+
+  vector<pair<TestType, time_point>> expected = {{10, unix_time_point(2012, 1, 1)}};
+  REQUIRE(instant.valuesAtTimestamps({unix_time_point(2011, 12, 31), unix_time_point(2012, 1, 1),
+                                      unix_time_point(2012, 1, 2)})
+          == expected);
+}
+
+TEMPLATE_TEST_CASE("TInstant restrictions", "[tinstant]", int, float) {
+  TInstant<TestType> instant(10, unix_time_point(2012, 1, 2));
+
+  auto result = instant.atPeriod(Period("[2012-01-01, 2012-01-02]"));
+  REQUIRE(dynamic_cast<TInstant<TestType> const &>(*result) == instant);
+  REQUIRE(instant.atPeriod(Period("[2012-01-01, 2012-01-02)")) == nullptr);
+
+  result = instant.atTimestampSet(TimestampSet("{2012-01-01, 2012-01-02}"));
+  REQUIRE(dynamic_cast<TInstant<TestType> const &>(*result) == instant);
+  REQUIRE(instant.atTimestamp(unix_time_point(2012, 1, 3)) == nullptr);
+
+  result = instant.minusPeriodSet(
+      PeriodSet("{[2012-01-01, 2012-01-02), (2012-01-02, 2012-01-03]}"));
+  REQUIRE(dynamic_cast<TInstant<TestType> const &>(*result) == instant);
+  REQUIRE(instant.minusTimestamp(unix_time_point(2012, 1, 2)) == nullptr);
+}
+
+TEMPLATE_TEST_CASE("TInstant bounding box", "[tinstant]", int, float) {
+  TInstant<TestType> instant(10, unix_time_point(2012, 1, 2));
+  REQUIRE(instant.boundingBox()
+          == TBox(10, unix_time_point(2012, 1, 2), 10, unix_time_point(2012, 1, 2)));
+
+  TInstant<GeomPoint> point(GeomPoint(1, 2, 4326), unix_time_point(2012, 1, 2));
+  REQUIRE(point.boundingBox()
+          == STBox(1, 2, unix_time_point(2012, 1, 2), 1, 2, unix_time_point(2012, 1, 2), 4326));
+}
+
+TEST_CASE("equal TInstants hash equally", "[tinst]") {
+  hash<TInstant<float>> hash;
+  TInstant<float> instant(1.5, unix_time_point(2012, 1, 1));
+  REQUIRE(hash(instant) == hash(TInstant<float>("1.5@2012-01-01")));
+  REQUIRE(hash(instant) != hash(TInstant<float>(1.5, unix_time_point(2012, 1, 2))));
+  REQUIRE(hash(TInstant<float>(0.0, unix_time_point(2012, 1, 1)))
+          == hash(TInstant<float>(-0.0, unix_time_point(2012, 1, 1))));
+
+  TInstant<GeomPoint> point(GeomPoint(1.0, 2.0), unix_time_point(2012, 1, 1));
+  TInstant<GeomPoint> with_srid("SRID=4326;POINT(1 2)@2012-01-01");
+  REQUIRE(std::hash<TInstant<GeomPoint>>()(point)
+          != std::hash<TInstant<GeomPoint>>()(with_srid));
+  REQUIRE(std::hash<TInstant<GeomPoint>>()(point.with_srid(4326))
+          == std::hash<TInstant<GeomPoint>>()(with_srid));
+}
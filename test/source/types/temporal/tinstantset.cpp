@@ -1,4 +1,5 @@
 #include <catch2/catch.hpp>
+#include <meos/types/temporal/TInstant.hpp>
 #include <meos/types/temporal/TInstantSet.hpp>
 #include <sstream>
 #include <string>
@@ -43,6 +44,13 @@ TEMPLATE_TEST_CASE("TInstantSets are constructed properly", "[tinstset]", int, f
           set<string>{"10@2020-09-10 01:00:00+01", "20@2019-09-10 01:00:00+01"});
     }
 
+    SECTION("ordered vectors constructor") {
+      vector<time_point> timestamps = {unix_time_point(2019, 9, 10), unix_time_point(2019, 9, 10),
+                                       unix_time_point(2020, 9, 10)};
+      vector<TestType> values = {20, 20, 10};  // Duplicate!
+      instant_set = make_unique<TInstantSet<TestType>>(timestamps, values);
+    }
+
     REQUIRE(instant_set->instants().size() == 2);
 
     // We gave the instants out-of-order!
@@ -54,6 +62,38 @@ TEMPLATE_TEST_CASE("TInstantSets are constructed properly", "[tinstset]", int, f
   }
 }
 
+TEMPLATE_TEST_CASE("TInstantSet ordered vectors constructor validates its input", "[tinstset]",
+                   int, float) {
+  time_point t1 = unix_time_point(2019, 9, 10);
+  time_point t2 = unix_time_point(2020, 9, 10);
+
+  SECTION("mismatching lengths") {
+    REQUIRE_THROWS_AS((TInstantSet<TestType>{vector<time_point>{t1, t2}, vector<TestType>{1}}),
+                      invalid_argument);
+  }
+
+  SECTION("timestamps out of order") {
+    REQUIRE_THROWS_AS((TInstantSet<TestType>{vector<time_point>{t2, t1}, vector<TestType>{1, 2}}),
+                      invalid_argument);
+  }
+
+  SECTION("values out of order for the same timestamp") {
+    REQUIRE_THROWS_AS((TInstantSet<TestType>{vector<time_point>{t1, t1}, vector<TestType>{2, 1}}),
+                      invalid_argument);
+  }
+
+  SECTION("same instants as the set constructor") {
+    TInstantSet<TestType> from_vectors(vector<time_point>{t1, t1, t2}, vector<TestType>{1, 2, 3});
+    set<TInstant<TestType>> s
+        = {TInstant<TestType>(3, t2), TInstant<TestType>(2, t1), TInstant<TestType>(1, t1)};
+    TInstantSet<TestType> from_set(s);
+    REQUIRE(from_vectors == from_set);
+    REQUIRE(from_vectors.instants() == s);
+    REQUIRE(from_set.storedTimestamps() == vector<time_point>{t1, t1, t2});
+    REQUIRE(from_set.storedValues() == vector<TestType>{1, 2, 3});
+  }
+}
+
 TEST_CASE("TInstantSet<GeomPoint> constructors", "[tinstset]") {
   SECTION("without SRID") {
     TInstant<GeomPoint> instant(GeomPoint(20, 30), unix_time_point(2012, 11, 1));
@@ -345,6 +385,27 @@ TEMPLATE_TEST_CASE("TInstantSet period and timestamp related functions", "[tinst
   }
 }
 
+TEMPLATE_TEST_CASE("TInstantSet timestamp functions with repeated timestamps", "[tinstantset]",
+                   int, float) {
+  set<TInstant<TestType>> instants = {
+      TInstant<TestType>(1, unix_time_point(2012, 1, 1)),
+      TInstant<TestType>(2, unix_time_point(2012, 1, 1)),
+      TInstant<TestType>(3, unix_time_point(2012, 1, 2)),
+      TInstant<TestType>(4, unix_time_point(2012, 1, 3)),
+      TInstant<TestType>(5, unix_time_point(2012, 1, 3)),
+  };
+  TInstantSet<TestType> actual(instants);
+
+  REQUIRE(actual.numInstants() == 5);
+  REQUIRE(actual.numTimestamps() == 3);
+  REQUIRE(actual.timestampN(0) == unix_time_point(2012, 1, 1));
+  REQUIRE(actual.timestampN(1) == unix_time_point(2012, 1, 2));
+  REQUIRE(actual.timestampN(2) == unix_time_point(2012, 1, 3));
+  CHECK_THROWS(actual.timestampN(3));
+  REQUIRE(actual.valueN(1) == 2);
+  REQUIRE(actual.endValue() == 5);
+}
+
 TEMPLATE_TEST_CASE("TInstantSet.period() - gaps are ignored", "[tinstantset]", int, float) {
   set<TInstant<TestType>> instants = {
       TInstant<TestType>(1, unix_time_point(2012, 1, 1)),
@@ -465,3 +526,85 @@ TEMPLATE_TEST_CASE("TInstantSet intersection functions", "[tinstantset]", int, f
     REQUIRE(iset.intersectsPeriodSet(PeriodSet(s)) == false);
   }
 }
+
+TEMPLATE_TEST_CASE("TInstantSet values at timestamps", "[tinstantset]", int, float) {
+  TInstantSet<TestType> instant_set(
+      {unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 3), unix_time_point(2012, 1, 4)},
+      {10, 20, 30});
+
+  REQUIRE(instant_set.valueAtTimestamp(unix_time_point(2012, 1, 3)) == 20);
+  REQUIRE_THROWS_AS(instant_set.valueAtTimestamp(unix_time_point(2012, 1, 2)), invalid_argument);
+
+  vector<pair<TestType, time_point>> expected = {
+      {10, unix_time_point(2012, 1, 1)},
+      {30, unix_time_point(2012, 1, 4)},
+      {30, unix_time_point(2012, 1, 4)},
+  };
+  REQUIRE(instant_set.valuesAtTimestamps({unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 2),
+                                          unix_time_point(2012, 1, 4), unix_time_point(2012, 1, 4),
+                                          unix_time_point(2012, 1, 5)})
+          == expected);
+}
+
+TEMPLATE_TEST_CASE("TInstantSet restrictions", "[tinstset]", int, float) {
+  TInstantSet<TestType> instant_set("{10@2012-01-01, 20@2012-01-02, 30@2012-01-03}");
+
+  auto result = instant_set.atPeriod(Period("[2012-01-01, 2012-01-03)"));
+  REQUIRE(dynamic_cast<TInstantSet<TestType> const &>(*result)
+          == TInstantSet<TestType>("{10@2012-01-01, 20@2012-01-02}"));
+
+  result = instant_set.atPeriodSet(
+      PeriodSet("{(2012-01-01, 2012-01-02 12:00), [2012-01-03, 2012-01-04]}"));
+  REQUIRE(dynamic_cast<TInstantSet<TestType> const &>(*result)
+          == TInstantSet<TestType>("{20@2012-01-02, 30@2012-01-03}"));
+
+  result = instant_set.minusTimestamp(unix_time_point(2012, 1, 2));
+  REQUIRE(dynamic_cast<TInstantSet<TestType> const &>(*result)
+          == TInstantSet<TestType>("{10@2012-01-01, 30@2012-01-03}"));
+
+  result = instant_set.minusPeriod(Period("(2012-01-01, 2012-01-03]"));
+  REQUIRE(dynamic_cast<TInstantSet<TestType> const &>(*result)
+          == TInstantSet<TestType>("{10@2012-01-01}"));
+
+  result = instant_set.atTimestampSet(TimestampSet("{2012-01-02, 2012-01-02 12:00}"));
+  REQUIRE(dynamic_cast<TInstantSet<TestType> const &>(*result)
+          == TInstantSet<TestType>("{20@2012-01-02}"));
+
+  result = instant_set.atTimestamp(unix_time_point(2012, 1, 3));
+  REQUIRE(dynamic_cast<TInstant<TestType> const &>(*result)
+          == TInstant<TestType>(30, unix_time_point(2012, 1, 3)));
+
+  REQUIRE(instant_set.atPeriod(Period("(2012-01-01, 2012-01-02)")) == nullptr);
+  REQUIRE(instant_set.minusTimestampSet(TimestampSet("{2012-01-01, 2012-01-02, 2012-01-03}"))
+          == nullptr);
+}
+
+TEMPLATE_TEST_CASE("TInstantSet bounding box", "[tinstset]", int, float) {
+  TInstantSet<TestType> instant_set("{20@2012-01-01, 10@2012-01-02, 30@2012-01-03}");
+  REQUIRE(instant_set.boundingBox()
+          == TBox(10, unix_time_point(2012, 1, 1), 30, unix_time_point(2012, 1, 3)));
+  REQUIRE(instant_set.minValue() == 10);
+  REQUIRE(instant_set.maxValue() == 30);
+
+  TInstantSet<bool> bools("{t@2012-01-01, f@2012-01-02}");
+  REQUIRE(bools.boundingBox()
+          == Period(unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 2), true, true));
+}
+
+TEST_CASE("equal TInstantSets hash equally", "[tinstantset]") {
+  hash<TInstantSet<int>> hash;
+  TInstantSet<int> instant_set("{10@2012-01-01, 20@2012-01-02}");
+  TInstantSet<int> same({unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 2)}, {10, 20});
+  REQUIRE(hash(instant_set) == hash(same));
+  REQUIRE(hash(instant_set) != hash(TInstantSet<int>("{10@2012-01-01, 21@2012-01-02}")));
+  REQUIRE(hash(instant_set) != hash(TInstantSet<int>("{10@2012-01-01}")));
+}
+
+TEST_CASE("TInstantSet time-weighted average", "[tinstantset]") {
+  TInstantSet<int> instant_set("{1@2012-01-01, 2@2012-01-02, 6@2012-01-05}");
+  REQUIRE(instant_set.integral() == 0);
+  REQUIRE(instant_set.twAvg() == 3);
+
+  TInstantSet<GeomPoint> points("{POINT(0 0)@2012-01-01, POINT(2 4)@2012-01-05}");
+  REQUIRE(points.twCentroid() == GeomPoint(1, 2));
+}
@@ -1,9 +1,12 @@
 #include <catch2/catch.hpp>
 #include <meos/types/temporal/Interpolation.hpp>
+#include <meos/types/temporal/TInstantSet.hpp>
 #include <meos/types/temporal/TSequence.hpp>
+#include <meos/types/temporal/TSequenceSet.hpp>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 
 #include "../../common/matchers.hpp"
 #include "../../common/time_utils.hpp"
@@ -54,6 +57,12 @@ TEMPLATE_TEST_CASE("TSequences are constructed and serialized properly", "[tsequ
       seq = TSequence<TestType>("(10@2020-09-10 01:00:00+01, 20@2019-09-10 01:00:00+01]");
     }
 
+    SECTION("ordered vectors constructor") {
+      seq = TSequence<TestType>(
+          vector<time_point>{unix_time_point(2019, 9, 10), unix_time_point(2020, 9, 10)},
+          vector<TestType>{20, 10}, false, true);
+    }
+
     SECTION("with interpolation specified") {
       expected_interp = Interpolation::Stepwise;
 
@@ -74,6 +83,12 @@ TEMPLATE_TEST_CASE("TSequences are constructed and serialized properly", "[tsequ
             "Interp=Stepwise;(10@2020-09-10 01:00:00+01, "
             "20@2019-09-10 01:00:00+01]");
       }
+
+      SECTION("ordered vectors constructor") {
+        seq = TSequence<TestType>(
+            vector<time_point>{unix_time_point(2019, 9, 10), unix_time_point(2020, 9, 10)},
+            vector<TestType>{20, 10}, false, true, Interpolation::Stepwise);
+      }
     }
 
     REQUIRE(seq.instants().size() == 2);
@@ -307,6 +322,19 @@ TEMPLATE_TEST_CASE("TSequence comparision operators", "[tsequence]", int, float)
       REQUIRE(!(lhs > rhs));
     }
   }
+  SECTION("different bounds") {
+    set<TInstant<TestType>> instants = {
+        TInstant<TestType>(1, unix_time_point(2012, 1, 1)),
+        TInstant<TestType>(2, unix_time_point(2012, 1, 2)),
+    };
+    TSequence<TestType> lhs(instants, true, false);
+    TSequence<TestType> rhs(instants, false, true);
+    REQUIRE(lhs != rhs);
+    REQUIRE(lhs < rhs);
+    REQUIRE(!(rhs < lhs));
+    REQUIRE(rhs > lhs);
+    REQUIRE(!(lhs > rhs));
+  }
 }
 
 TEMPLATE_TEST_CASE("TSequence duration function returns Sequence", "[tsequence]", int, float, bool,
@@ -573,3 +601,373 @@ TEST_CASE("TSequence<GeomPoint> with_srid", "[tsequence]") {
   REQUIRE(g.startInstant().srid() == 4326);
   REQUIRE(g.startValue().srid() == 4326);
 }
+
+TEMPLATE_TEST_CASE("TSequence stepwise values at timestamps", "[tsequence]", int, float) {
+  TSequence<TestType> seq({unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 3),
+                           unix_time_point(2012, 1, 4)},
+                          {10, 20, 30}, false, true, Interpolation::Stepwise);
+
+  REQUIRE(seq.valueAtTimestamp(unix_time_point(2012, 1, 2)) == 10);
+  REQUIRE(seq.valueAtTimestamp(unix_time_point(2012, 1, 3)) == 20);
+  REQUIRE(seq.valueAtTimestamp(unix_time_point(2012, 1, 3, 12)) == 20);
+  REQUIRE(seq.valueAtTimestamp(unix_time_point(2012, 1, 4)) == 30);
+  REQUIRE_THROWS_AS(seq.valueAtTimestamp(unix_time_point(2012, 1, 1)), invalid_argument);
+  REQUIRE_THROWS_AS(seq.valueAtTimestamp(unix_time_point(2012, 1, 5)), invalid_argument);
+
+  vector<pair<TestType, time_point>> expected = {
+      {10, unix_time_point(2012, 1, 2)},
+      {20, unix_time_point(2012, 1, 3)},
+      {20, unix_time_point(2012, 1, 3, 12)},
+      {30, unix_time_point(2012, 1, 4)},
+  };
+  REQUIRE(seq.valuesAtTimestamps({unix_time_point(2011, 12, 31), unix_time_point(2012, 1, 1),
+                                  unix_time_point(2012, 1, 2), unix_time_point(2012, 1, 3),
+                                  unix_time_point(2012, 1, 3, 12), unix_time_point(2012, 1, 4),
+                                  unix_time_point(2012, 1, 5)})
+          == expected);
+  REQUIRE_THROWS_AS(
+      seq.valuesAtTimestamps({unix_time_point(2012, 1, 3), unix_time_point(2012, 1, 2)}),
+      invalid_argument);
+}
+
+TEST_CASE("TSequence linear values at timestamps", "[tsequence]") {
+  SECTION("float") {
+    TSequence<float> seq({unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 3),
+                          unix_time_point(2012, 1, 4)},
+                         {10, 20, 5}, true, true);
+    REQUIRE(seq.valueAtTimestamp(unix_time_point(2012, 1, 1)) == 10);
+    REQUIRE(seq.valueAtTimestamp(unix_time_point(2012, 1, 2)) == 15);
+    REQUIRE(seq.valueAtTimestamp(unix_time_point(2012, 1, 3, 12)) == 12.5);
+    REQUIRE(seq.valueAtTimestamp(unix_time_point(2012, 1, 4)) == 5);
+
+    // Resampling at a fixed rate
+    vector<time_point> timestamps;
+    for (int h = 0; h <= 72; h += 6) timestamps.push_back(unix_time_point(2012, 1, 1, h));
+    auto values = seq.valuesAtTimestamps(timestamps);
+    REQUIRE(values.size() == timestamps.size());
+    for (auto const &value : values) {
+      REQUIRE(value.first == Approx(seq.valueAtTimestamp(value.second)));
+    }
+    REQUIRE(values[2].first == 12.5);
+  }
+
+  SECTION("GeomPoint") {
+    TSequence<GeomPoint> seq({unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 5)},
+                             {GeomPoint(0, 0, 4326), GeomPoint(4, -8, 4326)}, true, true);
+    REQUIRE(seq.valueAtTimestamp(unix_time_point(2012, 1, 2)) == GeomPoint(1, -2, 4326));
+
+    auto values
+        = seq.valuesAtTimestamps({unix_time_point(2012, 1, 3), unix_time_point(2012, 1, 4)});
+    REQUIRE(values.size() == 2);
+    REQUIRE(values[0].first == GeomPoint(2, -4, 4326));
+    REQUIRE(values[1].first == GeomPoint(3, -6, 4326));
+
+    TSequence<GeomPoint> seq3d({unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 3)},
+                               {GeomPoint(0, 0, 0, 0), GeomPoint(2, 2, 10, 0)}, true, true);
+    REQUIRE(seq3d.valueAtTimestamp(unix_time_point(2012, 1, 2)) == GeomPoint(1, 1, 5, 0));
+  }
+}
+
+TEST_CASE("TSequence linear restrictions", "[tsequence]") {
+  TSequence<float> seq("[10@2012-01-01, 20@2012-01-03, 5@2012-01-04)");
+
+  SECTION("atPeriod cuts the segments at the bounds") {
+    auto result = seq.atPeriod(Period("[2012-01-02, 2012-01-03 12:00)"));
+    REQUIRE(dynamic_cast<TSequence<float> const &>(*result)
+            == TSequence<float>("[15@2012-01-02, 20@2012-01-03, 12.5@2012-01-03 12:00)"));
+
+    result = seq.atPeriod(Period("[2012-01-03, 2012-01-05]"));
+    REQUIRE(dynamic_cast<TSequence<float> const &>(*result)
+            == TSequence<float>("[20@2012-01-03, 5@2012-01-04)"));
+
+    result = seq.atPeriod(Period("[2012-01-03, 2012-01-03]"));
+    REQUIRE(dynamic_cast<TSequence<float> const &>(*result)
+            == TSequence<float>("[20@2012-01-03]"));
+
+    result = seq.atPeriod(Period("[2011-12-01, 2012-02-01]"));
+    REQUIRE(dynamic_cast<TSequence<float> const &>(*result) == seq);
+
+    REQUIRE(seq.atPeriod(Period("[2012-01-04, 2012-01-05]")) == nullptr);
+    REQUIRE(seq.atPeriod(Period("[2011-12-01, 2012-01-01)")) == nullptr);
+  }
+
+  SECTION("atPeriodSet") {
+    auto result = seq.atPeriodSet(
+        PeriodSet("{[2012-01-01, 2012-01-02], [2012-01-03 12:00, 2012-01-05]}"));
+    REQUIRE(dynamic_cast<TSequenceSet<float> const &>(*result)
+            == TSequenceSet<float>(
+                "{[10@2012-01-01, 15@2012-01-02], [12.5@2012-01-03 12:00, 5@2012-01-04)}"));
+
+    // Overlapping periods are merged first
+    result = seq.atPeriodSet(PeriodSet("{[2012-01-01, 2012-01-02], [2012-01-02, 2012-01-03)}"));
+    REQUIRE(dynamic_cast<TSequence<float> const &>(*result)
+            == TSequence<float>("[10@2012-01-01, 20@2012-01-03)"));
+
+    REQUIRE(seq.atPeriodSet(PeriodSet("{[2013-01-01, 2013-01-02]}")) == nullptr);
+  }
+
+  SECTION("minus") {
+    auto result = seq.minusTimestamp(unix_time_point(2012, 1, 2));
+    REQUIRE(dynamic_cast<TSequenceSet<float> const &>(*result)
+            == TSequenceSet<float>("{[10@2012-01-01, 15@2012-01-02), "
+                                   "(15@2012-01-02, 20@2012-01-03, 5@2012-01-04)}"));
+
+    result = seq.minusTimestampSet(TimestampSet("{2012-01-01, 2012-01-03}"));
+    REQUIRE(dynamic_cast<TSequenceSet<float> const &>(*result)
+            == TSequenceSet<float>("{(10@2012-01-01, 20@2012-01-03), "
+                                   "(20@2012-01-03, 5@2012-01-04)}"));
+
+    result = seq.minusPeriod(Period("[2012-01-02, 2012-01-03]"));
+    REQUIRE(dynamic_cast<TSequenceSet<float> const &>(*result)
+            == TSequenceSet<float>("{[10@2012-01-01, 15@2012-01-02), "
+                                   "(20@2012-01-03, 5@2012-01-04)}"));
+
+    result = seq.minusPeriod(Period("[2012-01-02, 2012-02-01]"));
+    REQUIRE(dynamic_cast<TSequence<float> const &>(*result)
+            == TSequence<float>("[10@2012-01-01, 15@2012-01-02)"));
+
+    result = seq.minusPeriodSet(PeriodSet("{[2011-01-01, 2012-01-02), (2012-01-03, 2012-02-01]}"));
+    REQUIRE(dynamic_cast<TSequence<float> const &>(*result)
+            == TSequence<float>("[15@2012-01-02, 20@2012-01-03]"));
+
+    REQUIRE(seq.minusPeriod(Period("[2012-01-01, 2012-01-04]")) == nullptr);
+  }
+
+  SECTION("at timestamps") {
+    auto result = seq.atTimestamp(unix_time_point(2012, 1, 2));
+    REQUIRE(dynamic_cast<TInstant<float> const &>(*result)
+            == TInstant<float>(15, unix_time_point(2012, 1, 2)));
+    REQUIRE(seq.atTimestamp(unix_time_point(2012, 1, 4)) == nullptr);
+
+    result = seq.atTimestampSet(TimestampSet("{2012-01-02, 2012-01-03, 2012-01-04}"));
+    REQUIRE(dynamic_cast<TInstantSet<float> const &>(*result)
+            == TInstantSet<float>("{15@2012-01-02, 20@2012-01-03}"));
+    REQUIRE(seq.atTimestampSet(TimestampSet("{2012-01-04}")) == nullptr);
+  }
+
+  SECTION("GeomPoint keeps the SRID") {
+    TSequence<GeomPoint> g("SRID=4326;[POINT(0 0)@2012-01-01, POINT(4 -8)@2012-01-05]");
+    auto result = g.atPeriod(Period("[2012-01-02, 2012-01-03]"));
+    REQUIRE(dynamic_cast<TSequence<GeomPoint> const &>(*result)
+            == TSequence<GeomPoint>("SRID=4326;[POINT(1 -2)@2012-01-02, POINT(2 -4)@2012-01-03]"));
+  }
+}
+
+TEMPLATE_TEST_CASE("TSequence stepwise restrictions", "[tsequence]", int, float) {
+  TSequence<TestType> seq("Interp=Stepwise;[10@2012-01-01, 20@2012-01-03, 30@2012-01-04]");
+
+  // The value is held up to an exclusive cut
+  auto result = seq.atPeriod(Period("[2012-01-02, 2012-01-03)"));
+  REQUIRE(dynamic_cast<TSequence<TestType> const &>(*result)
+          == TSequence<TestType>("Interp=Stepwise;[10@2012-01-02, 10@2012-01-03)"));
+
+  result = seq.atPeriod(Period("[2012-01-02, 2012-01-03]"));
+  REQUIRE(dynamic_cast<TSequence<TestType> const &>(*result)
+          == TSequence<TestType>("Interp=Stepwise;[10@2012-01-02, 20@2012-01-03]"));
+
+  result = seq.minusPeriod(Period("[2011-01-01, 2012-01-03]"));
+  REQUIRE(dynamic_cast<TSequence<TestType> const &>(*result)
+          == TSequence<TestType>("Interp=Stepwise;(20@2012-01-03, 30@2012-01-04]"));
+}
+
+TEST_CASE("TSequence bounding box", "[tsequence]") {
+  TSequence<float> seq("(20@2012-01-01, 10.5@2012-01-02, 30@2012-01-03)");
+  REQUIRE(seq.boundingBox()
+          == TBox(10.5, unix_time_point(2012, 1, 1), 30, unix_time_point(2012, 1, 3)));
+  REQUIRE(seq.minValue() == 10.5);
+  REQUIRE(seq.maxValue() == 30);
+  REQUIRE(*seq.getValues().begin() == Range<float>(10.5, 30, false, false));
+
+  // The box follows the changes of SRID
+  TSequence<GeomPoint> g("[POINT(0 0 1)@2012-01-01, POINT(4 -8 3)@2012-01-05]");
+  REQUIRE(g.boundingBox()
+          == STBox(0, -8, 1, unix_time_point(2012, 1, 1), 4, 0, 3, unix_time_point(2012, 1, 5)));
+  REQUIRE(g.with_srid(4326).boundingBox().srid() == 4326);
+
+  TSequence<string> texts("[A@2012-01-01, B@2012-01-05)");
+  REQUIRE(texts.boundingBox()
+          == Period(unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 5), true, false));
+}
+
+TEST_CASE("equal TSequences hash equally", "[tsequence]") {
+  hash<TSequence<float>> hash;
+  TSequence<float> sequence("[1@2012-01-01, 2@2012-01-02)");
+  REQUIRE(hash(sequence) == hash(TSequence<float>({unix_time_point(2012, 1, 1),
+                                                   unix_time_point(2012, 1, 2)},
+                                                  {1, 2}, true, false)));
+  REQUIRE(hash(sequence) != hash(TSequence<float>("[1@2012-01-01, 2@2012-01-02]")));
+  REQUIRE(hash(sequence)
+          != hash(TSequence<float>("Interp=Stepwise;[1@2012-01-01, 2@2012-01-02)")));
+
+  // Through the base class, e.g, for values read without knowing their duration
+  unique_ptr<Temporal<float>> temporal = sequence.clone();
+  REQUIRE(std::hash<Temporal<float>>()(*temporal) == hash(sequence));
+
+  unordered_set<TSequence<float>> sequences{sequence, TSequence<float>(sequence)};
+  REQUIRE(sequences.size() == 1);
+}
+
+TEST_CASE("TSequence<GeomPoint> simplification", "[tsequence]") {
+  SECTION("points close to the segment are dropped") {
+    TSequence<GeomPoint> sequence(
+        "SRID=4326;(POINT(0 0)@2012-01-01 00:00, POINT(1 0.1)@2012-01-01 00:01, "
+        "POINT(2 -0.1)@2012-01-01 00:02, POINT(3 0)@2012-01-01 00:03]");
+    auto synchronized = GENERATE(true, false);
+    TSequence<GeomPoint> simplified = sequence.simplify(0.5, synchronized);
+    REQUIRE(simplified.numInstants() == 2);
+    REQUIRE(simplified.startValue() == GeomPoint(0.0, 0.0, 4326));
+    REQUIRE(simplified.endValue() == GeomPoint(3.0, 0.0, 4326));
+    REQUIRE(simplified.lower_inc() == false);
+    REQUIRE(simplified.upper_inc() == true);
+    REQUIRE(simplified.srid() == 4326);
+    REQUIRE(simplified.interpolation() == Interpolation::Linear);
+
+    REQUIRE(sequence.simplify(0.05, synchronized) == sequence);
+    REQUIRE_THROWS_AS(sequence.simplify(-1, synchronized), invalid_argument);
+  }
+
+  SECTION("the synchronized distance also takes time into account") {
+    // On a straight line, but not at a constant speed
+    TSequence<GeomPoint> sequence(
+        "[POINT(0 0)@2012-01-01 00:00, POINT(1 0)@2012-01-01 00:01, "
+        "POINT(2 0)@2012-01-01 00:09, POINT(3 0)@2012-01-01 00:10]");
+    REQUIRE(sequence.simplify(0.5).numInstants() == 2);
+    REQUIRE(sequence.simplify(0.5, true) == sequence);
+    REQUIRE(sequence.simplify(0.75, true).numInstants() == 2);
+  }
+
+  SECTION("stepwise sequences keep the changes of position") {
+    TSequence<GeomPoint> sequence(
+        "Interp=Stepwise;[POINT(0 0)@2012-01-01, POINT(0 0)@2012-01-02, POINT(1 1)@2012-01-03, "
+        "POINT(1 1)@2012-01-04]");
+    TSequence<GeomPoint> simplified = sequence.simplify(0.5);
+    REQUIRE(simplified.numInstants() == 3);
+    REQUIRE(simplified.interpolation() == Interpolation::Stepwise);
+    REQUIRE(simplified.valueAtTimestamp(unix_time_point(2012, 1, 3, 12)) == GeomPoint(1.0, 1.0));
+  }
+
+  SECTION("long zigzags are simplified without recursion") {
+    size_t const n = 10000;
+    vector<time_point> timestamps;
+    vector<GeomPoint> points;
+    for (size_t i = 0; i < n; i++) {
+      timestamps.push_back(unix_time_point(2012, 1, 1) + chrono::seconds(i));
+      points.emplace_back(static_cast<double>(i), i % 2 == 0 ? 0.0 : 1.0);
+    }
+    TSequence<GeomPoint> sequence(timestamps, points, true, true);
+    REQUIRE(sequence.simplify(0.1).numInstants() == n);
+    REQUIRE(sequence.simplify(1.1).numInstants() == 2);
+  }
+}
+
+TEST_CASE("TSequence<float> simplification", "[tsequence]") {
+  SECTION("values close to the segment are dropped") {
+    TSequence<float> sequence(
+        "[1@2012-01-01 00:00, 2@2012-01-01 00:01, 3@2012-01-01 00:02, 4@2012-01-01 00:03, "
+        "0@2012-01-01 00:04)");
+    TSequence<float> simplified = sequence.simplify(0.1);
+    REQUIRE(simplified
+            == TSequence<float>("[1@2012-01-01 00:00, 4@2012-01-01 00:03, 0@2012-01-01 00:04)"));
+    REQUIRE(sequence.simplify(4).numInstants() == 2);
+  }
+
+  SECTION("speed changes beyond the tolerance are kept") {
+    // Speeds of 1, 1.1 and 0.9 per second
+    TSequence<float> sequence(
+        "[0@2012-01-01 00:00:00, 10@2012-01-01 00:00:10, 21@2012-01-01 00:00:20, "
+        "30@2012-01-01 00:00:30]");
+    REQUIRE(sequence.simplifyMaxSpeed(0.2).numInstants() == 2);
+    REQUIRE(sequence.simplifyMaxSpeed(0.05) == sequence);
+    REQUIRE(sequence.simplify(0.5).numInstants() == 3);
+    REQUIRE_THROWS_AS(sequence.with_interp(Interpolation::Stepwise).simplifyMaxSpeed(0.2),
+                      invalid_argument);
+  }
+}
+
+TEST_CASE("TSequence<GeomPoint> length, speed and azimuth", "[tsequence]") {
+  TSequence<GeomPoint> sequence(
+      "[POINT(0 0)@2012-01-01 00:00, POINT(3 4)@2012-01-01 00:01, POINT(3 4)@2012-01-01 00:02, "
+      "POINT(3 0)@2012-01-01 00:03]");
+
+  SECTION("length") {
+    REQUIRE(sequence.length() == 9);
+    REQUIRE(sequence.cumulativeLength()
+            == TSequence<float>("[0@2012-01-01 00:00, 5@2012-01-01 00:01, 5@2012-01-01 00:02, "
+                                "9@2012-01-01 00:03]"));
+    REQUIRE(TSequence<GeomPoint>("[POINT(0 0 0)@2012-01-01, POINT(1 2 2)@2012-01-02]").length()
+            == 3);
+  }
+
+  SECTION("speed") {
+    unique_ptr<TSequence<float>> speed = sequence.speed();
+    REQUIRE(speed->interpolation() == Interpolation::Stepwise);
+    REQUIRE(speed->numInstants() == 4);
+    REQUIRE(speed->valueAtTimestamp(unix_time_point(2012, 1, 1, 0, 0, 30)) == Approx(5.0 / 60));
+    REQUIRE(speed->valueAtTimestamp(unix_time_point(2012, 1, 1, 0, 1, 30)) == 0);
+    REQUIRE(speed->endValue() == Approx(4.0 / 60));
+    REQUIRE(TSequence<GeomPoint>("[POINT(0 0)@2012-01-01]").speed() == nullptr);
+  }
+
+  SECTION("azimuth") {
+    unique_ptr<TSequenceSet<float>> azimuth = sequence.azimuth();
+    REQUIRE(azimuth->numSequences() == 2);
+    REQUIRE(azimuth->interpolation() == Interpolation::Stepwise);
+    REQUIRE(azimuth->valueAtTimestamp(unix_time_point(2012, 1, 1, 0, 0, 30))
+            == Approx(atan2(3, 4)));
+    REQUIRE(azimuth->endValue() == Approx(acos(-1.0)));
+    REQUIRE_FALSE(azimuth->intersectsTimestamp(unix_time_point(2012, 1, 1, 0, 1, 30)));
+    REQUIRE(azimuth->getTime()
+            == PeriodSet(set<string>{"[2012-01-01 00:00, 2012-01-01 00:01)",
+                                     "[2012-01-01 00:02, 2012-01-01 00:03]"}));
+    REQUIRE(TSequence<GeomPoint>("[POINT(1 1)@2012-01-01, POINT(1 1)@2012-01-02]").azimuth()
+            == nullptr);
+  }
+
+  SECTION("points don't move along stepwise sequences") {
+    TSequence<GeomPoint> stepwise = sequence.with_interp(Interpolation::Stepwise);
+    REQUIRE(stepwise.length() == 0);
+    REQUIRE(stepwise.cumulativeLength().maxValue() == 0);
+    REQUIRE(stepwise.speed()->maxValue() == 0);
+    REQUIRE(stepwise.azimuth() == nullptr);
+  }
+}
+
+TEST_CASE("TSequence integral and time-weighted average", "[tsequence]") {
+  // Sampled irregularly, so that the plain average of the values, 20/3, is off
+  TSequence<float> linear("[0@2012-01-01 00:00, 10@2012-01-01 00:01, 10@2012-01-01 00:03]");
+  REQUIRE(linear.integral() == Approx(5 * 60 + 10 * 120));
+  REQUIRE(linear.twAvg() == Approx(1500.0 / 180));
+
+  TSequence<float> stepwise = linear.with_interp(Interpolation::Stepwise);
+  REQUIRE(stepwise.integral() == Approx(10 * 120));
+  REQUIRE(stepwise.twAvg() == Approx(1200.0 / 180));
+
+  TSequence<int> days("[1@2012-01-01, 3@2012-01-02, 3@2012-01-04)");
+  REQUIRE(days.integral() == Approx(7 * 86400));
+  REQUIRE(days.twAvg() == Approx(7.0 / 3));
+
+  TSequence<float> instantaneous("[5@2012-01-01]");
+  REQUIRE(instantaneous.integral() == 0);
+  REQUIRE(instantaneous.twAvg() == 5);
+}
+
+TEST_CASE("TSequence<GeomPoint> time-weighted centroid", "[tsequence]") {
+  TSequence<GeomPoint> sequence(
+      "SRID=4326;[POINT(0 0)@2012-01-01 00:00, POINT(2 0)@2012-01-01 00:01, "
+      "POINT(2 2)@2012-01-01 00:03]");
+  GeomPoint centroid = sequence.twCentroid();
+  REQUIRE(centroid.x() == Approx(300.0 / 180));
+  REQUIRE(centroid.y() == Approx(120.0 / 180));
+  REQUIRE_FALSE(centroid.has_z());
+  REQUIRE(centroid.srid() == 4326);
+
+  centroid = sequence.with_interp(Interpolation::Stepwise).twCentroid();
+  REQUIRE(centroid.x() == Approx(240.0 / 180));
+  REQUIRE(centroid.y() == 0);
+
+  TSequence<GeomPoint> with_z("[POINT(0 0 0)@2012-01-01, POINT(2 4 6)@2012-01-02]");
+  centroid = with_z.twCentroid();
+  REQUIRE(centroid.has_z());
+  REQUIRE(centroid.z() == Approx(3));
+  REQUIRE(TSequence<GeomPoint>("[POINT(1 2)@2012-01-01]").twCentroid() == GeomPoint(1, 2));
+}
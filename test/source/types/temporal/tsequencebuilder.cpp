@@ -0,0 +1,167 @@
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <meos/types/geom/GeomPoint.hpp>
+#include <meos/types/temporal/Interpolation.hpp>
+#include <meos/types/temporal/TSequenceBuilder.hpp>
+#include <meos/types/temporal/TSequenceSetBuilder.hpp>
+#include <set>
+#include <string>
+
+#include "../../common/time_utils.hpp"
+
+using namespace meos;
+using namespace std;
+
+TEMPLATE_TEST_CASE("TSequenceBuilder appends instants", "[tsequencebuilder]", int, float) {
+  set<TInstant<TestType>> instants = {
+      TInstant<TestType>(10, unix_time_point(2012, 1, 1)),
+      TInstant<TestType>(30, unix_time_point(2012, 1, 2)),
+      TInstant<TestType>(20, unix_time_point(2012, 1, 3)),
+  };
+  TSequenceBuilder<TestType> builder(Interpolation::Stepwise);
+  for (auto const &instant : instants) builder.append(instant);
+
+  SECTION("ends up as from a set") {
+    TSequence<TestType> expected(instants, true, true, Interpolation::Stepwise);
+    TSequence<TestType> sequence = builder.build();
+    REQUIRE(sequence == expected);
+    REQUIRE(sequence.interpolation() == Interpolation::Stepwise);
+    REQUIRE(sequence.boundingBox() == expected.boundingBox());
+    REQUIRE(builder.empty());
+    CHECK_THROWS(builder.build());
+  }
+
+  SECTION("instants must come in order") {
+    CHECK_THROWS(builder.append(40, unix_time_point(2012, 1, 3)));
+    CHECK_THROWS(builder.append(40, unix_time_point(2012, 1, 2)));
+    REQUIRE(builder.size() == 3);
+  }
+
+  SECTION("snapshots leave the builder as it was") {
+    TSequence<TestType> before = builder.snapshot();
+    builder.append(40, unix_time_point(2012, 1, 4));
+    TSequence<TestType> after = builder.snapshot();
+    REQUIRE(before.numInstants() == 3);
+    REQUIRE(after.numInstants() == 4);
+    REQUIRE(after.maxValue() == 40);
+    REQUIRE(builder.endInstant() == TInstant<TestType>(40, unix_time_point(2012, 1, 4)));
+  }
+
+  SECTION("snapshots share the instants instead of copying them") {
+    builder.reserve(4);
+    TSequence<TestType> before = builder.snapshot();
+    builder.append(40, unix_time_point(2012, 1, 4));
+    TSequence<TestType> after = builder.snapshot();
+    REQUIRE(before.sharesInstants(after));
+
+    // Growing past the room left moves the builder to new storage
+    builder.append(50, unix_time_point(2012, 1, 5));
+    TSequence<TestType> sequence = builder.build();
+    REQUIRE(!sequence.sharesInstants(after));
+    REQUIRE(before == TSequence<TestType>(instants, true, true, Interpolation::Stepwise));
+    REQUIRE(after.numInstants() == 4);
+    REQUIRE(after.endInstant() == TInstant<TestType>(40, unix_time_point(2012, 1, 4)));
+    REQUIRE(sequence.numInstants() == 5);
+  }
+}
+
+TEST_CASE("TSequenceBuilder checks interpolation and SRIDs", "[tsequencebuilder]") {
+  CHECK_THROWS(TSequenceBuilder<int>(Interpolation::Linear));
+
+  TSequenceBuilder<GeomPoint> builder;
+  builder.append(GeomPoint(0.0, 0.0, 4326), unix_time_point(2012, 1, 1));
+  builder.append(GeomPoint(1.0, 1.0), unix_time_point(2012, 1, 2));
+  builder.append(GeomPoint(2.0, 2.0), unix_time_point(2012, 1, 3));
+  CHECK_THROWS(builder.append(GeomPoint(3.0, 3.0, 3857), unix_time_point(2012, 1, 4)));
+
+  TSequence<GeomPoint> sequence = builder.build();
+  REQUIRE(sequence.srid() == 4326);
+  REQUIRE(sequence.endValue().srid() == 4326);
+  REQUIRE(sequence.boundingBox() == STBox(0, 0, unix_time_point(2012, 1, 1), 2, 2,
+                                   unix_time_point(2012, 1, 3), 4326));
+
+  builder.append(GeomPoint(0.0, 0.0), unix_time_point(2012, 1, 5));
+  REQUIRE(builder.endInstant().getValue().srid() == 4326);
+
+  TSequenceBuilder<GeomPoint> without_srid;
+  without_srid.append(GeomPoint(0.0, 0.0), unix_time_point(2012, 1, 1));
+  CHECK_THROWS(without_srid.append(GeomPoint(1.0, 1.0, 4326), unix_time_point(2012, 1, 2)));
+}
+
+TEST_CASE("TSequenceSetBuilder splits sequences on gaps", "[tsequencebuilder]") {
+  auto const day = chrono::duration_cast<duration_ms>(chrono::hours(24));
+
+  SECTION("time gaps") {
+    TSequenceSetBuilder<float> builder(day);
+    builder.append(1, unix_time_point(2012, 1, 1));
+    builder.append(2, unix_time_point(2012, 1, 2));
+    builder.append(3, unix_time_point(2012, 1, 4));
+    builder.append(4, unix_time_point(2012, 1, 5));
+    REQUIRE(builder.numInstants() == 4);
+    REQUIRE(builder.numSequences() == 2);
+    CHECK_THROWS(builder.append(5, unix_time_point(2012, 1, 5)));
+
+    TSequenceSet<float> sequence_set = builder.build();
+    REQUIRE(sequence_set.numSequences() == 2);
+    REQUIRE(sequence_set.startSequence().endTimestamp() == unix_time_point(2012, 1, 2));
+    REQUIRE(sequence_set.endSequence().startTimestamp() == unix_time_point(2012, 1, 4));
+    REQUIRE(builder.numSequences() == 0);
+  }
+
+  SECTION("distance gaps") {
+    TSequenceSetBuilder<GeomPoint> builder(duration_ms::max(), 5);
+    builder.append(GeomPoint(0.0, 0.0, 4326), unix_time_point(2012, 1, 1));
+    builder.append(GeomPoint(3.0, 4.0), unix_time_point(2012, 1, 2));
+    builder.append(GeomPoint(9.0, 4.0), unix_time_point(2012, 1, 3));
+    REQUIRE(builder.numSequences() == 2);
+
+    TSequenceSet<GeomPoint> sequence_set = builder.snapshot();
+    REQUIRE(sequence_set.numSequences() == 2);
+    REQUIRE(sequence_set.srid() == 4326);
+    REQUIRE(sequence_set.numInstants() == 3);
+  }
+
+  SECTION("instants must come in order, even across a gap") {
+    TSequenceSetBuilder<float> builder(duration_ms::max(), 5);
+    builder.append(1, unix_time_point(2012, 1, 1));
+    builder.append(2, unix_time_point(2012, 1, 3));
+    CHECK_THROWS(builder.append(100, unix_time_point(2012, 1, 2)));
+    CHECK_THROWS(builder.append(100, unix_time_point(2012, 1, 3)));
+    REQUIRE(builder.numInstants() == 2);
+    REQUIRE(builder.numSequences() == 1);
+    REQUIRE(builder.snapshot().numInstants() == 2);
+  }
+
+  SECTION("snapshots keep up with appends") {
+    TSequenceSetBuilder<int> builder(day, numeric_limits<double>::infinity(),
+                                     Interpolation::Stepwise);
+    CHECK_THROWS(builder.snapshot());
+    builder.append(1, unix_time_point(2012, 1, 1));
+    REQUIRE(builder.snapshot().numInstants() == 1);
+    builder.append(2, unix_time_point(2012, 1, 3));
+    TSequenceSet<int> sequence_set = builder.snapshot();
+    REQUIRE(sequence_set.numSequences() == 2);
+    REQUIRE(sequence_set.interpolation() == Interpolation::Stepwise);
+    REQUIRE(builder.numInstants() == 2);
+  }
+
+  SECTION("snapshots share the instants of all the sequences") {
+    TSequenceSetBuilder<float> builder(day);
+    builder.append(1, unix_time_point(2012, 1, 1));
+    builder.append(2, unix_time_point(2012, 1, 2));
+    builder.append(3, unix_time_point(2012, 1, 4));
+    builder.append(4, unix_time_point(2012, 1, 5));
+    builder.append(5, unix_time_point(2012, 1, 6));
+    TSequenceSet<float> before = builder.snapshot();
+    builder.append(6, unix_time_point(2012, 1, 7));
+    TSequenceSet<float> after = builder.snapshot();
+
+    // The open sequence still has room for the instant appended in between
+    auto const &closed = *before.orderedSequences().front();
+    auto const &open = *before.orderedSequences().back();
+    REQUIRE(closed.sharesInstants(*after.orderedSequences().front()));
+    REQUIRE(open.sharesInstants(*after.orderedSequences().back()));
+    REQUIRE(open.numInstants() == 3);
+    REQUIRE(after.orderedSequences().back()->numInstants() == 4);
+  }
+}
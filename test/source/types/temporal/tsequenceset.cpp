@@ -414,6 +414,7 @@ TEMPLATE_TEST_CASE("TSequenceSet getTime and timespan", "[tsequenceset]", int, f
   SECTION("sequence functions") {
     REQUIRE(actual.numSequences() == sequences.size());
     REQUIRE_THAT(actual.sequences(), UnorderedEquals(sequences));
+    REQUIRE(actual.storedSequences() == actual.sequences());
     if (size > 0) {
       REQUIRE(actual.startSequence() == *sequences.begin());
       REQUIRE(actual.endSequence() == *sequences.rbegin());
@@ -467,6 +468,68 @@ TEMPLATE_TEST_CASE("TSequenceSet getTime and timespan", "[tsequenceset]", int, f
   }
 }
 
+TEMPLATE_TEST_CASE("TSequenceSet instant functions with touching and overlapping sequences",
+                   "[tsequenceset]", int, float) {
+  TSequence<TestType> first({unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 2)}, {10, 20});
+  TSequence<TestType> second;
+
+  SECTION("sharing a boundary instant") {
+    second = TSequence<TestType>(
+        {unix_time_point(2012, 1, 2), unix_time_point(2012, 1, 3), unix_time_point(2012, 1, 4)},
+        {20, 30, 40});
+  }
+
+  SECTION("touching with a value drop") {
+    second = TSequence<TestType>(
+        {unix_time_point(2012, 1, 2), unix_time_point(2012, 1, 3), unix_time_point(2012, 1, 4)},
+        {5, 30, 40});
+  }
+
+  SECTION("overlapping") {
+    second = TSequence<TestType>(
+        {unix_time_point(2011, 12, 31), unix_time_point(2012, 1, 2), unix_time_point(2012, 1, 4)},
+        {15, 20, 40});
+  }
+
+  TSequenceSet<TestType> actual(set<TSequence<TestType>>{first, second});
+  set<TInstant<TestType>> instants = actual.instants();
+  set<time_point> timestamps = actual.timestamps();
+
+  REQUIRE(actual.numInstants() == instants.size());
+  size_t i = 0;
+  for (auto const &e : instants) REQUIRE(actual.instantN(i++) == e);
+  CHECK_THROWS(actual.instantN(i));
+
+  REQUIRE(actual.numTimestamps() == timestamps.size());
+  i = 0;
+  for (auto const &e : timestamps) REQUIRE(actual.timestampN(i++) == e);
+  CHECK_THROWS(actual.timestampN(i));
+
+  REQUIRE(actual.startTimestamp() == *timestamps.begin());
+  REQUIRE(actual.endTimestamp() == *timestamps.rbegin());
+}
+
+TEST_CASE("TSequenceSet sequences in order of time", "[tsequenceset]") {
+  // Stored by number of instants first
+  TSequenceSet<float> seqset("{[1@2012-01-01, 2@2012-01-02, 3@2012-01-03], [4@2012-01-04]}");
+  TSequenceSet<float> copy(seqset);
+  seqset = TSequenceSet<float>("{[1@2012-01-01, 1@2012-01-02], (5@2012-01-02, 5@2012-01-03]}");
+
+  vector<time_point> starts;
+  for (auto const *e : copy.orderedSequences()) {
+    // Copies index their own sequences
+    REQUIRE(copy.storedSequences().find(*e) != copy.storedSequences().end());
+    REQUIRE(&*copy.storedSequences().find(*e) == e);
+    starts.push_back(e->startTimestamp());
+  }
+  REQUIRE(starts == vector<time_point>{unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 4)});
+
+  REQUIRE(seqset.numTimestamps() == 3);
+  REQUIRE(seqset.numInstants() == 4);
+  REQUIRE(seqset.instantN(1) == TInstant<float>(1, unix_time_point(2012, 1, 2)));
+  REQUIRE(seqset.instantN(2) == TInstant<float>(5, unix_time_point(2012, 1, 2)));
+}
+
 TEMPLATE_TEST_CASE("TSequenceSet.period() - gaps are ignored", "[tsequenceset]", int, float) {
   set<TInstant<TestType>> instants = {
       TInstant<TestType>(1, unix_time_point(2012, 1, 1)),
@@ -576,3 +639,173 @@ TEST_CASE("interpolation is maintained in sequences", "[tsequenceset]") {
     REQUIRE(seq.interpolation() == Interpolation::Stepwise);
   }
 }
+
+TEMPLATE_TEST_CASE("TSequenceSet values at timestamps", "[tsequenceset]", int, float) {
+  TSequenceSet<TestType> seqset(
+      set<TSequence<TestType>>{
+          TSequence<TestType>({unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 3)}, {10, 20},
+                              true, false, Interpolation::Stepwise),
+          TSequence<TestType>({unix_time_point(2012, 1, 3), unix_time_point(2012, 1, 4)}, {30, 40},
+                              true, true, Interpolation::Stepwise),
+          TSequence<TestType>({unix_time_point(2012, 1, 6), unix_time_point(2012, 1, 8)}, {50, 60},
+                              false, true, Interpolation::Stepwise),
+      },
+      Interpolation::Stepwise);
+
+  REQUIRE(seqset.valueAtTimestamp(unix_time_point(2012, 1, 2)) == 10);
+  REQUIRE(seqset.valueAtTimestamp(unix_time_point(2012, 1, 3)) == 30);
+  REQUIRE(seqset.valueAtTimestamp(unix_time_point(2012, 1, 7)) == 50);
+  REQUIRE(seqset.valueAtTimestamp(unix_time_point(2012, 1, 8)) == 60);
+  REQUIRE_THROWS_AS(seqset.valueAtTimestamp(unix_time_point(2012, 1, 5)), invalid_argument);
+  REQUIRE_THROWS_AS(seqset.valueAtTimestamp(unix_time_point(2012, 1, 6)), invalid_argument);
+
+  vector<time_point> timestamps;
+  for (int d = 0; d <= 9; d++) {
+    timestamps.push_back(unix_time_point(2012, 1, 1) + duration_ms(d * day));
+  }
+  vector<pair<TestType, time_point>> expected = {
+      {10, unix_time_point(2012, 1, 1)}, {10, unix_time_point(2012, 1, 2)},
+      {30, unix_time_point(2012, 1, 3)}, {40, unix_time_point(2012, 1, 4)},
+      {50, unix_time_point(2012, 1, 7)}, {60, unix_time_point(2012, 1, 8)},
+  };
+  REQUIRE(seqset.valuesAtTimestamps(timestamps) == expected);
+}
+
+TEST_CASE("TSequenceSet linear values at timestamps", "[tsequenceset]") {
+  TSequenceSet<float> seqset(set<TSequence<float>>{
+      TSequence<float>({unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 3)}, {10, 20}),
+      TSequence<float>({unix_time_point(2012, 1, 5), unix_time_point(2012, 1, 9)}, {0, 40}),
+  });
+  REQUIRE(seqset.valueAtTimestamp(unix_time_point(2012, 1, 2)) == 15);
+  REQUIRE(seqset.valueAtTimestamp(unix_time_point(2012, 1, 6)) == 10);
+
+  auto values = seqset.valuesAtTimestamps(
+      {unix_time_point(2012, 1, 2), unix_time_point(2012, 1, 4), unix_time_point(2012, 1, 8)});
+  vector<pair<float, time_point>> expected = {
+      {15, unix_time_point(2012, 1, 2)},
+      {30, unix_time_point(2012, 1, 8)},
+  };
+  REQUIRE(values == expected);
+
+  // Touching at an instant, the value drops right after it
+  TSequenceSet<float> touching("{[20@2012-01-01, 20@2012-01-03], (10@2012-01-03, 10@2012-01-05]}");
+  values = touching.valuesAtTimestamps({unix_time_point(2012, 1, 2), unix_time_point(2012, 1, 4)});
+  expected = {{20, unix_time_point(2012, 1, 2)}, {10, unix_time_point(2012, 1, 4)}};
+  REQUIRE(values == expected);
+}
+
+TEST_CASE("TSequenceSet restrictions", "[tsequenceset]") {
+  TSequenceSet<float> sset("{[10@2012-01-01, 20@2012-01-03), [5@2012-01-05, 10@2012-01-07]}");
+
+  auto result = sset.atPeriod(Period("[2012-01-02, 2012-01-06]"));
+  REQUIRE(dynamic_cast<TSequenceSet<float> const &>(*result)
+          == TSequenceSet<float>("{[15@2012-01-02, 20@2012-01-03), "
+                                 "[5@2012-01-05, 7.5@2012-01-06]}"));
+
+  result = sset.atPeriodSet(PeriodSet("{[2012-01-02, 2012-01-02], [2012-01-06, 2012-02-01]}"));
+  REQUIRE(dynamic_cast<TSequenceSet<float> const &>(*result)
+          == TSequenceSet<float>("{[15@2012-01-02], [7.5@2012-01-06, 10@2012-01-07]}"));
+
+  result = sset.minusPeriod(Period("[2012-01-02, 2012-01-06]"));
+  REQUIRE(dynamic_cast<TSequenceSet<float> const &>(*result)
+          == TSequenceSet<float>("{[10@2012-01-01, 15@2012-01-02), "
+                                 "(7.5@2012-01-06, 10@2012-01-07]}"));
+
+  result = sset.minusTimestampSet(TimestampSet("{2012-01-01, 2012-01-07}"));
+  REQUIRE(dynamic_cast<TSequenceSet<float> const &>(*result)
+          == TSequenceSet<float>("{(10@2012-01-01, 20@2012-01-03), "
+                                 "[5@2012-01-05, 10@2012-01-07)}"));
+
+  REQUIRE(sset.atPeriod(Period("[2012-01-03, 2012-01-05)")) == nullptr);
+  REQUIRE(sset.minusPeriodSet(PeriodSet("{[2012-01-01, 2012-01-04], [2012-01-05, 2012-01-08]}"))
+          == nullptr);
+
+  result = sset.atTimestamp(unix_time_point(2012, 1, 6));
+  REQUIRE(dynamic_cast<TInstant<float> const &>(*result)
+          == TInstant<float>(7.5, unix_time_point(2012, 1, 6)));
+  REQUIRE(sset.atTimestamp(unix_time_point(2012, 1, 4)) == nullptr);
+}
+
+TEST_CASE("TSequenceSet bounding box", "[tsequenceset]") {
+  TSequenceSet<int> sset("{[10@2012-01-01, 20@2012-01-03), [5@2012-01-05, 7@2012-01-07]}");
+  REQUIRE(sset.boundingBox()
+          == TBox(5, unix_time_point(2012, 1, 1), 20, unix_time_point(2012, 1, 7)));
+  REQUIRE(sset.minValue() == 5);
+  REQUIRE(sset.maxValue() == 20);
+
+  // The box rules out the period, the sequences then only by their instants
+  REQUIRE_FALSE(sset.intersectsPeriod(Period("[2012-01-08, 2012-01-09]")));
+  REQUIRE_FALSE(sset.intersectsPeriod(Period("(2012-01-03, 2012-01-05)")));
+  REQUIRE(sset.intersectsPeriod(Period("[2012-01-03, 2012-01-05]")));
+  REQUIRE(sset.intersectsTimestamp(unix_time_point(2012, 1, 7)));
+
+  TSequenceSet<GeomPoint> g("SRID=4326;{[POINT(0 0)@2012-01-01, POINT(1 1)@2012-01-02], "
+                            "[POINT(5 -5)@2012-01-03]}");
+  REQUIRE(g.boundingBox()
+          == STBox(0, -5, unix_time_point(2012, 1, 1), 5, 1, unix_time_point(2012, 1, 3), 4326));
+}
+
+TEST_CASE("equal TSequenceSets hash equally", "[tsequenceset]") {
+  hash<TSequenceSet<GeomPoint>> hash;
+  TSequenceSet<GeomPoint> sequence_set(
+      "SRID=4326;{[POINT(0 0)@2012-01-01, POINT(1 1)@2012-01-02], [POINT(2 2)@2012-01-03]}");
+  set<string> sequences{"[POINT(2 2)@2012-01-03]",
+                        "[POINT(0 0)@2012-01-01, POINT(1 1)@2012-01-02]"};
+  TSequenceSet<GeomPoint> same(sequences, 4326);
+  REQUIRE(hash(sequence_set) == hash(same));
+  REQUIRE(hash(sequence_set) != hash(TSequenceSet<GeomPoint>(sequences, 3857)));
+  REQUIRE(hash(sequence_set) != hash(TSequenceSet<GeomPoint>(
+              "SRID=4326;{[POINT(0 0)@2012-01-01, POINT(1 1)@2012-01-02]}")));
+}
+
+TEST_CASE("TSequenceSet<GeomPoint> length, speed and azimuth", "[tsequenceset]") {
+  TSequenceSet<GeomPoint> sset(
+      "{[POINT(0 0)@2012-01-01 00:00, POINT(3 4)@2012-01-01 00:01], "
+      "[POINT(3 4)@2012-01-01 00:02, POINT(3 0)@2012-01-01 00:03], [POINT(9 9)@2012-01-02]}");
+
+  REQUIRE(sset.length() == 9);
+  REQUIRE(sset.cumulativeLength()
+          == TSequenceSet<float>(set<string>{"[0@2012-01-01 00:00, 5@2012-01-01 00:01]",
+                                             "[5@2012-01-01 00:02, 9@2012-01-01 00:03]",
+                                             "[9@2012-01-02]"}));
+
+  unique_ptr<TSequenceSet<float>> speed = sset.speed();
+  REQUIRE(speed->numSequences() == 2);
+  REQUIRE(speed->valueAtTimestamp(unix_time_point(2012, 1, 1, 0, 2, 30)) == Approx(4.0 / 60));
+
+  unique_ptr<TSequenceSet<float>> azimuth = sset.azimuth();
+  REQUIRE(azimuth->numSequences() == 2);
+  REQUIRE(azimuth->startValue() == Approx(atan2(3, 4)));
+
+  TSequenceSet<GeomPoint> still("{[POINT(1 1)@2012-01-01]}");
+  REQUIRE(still.length() == 0);
+  REQUIRE(still.speed() == nullptr);
+  REQUIRE(still.azimuth() == nullptr);
+}
+
+TEST_CASE("TSequenceSet integral and time-weighted average", "[tsequenceset]") {
+  // The gap between the sequences doesn't count
+  TSequenceSet<float> sset("{[0@2012-01-01, 10@2012-01-02], [20@2012-01-05, 20@2012-01-06]}");
+  REQUIRE(sset.integral() == Approx(25 * 86400));
+  REQUIRE(sset.twAvg() == Approx(12.5));
+
+  TSequenceSet<int> stepwise("{[1@2012-01-01, 3@2012-01-02], [5@2012-01-05, 5@2012-01-08]}");
+  REQUIRE(stepwise.integral() == Approx(16 * 86400));
+  REQUIRE(stepwise.twAvg() == Approx(4));
+
+  TSequenceSet<float> instantaneous("{[1@2012-01-01], [3@2012-01-02]}");
+  REQUIRE(instantaneous.integral() == 0);
+  REQUIRE(instantaneous.twAvg() == 2);
+}
+
+TEST_CASE("TSequenceSet<GeomPoint> time-weighted centroid", "[tsequenceset]") {
+  TSequenceSet<GeomPoint> sset(
+      "{[POINT(0 0)@2012-01-01, POINT(2 0)@2012-01-02], [POINT(4 4)@2012-01-03, "
+      "POINT(4 4)@2012-01-05]}");
+  GeomPoint const centroid = sset.twCentroid();
+  REQUIRE(centroid.x() == Approx(3));
+  REQUIRE(centroid.y() == Approx(8.0 / 3));
+
+  TSequenceSet<GeomPoint> still("{[POINT(1 1)@2012-01-01], [POINT(3 5)@2012-01-02]}");
+  REQUIRE(still.twCentroid() == GeomPoint(2, 3));
+}
@@ -146,6 +146,12 @@ TEST_CASE("Period overlap", "[period]") {
     bool expected = period_1.upper_inc() && period_2.lower_inc();
     REQUIRE(period_1.overlap(period_2) == expected);
   }
+  SECTION("borderline overlap case with an instant period at the lower bound") {
+    Period instant(unix_time_point(2012, 3, 1), unix_time_point(2012, 3, 1), true, true);
+    Period period(unix_time_point(2012, 3, 1), unix_time_point(2012, 5, 1), lower_inc, upper_inc);
+    REQUIRE(instant.overlap(period) == lower_inc);
+    REQUIRE(period.overlap(instant) == lower_inc);
+  }
 }
 
 TEST_CASE("Period contains timestamp", "[period]") {
@@ -174,3 +180,9 @@ TEST_CASE("Period contains timestamp", "[period]") {
     REQUIRE(period.upper_inc() == period.contains_timestamp(unix_time_point(2012, 4, 1)));
   }
 }
+
+TEST_CASE("equal periods hash equally", "[period]") {
+  Period period(unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 2), true, false);
+  REQUIRE(hash<Period>()(period) == hash<Period>()(Period("[2012-01-01, 2012-01-02)")));
+  REQUIRE(hash<Period>()(period) != hash<Period>()(Period("[2012-01-01, 2012-01-02]")));
+}
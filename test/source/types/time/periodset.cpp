@@ -65,12 +65,12 @@ TEST_CASE("PeriodSet period functions", "[periodset]") {
 
   size_t size = GENERATE(0, take(4, random(1, 100)));
 
+  // Periods a week apart, so that none of them overlap
   for (size_t i = 0; i < size; i++) {
     bool lower_inc = random() % 2;
     bool upper_inc = random() % 2;
-    auto lbound = std::chrono::system_clock::from_time_t(
-        (unix_time(2012, 1, 1) + 10 * 365 * (random() % day)) / 1000L);
-    auto duration = std::chrono::milliseconds(day + 6 * (random() % day));
+    auto lbound = unix_time_point(2012, 1, 1) + duration_ms(7 * day * i + random() % day);
+    auto duration = std::chrono::milliseconds(day + 4 * (random() % day));
     auto rbound = lbound + duration;  // This is to make sure lbound <= rbound
     auto period = Period(lbound, rbound, lower_inc, upper_inc);
     expected_periods.insert(period);
@@ -116,7 +116,8 @@ TEST_CASE("PeriodSet timespan", "[periodset]") {
   auto duration_1 = std::chrono::milliseconds(GENERATE(take(4, random(minute, year))));
   auto duration_2 = std::chrono::milliseconds(GENERATE(take(4, random(minute, year))));
   auto period_1 = make_unique<Period>(left, left + duration_1, lower_inc, upper_inc);
-  auto period_2 = make_unique<Period>(left, left + duration_2, lower_inc, upper_inc);
+  auto right = left + duration_1 + std::chrono::milliseconds(day);
+  auto period_2 = make_unique<Period>(right, right + duration_2, lower_inc, upper_inc);
 
   set<unique_ptr<Period>> periods;
   periods.insert(move(period_1));
@@ -159,9 +160,8 @@ TEST_CASE("PeriodSet timestamp functions", "[periodset]") {
   for (size_t i = 0; i < size; i++) {
     bool lower_inc = random() % 2;
     bool upper_inc = random() % 2;
-    time_point lbound = std::chrono::system_clock::from_time_t(
-        (unix_time(2012, 1, 1) + 10 * 365 * (random() % day)) / 1000L);
-    duration_ms duration(day + 6 * (random() % day));
+    time_point lbound = unix_time_point(2012, 1, 1) + duration_ms(7 * day * i + random() % day);
+    duration_ms duration(day + 4 * (random() % day));
     auto rbound = lbound + duration;  // This is to make sure lbound <= rbound
     auto period = Period(lbound, rbound, lower_inc, upper_inc);
     expected_timestamps.insert(lbound);  // Round off to seconds
@@ -180,3 +180,159 @@ TEST_CASE("PeriodSet timestamp functions", "[periodset]") {
     CHECK_THROWS(actual.endTimestamp());
   }
 }
+
+TEST_CASE("PeriodSets are normalized", "[periodset]") {
+  PeriodSet period_set(
+      "{[2012-01-03, 2012-01-04), [2012-01-01, 2012-01-02), [2012-01-02, 2012-01-03), "
+      "(2012-01-05, 2012-01-06], [2012-01-05 12:00, 2012-01-07), [2012-01-08, 2012-01-09]}");
+  REQUIRE(period_set.numPeriods() == 3);
+  REQUIRE(period_set.periodN(0) == Period("[2012-01-01, 2012-01-04)"));
+  REQUIRE(period_set.periodN(1) == Period("(2012-01-05, 2012-01-07)"));
+  REQUIRE(period_set.periodN(2) == Period("[2012-01-08, 2012-01-09]"));
+
+  // Touching bounds are only merged if one of them is inclusive
+  PeriodSet gap("{[2012-01-01, 2012-01-02), (2012-01-02, 2012-01-03)}");
+  REQUIRE(gap.numPeriods() == 2);
+  PeriodSet joined("{[2012-01-01, 2012-01-02), [2012-01-02, 2012-01-02]}");
+  REQUIRE(joined.numPeriods() == 1);
+  REQUIRE(joined.startPeriod() == Period("[2012-01-01, 2012-01-02]"));
+}
+
+TEST_CASE("PeriodSet lookups", "[periodset]") {
+  PeriodSet period_set(
+      "{[2012-01-01, 2012-01-02), (2012-01-02, 2012-01-03], [2012-01-05, 2012-01-05]}");
+
+  SECTION("contains_timestamp") {
+    REQUIRE(period_set.contains_timestamp(unix_time_point(2012, 1, 1)) == true);
+    REQUIRE(period_set.contains_timestamp(unix_time_point(2012, 1, 1, 12)) == true);
+    REQUIRE(period_set.contains_timestamp(unix_time_point(2012, 1, 2)) == false);
+    REQUIRE(period_set.contains_timestamp(unix_time_point(2012, 1, 3)) == true);
+    REQUIRE(period_set.contains_timestamp(unix_time_point(2012, 1, 4)) == false);
+    REQUIRE(period_set.contains_timestamp(unix_time_point(2012, 1, 5)) == true);
+    REQUIRE(period_set.contains_timestamp(unix_time_point(2011, 1, 1)) == false);
+    REQUIRE(period_set.contains_timestamp(unix_time_point(2013, 1, 1)) == false);
+    REQUIRE(PeriodSet().contains_timestamp(unix_time_point(2012, 1, 1)) == false);
+  }
+
+  SECTION("overlap") {
+    REQUIRE(period_set.overlap(Period("[2012-01-02, 2012-01-02]")) == false);
+    REQUIRE(period_set.overlap(Period("[2012-01-02, 2012-01-03)")) == true);
+    REQUIRE(period_set.overlap(Period("(2012-01-03, 2012-01-05)")) == false);
+    REQUIRE(period_set.overlap(Period("(2012-01-03, 2012-01-05]")) == true);
+    REQUIRE(period_set.overlap(Period("[2011-01-01, 2013-01-01]")) == true);
+    REQUIRE(period_set.overlap(PeriodSet("{[2012-01-02, 2012-01-02], [2012-01-04, 2012-01-05)}"))
+            == false);
+    REQUIRE(period_set.overlap(PeriodSet("{[2012-01-02, 2012-01-02], [2012-01-04, 2012-01-05]}"))
+            == true);
+  }
+}
+
+TEST_CASE("PeriodSet set operations", "[periodset]") {
+  PeriodSet lhs("{[2012-01-01, 2012-01-03), [2012-01-05, 2012-01-07]}");
+  PeriodSet rhs("{[2012-01-02, 2012-01-05), (2012-01-07, 2012-01-08]}");
+
+  SECTION("union") {
+    REQUIRE(lhs.union_(rhs) == PeriodSet("{[2012-01-01, 2012-01-08]}"));
+    REQUIRE(lhs.union_(Period("[2012-01-10, 2012-01-11]"))
+            == PeriodSet("{[2012-01-01, 2012-01-03), [2012-01-05, 2012-01-07], "
+                         "[2012-01-10, 2012-01-11]}"));
+    set<time_point> timestamps = {unix_time_point(2012, 1, 3), unix_time_point(2012, 1, 4)};
+    REQUIRE(lhs.union_(TimestampSet(timestamps))
+            == PeriodSet("{[2012-01-01, 2012-01-03], [2012-01-04, 2012-01-04], "
+                         "[2012-01-05, 2012-01-07]}"));
+  }
+
+  SECTION("intersection") {
+    REQUIRE(lhs.intersection(rhs) == PeriodSet("{[2012-01-02, 2012-01-03)}"));
+    REQUIRE(lhs.intersection(Period("[2012-01-02, 2012-01-06)"))
+            == PeriodSet("{[2012-01-02, 2012-01-03), [2012-01-05, 2012-01-06)}"));
+    REQUIRE(lhs.intersection(Period("[2012-01-03, 2012-01-04]")).numPeriods() == 0);
+    set<time_point> timestamps
+        = {unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 3), unix_time_point(2012, 1, 7)};
+    set<time_point> expected = {unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 7)};
+    REQUIRE(lhs.intersection(TimestampSet(timestamps)) == TimestampSet(expected));
+  }
+
+  SECTION("minus") {
+    REQUIRE(lhs.minus(rhs)
+            == PeriodSet("{[2012-01-01, 2012-01-02), [2012-01-05, 2012-01-07]}"));
+    REQUIRE(rhs.minus(lhs)
+            == PeriodSet("{[2012-01-03, 2012-01-05), (2012-01-07, 2012-01-08]}"));
+    REQUIRE(lhs.minus(Period("[2011-01-01, 2013-01-01]")).numPeriods() == 0);
+    set<time_point> timestamps = {unix_time_point(2012, 1, 1), unix_time_point(2012, 1, 6)};
+    REQUIRE(lhs.minus(TimestampSet(timestamps))
+            == PeriodSet("{(2012-01-01, 2012-01-03), [2012-01-05, 2012-01-06), "
+                         "(2012-01-06, 2012-01-07]}"));
+  }
+}
+
+TEST_CASE("PeriodSet set operations agree with the timestamps they contain", "[periodset]") {
+  // Periods over a small grid of hours, so that bounds often coincide
+  auto random_periods = []() {
+    set<Period> periods;
+    size_t const size = 1 + random() % 6;
+    for (size_t i = 0; i < size; i++) {
+      long const lower = random() % 20;
+      long const upper = lower + random() % 5;
+      bool const instant = lower == upper;
+      periods.insert(Period(unix_time_point(2012, 1, 1) + std::chrono::hours(lower),
+                            unix_time_point(2012, 1, 1) + std::chrono::hours(upper),
+                            instant || random() % 2, instant || random() % 2));
+    }
+    return periods;
+  };
+  auto contains = [](set<Period> const &periods, time_point const t) {
+    for (Period const &period : periods) {
+      if (period.contains_timestamp(t)) return true;
+    }
+    return false;
+  };
+
+  for (size_t round = 0; round < 200; round++) {
+    set<Period> const a = random_periods();
+    set<Period> const b = random_periods();
+    PeriodSet const lhs(a);
+    PeriodSet const rhs(b);
+    PeriodSet const union_set = lhs.union_(rhs);
+    PeriodSet const intersection_set = lhs.intersection(rhs);
+    PeriodSet const minus_set = lhs.minus(rhs);
+
+    bool overlapping = false;
+    // Check on every hour and every half hour in between
+    for (long half_hours = -2; half_hours < 52; half_hours++) {
+      time_point const t = unix_time_point(2012, 1, 1) + std::chrono::minutes(30 * half_hours);
+      bool const in_a = contains(a, t);
+      bool const in_b = contains(b, t);
+      overlapping = overlapping || (in_a && in_b);
+      REQUIRE(lhs.contains_timestamp(t) == in_a);
+      REQUIRE(union_set.contains_timestamp(t) == (in_a || in_b));
+      REQUIRE(intersection_set.contains_timestamp(t) == (in_a && in_b));
+      REQUIRE(minus_set.contains_timestamp(t) == (in_a && !in_b));
+    }
+    REQUIRE(lhs.overlap(rhs) == overlapping);
+    for (Period const &period : b) {
+      bool expected = false;
+      for (Period const &other : a) expected = expected || other.overlap(period);
+      REQUIRE(lhs.overlap(period) == expected);
+    }
+
+    // Results are normalized: disjoint and not adjacent
+    for (PeriodSet const *result : {&union_set, &intersection_set, &minus_set}) {
+      for (size_t i = 1; i < result->numPeriods(); i++) {
+        Period const previous = result->periodN(i - 1);
+        Period const current = result->periodN(i);
+        REQUIRE((previous.upper() < current.lower()
+                 || (previous.upper() == current.lower() && !previous.upper_inc()
+                     && !current.lower_inc())));
+      }
+    }
+  }
+}
+
+TEST_CASE("equal period sets hash equally", "[periodset]") {
+  PeriodSet periodset("{[2012-01-01, 2012-01-02), [2012-01-03, 2012-01-04)}");
+  PeriodSet same(set<string>{"[2012-01-03, 2012-01-04)", "[2012-01-01, 2012-01-02)"});
+  PeriodSet other("{[2012-01-01, 2012-01-02)}");
+  REQUIRE(hash<PeriodSet>()(periodset) == hash<PeriodSet>()(same));
+  REQUIRE(hash<PeriodSet>()(periodset) != hash<PeriodSet>()(other));
+}
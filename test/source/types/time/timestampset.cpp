@@ -1,8 +1,11 @@
+#include <algorithm>
 #include <catch2/catch.hpp>
 #include <meos/types/time/Period.hpp>
+#include <meos/types/time/PeriodSet.hpp>
 #include <meos/types/time/TimestampSet.hpp>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "../../common/matchers.hpp"
 #include "../../common/time_utils.hpp"
@@ -144,3 +147,118 @@ TEST_CASE("TimestampSet timestamp functions", "[timestampset]") {
     CHECK_THROWS(actual.endTimestamp());
   }
 }
+
+TEST_CASE("TimestampSet lookups", "[timestampset]") {
+  TimestampSet timestamp_set("{2012-01-01, 2012-01-03, 2012-01-05}");
+
+  SECTION("contains_timestamp") {
+    REQUIRE(timestamp_set.contains_timestamp(unix_time_point(2012, 1, 1)) == true);
+    REQUIRE(timestamp_set.contains_timestamp(unix_time_point(2012, 1, 5)) == true);
+    REQUIRE(timestamp_set.contains_timestamp(unix_time_point(2012, 1, 2)) == false);
+    REQUIRE(timestamp_set.contains_timestamp(unix_time_point(2013, 1, 1)) == false);
+    REQUIRE(TimestampSet().contains_timestamp(unix_time_point(2012, 1, 1)) == false);
+  }
+
+  SECTION("contains_timestamps") {
+    vector<time_point> sorted = {unix_time_point(2011, 1, 1), unix_time_point(2012, 1, 1),
+                                 unix_time_point(2012, 1, 4), unix_time_point(2012, 1, 5),
+                                 unix_time_point(2013, 1, 1)};
+    REQUIRE(timestamp_set.contains_timestamps(sorted)
+            == vector<bool>{false, true, false, true, false});
+    vector<time_point> unsorted = {unix_time_point(2012, 1, 5), unix_time_point(2012, 1, 4),
+                                   unix_time_point(2012, 1, 1)};
+    REQUIRE(timestamp_set.contains_timestamps(unsorted) == vector<bool>{true, false, true});
+  }
+
+  SECTION("contains_any") {
+    REQUIRE(timestamp_set.contains_any({unix_time_point(2012, 1, 2), unix_time_point(2012, 1, 3)})
+            == true);
+    REQUIRE(timestamp_set.contains_any({unix_time_point(2012, 1, 2), unix_time_point(2012, 1, 4)})
+            == false);
+    REQUIRE(timestamp_set.contains_any({}) == false);
+    REQUIRE(timestamp_set.contains_any({unix_time_point(2012, 1, 4), unix_time_point(2012, 1, 1)})
+            == true);
+    REQUIRE(timestamp_set.contains_any({unix_time_point(2012, 1, 4), unix_time_point(2012, 1, 2)})
+            == false);
+  }
+
+  SECTION("overlap") {
+    REQUIRE(timestamp_set.overlap(Period("[2012-01-03, 2012-01-04)")) == true);
+    REQUIRE(timestamp_set.overlap(Period("(2012-01-03, 2012-01-05]")) == true);
+    REQUIRE(timestamp_set.overlap(Period("(2012-01-03, 2012-01-05)")) == false);
+    REQUIRE(timestamp_set.overlap(Period("[2013-01-01, 2013-01-02]")) == false);
+  }
+}
+
+TEST_CASE("TimestampSet set operations", "[timestampset]") {
+  TimestampSet lhs("{2012-01-01, 2012-01-03, 2012-01-05}");
+  TimestampSet rhs("{2012-01-02, 2012-01-03, 2012-01-06}");
+  Period period("(2012-01-01, 2012-01-05]");
+  PeriodSet periodset("{[2012-01-01, 2012-01-02], (2012-01-03, 2012-01-06]}");
+
+  SECTION("union") {
+    REQUIRE(lhs.union_(rhs)
+            == TimestampSet("{2012-01-01, 2012-01-02, 2012-01-03, 2012-01-05, 2012-01-06}"));
+    REQUIRE(lhs.union_(period) == PeriodSet("{[2012-01-01, 2012-01-05]}"));
+    REQUIRE(lhs.union_(periodset)
+            == PeriodSet("{[2012-01-01, 2012-01-02], [2012-01-03, 2012-01-06]}"));
+  }
+
+  SECTION("intersection") {
+    REQUIRE(lhs.intersection(rhs) == TimestampSet("{2012-01-03}"));
+    REQUIRE(lhs.intersection(period) == TimestampSet("{2012-01-03, 2012-01-05}"));
+    REQUIRE(lhs.intersection(periodset) == TimestampSet("{2012-01-01, 2012-01-05}"));
+  }
+
+  SECTION("minus") {
+    REQUIRE(lhs.minus(rhs) == TimestampSet("{2012-01-01, 2012-01-05}"));
+    REQUIRE(lhs.minus(period) == TimestampSet("{2012-01-01}"));
+    REQUIRE(lhs.minus(periodset) == TimestampSet("{2012-01-03}"));
+  }
+}
+
+TEST_CASE("TimestampSet merges agree with std::set", "[timestampset]") {
+  // Sets of very different densities, so that both the short steps and the
+  // long jumps of the merges are taken
+  auto random_timestamps = [](size_t const size, long const range) {
+    set<time_point> timestamps;
+    for (size_t i = 0; i < size; i++) {
+      timestamps.insert(unix_time_point(2012, 1, 1) + duration_ms(minute * (random() % range)));
+    }
+    return timestamps;
+  };
+
+  size_t const lhs_size = GENERATE(0, 1, 5, 100, 1000);
+  size_t const rhs_size = GENERATE(0, 3, 50, 2000);
+  set<time_point> const a = random_timestamps(lhs_size, 3000);
+  set<time_point> const b = random_timestamps(rhs_size, 3000);
+  TimestampSet const lhs(a);
+  TimestampSet const rhs(b);
+
+  set<time_point> expected_union, expected_intersection, expected_minus;
+  set_union(a.begin(), a.end(), b.begin(), b.end(),
+            inserter(expected_union, expected_union.end()));
+  set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                   inserter(expected_intersection, expected_intersection.end()));
+  set_difference(a.begin(), a.end(), b.begin(), b.end(),
+                 inserter(expected_minus, expected_minus.end()));
+
+  REQUIRE(lhs.union_(rhs).timestamps() == expected_union);
+  REQUIRE(lhs.intersection(rhs).timestamps() == expected_intersection);
+  REQUIRE(lhs.minus(rhs).timestamps() == expected_minus);
+
+  vector<time_point> const queries(b.begin(), b.end());
+  vector<bool> const contained = lhs.contains_timestamps(queries);
+  for (size_t i = 0; i < queries.size(); i++) {
+    REQUIRE(contained[i] == (a.count(queries[i]) == 1));
+  }
+  REQUIRE(lhs.contains_any(queries) == !expected_intersection.empty());
+}
+
+TEST_CASE("equal timestamp sets hash equally", "[timestampset]") {
+  TimestampSet timestampset("{2012-01-01, 2012-01-02}");
+  TimestampSet same(set<time_point>{unix_time_point(2012, 1, 2), unix_time_point(2012, 1, 1)});
+  TimestampSet other("{2012-01-01}");
+  REQUIRE(hash<TimestampSet>()(timestampset) == hash<TimestampSet>()(same));
+  REQUIRE(hash<TimestampSet>()(timestampset) != hash<TimestampSet>()(other));
+}
@@ -0,0 +1,29 @@
+#include <atomic>
+#include <catch2/catch.hpp>
+#include <meos/util/parallel.hpp>
+#include <stdexcept>
+#include <vector>
+
+using namespace meos;
+using namespace std;
+
+TEST_CASE("parallel_for calls the function once per index", "[parallel]") {
+  size_t const num_threads = GENERATE(0, 1, 3, 16);
+  size_t const n = GENERATE(0, 1, 2, 1000);
+  vector<atomic<int>> calls(n);
+  parallel_for(
+      n, [&](size_t i) { calls[i]++; }, num_threads);
+  for (auto const &count : calls) REQUIRE(count == 1);
+}
+
+TEST_CASE("parallel_for rethrows errors", "[parallel]") {
+  size_t const num_threads = GENERATE(1, 4);
+  atomic<int> calls(0);
+  auto const f = [&](size_t i) {
+    calls++;
+    if (i == 50) throw invalid_argument("50");
+  };
+  REQUIRE_THROWS_AS(parallel_for(100, f, num_threads), invalid_argument);
+  // Only the rest of the chunk that threw is skipped
+  REQUIRE(calls >= 51);
+}